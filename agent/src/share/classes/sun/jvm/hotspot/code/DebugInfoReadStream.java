@@ -58,7 +58,7 @@ public class DebugInfoReadStream extends CompressedReadStream {
     return code.getMethodAt(readInt());
   }
 
-  ScopeValue readObjectValue() {
+  ScopeValue readObjectValue(boolean hasLength) {
     int id = readInt();
     if (Assert.ASSERTS_ENABLED) {
       Assert.that(objectPool != null, "object pool does not exist");
@@ -70,7 +70,7 @@ public class DebugInfoReadStream extends CompressedReadStream {
     ObjectValue result = new ObjectValue(id);
     // Cache the object since an object field could reference it.
     objectPool.add(result);
-    result.readObject(this);
+    result.readObject(this, hasLength);
     return result;
   }
 
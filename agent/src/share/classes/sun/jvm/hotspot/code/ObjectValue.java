@@ -35,6 +35,7 @@ import sun.jvm.hotspot.utilities.*;
 public class ObjectValue extends ScopeValue {
   private int        id;
   private ScopeValue klass;
+  private ScopeValue length;      // array length if not implied by the elements
   private List       fieldsValue; // ArrayList<ScopeValue>
 
   // Field "boolean visited" is not implemented here since
@@ -43,12 +44,14 @@ public class ObjectValue extends ScopeValue {
   public ObjectValue(int id) {
     this.id = id;
     klass   = null;
+    length  = null;
     fieldsValue = new ArrayList();
   }
 
   public boolean isObject() { return true; }
   public int id() { return id; }
   public ScopeValue getKlass() { return klass; }
+  public ScopeValue getLength() { return length; }
   public List getFieldsValue() { return fieldsValue; }
   public ScopeValue getFieldAt(int i) { return (ScopeValue)fieldsValue.get(i); }
   public int fieldsSize() { return fieldsValue.size(); }
@@ -60,11 +63,14 @@ public class ObjectValue extends ScopeValue {
 
   /** Serialization of debugging information */
 
-  void readObject(DebugInfoReadStream stream) {
+  void readObject(DebugInfoReadStream stream, boolean hasLength) {
     klass = readFrom(stream);
     Assert.that(klass.isConstantOop(), "should be constant klass oop");
-    int length = stream.readInt();
-    for (int i = 0; i < length; i++) {
+    if (hasLength) {
+      length = readFrom(stream);
+    }
+    int fieldsCount = stream.readInt();
+    for (int i = 0; i < fieldsCount; i++) {
       ScopeValue val = readFrom(stream);
       fieldsValue.add(val);
     }
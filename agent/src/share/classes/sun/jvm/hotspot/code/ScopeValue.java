@@ -51,6 +51,7 @@ public abstract class ScopeValue {
   static final int CONSTANT_DOUBLE_CODE = 4;
   static final int CONSTANT_OBJECT_CODE = 5;
   static final int CONSTANT_OBJECT_ID_CODE = 6;
+  static final int CONSTANT_ARRAY_OBJECT_CODE = 7;
 
   public boolean isLocation()       { return false; }
   public boolean isConstantInt()    { return false; }
@@ -72,7 +73,9 @@ public abstract class ScopeValue {
     case CONSTANT_DOUBLE_CODE:
       return new ConstantDoubleValue(stream);
     case CONSTANT_OBJECT_CODE:
-      return stream.readObjectValue();
+      return stream.readObjectValue(false);
+    case CONSTANT_ARRAY_OBJECT_CODE:
+      return stream.readObjectValue(true);
     case CONSTANT_OBJECT_ID_CODE:
       return stream.getCachedObject();
     default:
@@ -276,7 +276,15 @@ public class Bytecodes {
   public static final int _invokehandle         = 233;
   public static final int _shouldnotreachhere   = 234; // For debugging
 
-  public static final int number_of_codes       = 235;
+  // superinstructions, see SUPERINSTRUCTIONS_DO in bytecodes.hpp
+  public static final int _fast_aload_0_aload_1 = 235;
+  public static final int _fast_aload_0_iload_1 = 236;
+  public static final int _fast_aload_0_dup     = 237;
+  public static final int _fast_aload_1_aload_2 = 238;
+  public static final int _fast_iload_1_iload_2 = 239;
+  public static final int _fast_iload_iconst_1  = 240;
+
+  public static final int number_of_codes       = 241;
 
   // Flag bits derived from format strings, can_trap, can_rewrite, etc.:
   // semantic flags:
@@ -809,6 +817,14 @@ public class Bytecodes {
 
     def(_shouldnotreachhere  , "_shouldnotreachhere" , "b"    , null    , BasicType.getTVoid()   ,  0, false);
 
+    // superinstructions
+    def(_fast_aload_0_aload_1, "fast_aload_0_aload_1", "b_"   , null    , BasicType.getTObject() ,  2, false, _aload_0        );
+    def(_fast_aload_0_iload_1, "fast_aload_0_iload_1", "b_"   , null    , BasicType.getTInt()    ,  2, false, _aload_0        );
+    def(_fast_aload_0_dup    , "fast_aload_0_dup"    , "b_"   , null    , BasicType.getTVoid()   ,  2, false, _aload_0        );
+    def(_fast_aload_1_aload_2, "fast_aload_1_aload_2", "b_"   , null    , BasicType.getTObject() ,  2, false, _aload_1        );
+    def(_fast_iload_1_iload_2, "fast_iload_1_iload_2", "b_"   , null    , BasicType.getTInt()    ,  2, false, _iload_1        );
+    def(_fast_iload_iconst_1 , "fast_iload_iconst_1" , "bi_"  , null    , BasicType.getTInt()    ,  2, false, _iload          );
+
     if (Assert.ASSERTS_ENABLED) {
       // compare can_trap information for each bytecode with the
       // can_trap information for the corresponding base bytecode
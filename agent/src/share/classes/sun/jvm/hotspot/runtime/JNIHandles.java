@@ -31,6 +31,7 @@ import sun.jvm.hotspot.types.*;
 public class JNIHandles {
   private static AddressField      globalHandlesField;
   private static AddressField      weakGlobalHandlesField;
+  private static CIntegerField     handleStripesField;
   private static OopField          deletedHandleField;
 
   static {
@@ -46,6 +47,7 @@ public class JNIHandles {
 
     globalHandlesField = type.getAddressField("_global_handles");
     weakGlobalHandlesField = type.getAddressField("_weak_global_handles");
+    handleStripesField = type.getCIntegerField("_handle_stripes");
     deletedHandleField = type.getOopField("_deleted_handle");
 
   }
@@ -53,20 +55,30 @@ public class JNIHandles {
   public JNIHandles() {
   }
 
-  public JNIHandleBlock globalHandles() {
-    Address handleAddr  = globalHandlesField.getValue();
-    if (handleAddr == null) {
-      return null;
-    }
-    return new JNIHandleBlock(handleAddr);
+  /** Returns the first global handle block of each stripe */
+  public List globalHandles() {
+    return handleBlocks(globalHandlesField.getValue());
+  }
+
+  /** Returns the first weak global handle block of each stripe */
+  public List weakGlobalHandles() {
+    return handleBlocks(weakGlobalHandlesField.getValue());
   }
 
-  public JNIHandleBlock weakGlobalHandles() {
-    Address handleAddr  = weakGlobalHandlesField.getValue();
-    if (handleAddr == null) {
-      return null;
+  private List handleBlocks(Address stripesAddr) {
+    List blocks = new ArrayList();
+    if (stripesAddr == null) {
+      return blocks;
+    }
+    long stripes = handleStripesField.getValue();
+    long addressSize = VM.getVM().getAddressSize();
+    for (long i = 0; i < stripes; i++) {
+      Address handleAddr = stripesAddr.getAddressAt(i * addressSize);
+      if (handleAddr != null) {
+        blocks.add(new JNIHandleBlock(handleAddr));
+      }
     }
-    return new JNIHandleBlock(handleAddr);
+    return blocks;
   }
 
   public OopHandle deletedHandle() {
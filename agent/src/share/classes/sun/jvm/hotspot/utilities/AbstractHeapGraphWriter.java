@@ -25,6 +25,7 @@
 package sun.jvm.hotspot.utilities;
 
 import java.io.*;
+import java.util.*;
 import sun.jvm.hotspot.debugger.*;
 import sun.jvm.hotspot.memory.*;
 import sun.jvm.hotspot.oops.*;
@@ -145,8 +146,8 @@ public abstract class AbstractHeapGraphWriter implements HeapGraphWriter {
 
     protected void writeGlobalJNIHandles() throws IOException {
         JNIHandles handles = VM.getVM().getJNIHandles();
-        JNIHandleBlock blk = handles.globalHandles();
-        if (blk != null) {
+        for (Iterator iter = handles.globalHandles().iterator(); iter.hasNext(); ) {
+            JNIHandleBlock blk = (JNIHandleBlock) iter.next();
             try {
                 blk.oopsDo(new AddressVisitor() {
                           public void visitAddress(Address handleAddr) {
@@ -24,6 +24,7 @@
 
 package sun.jvm.hotspot.utilities;
 
+import java.util.*;
 import sun.jvm.hotspot.code.*;
 import sun.jvm.hotspot.debugger.*;
 import sun.jvm.hotspot.gc_interface.*;
@@ -108,34 +109,28 @@ public class PointerFinder {
 
     // Check JNIHandles; both local and global
     JNIHandles handles = VM.getVM().getJNIHandles();
-    JNIHandleBlock handleBlock = handles.globalHandles();
-    if (handleBlock != null) {
-      handleBlock = handleBlock.blockContainingHandle(a);
-    }
+    JNIHandleBlock handleBlock = blockContainingHandle(handles.globalHandles(), a);
     if (handleBlock != null) {
       loc.inStrongGlobalJNIHandleBlock = true;
       loc.handleBlock = handleBlock;
       return loc;
     } else {
-      handleBlock = handles.weakGlobalHandles();
+      handleBlock = blockContainingHandle(handles.weakGlobalHandles(), a);
       if (handleBlock != null) {
-        handleBlock = handleBlock.blockContainingHandle(a);
-        if (handleBlock != null) {
-          loc.inWeakGlobalJNIHandleBlock = true;
-          loc.handleBlock = handleBlock;
-          return loc;
-        } else {
-          // Look in thread-local handles
-          for (JavaThread t = VM.getVM().getThreads().first(); t != null; t = t.next()) {
-            handleBlock = t.activeHandles();
+        loc.inWeakGlobalJNIHandleBlock = true;
+        loc.handleBlock = handleBlock;
+        return loc;
+      } else {
+        // Look in thread-local handles
+        for (JavaThread t = VM.getVM().getThreads().first(); t != null; t = t.next()) {
+          handleBlock = t.activeHandles();
+          if (handleBlock != null) {
+            handleBlock = handleBlock.blockContainingHandle(a);
             if (handleBlock != null) {
-              handleBlock = handleBlock.blockContainingHandle(a);
-              if (handleBlock != null) {
-                loc.inLocalJNIHandleBlock = true;
-                loc.handleBlock = handleBlock;
-                loc.handleThread = t;
-                return loc;
-              }
+              loc.inLocalJNIHandleBlock = true;
+              loc.handleBlock = handleBlock;
+              loc.handleThread = t;
+              return loc;
             }
           }
         }
@@ -146,4 +141,14 @@ public class PointerFinder {
     // Fall through; have to return it anyway.
     return loc;
   }
+
+  private static JNIHandleBlock blockContainingHandle(List stripes, Address a) {
+    for (Iterator iter = stripes.iterator(); iter.hasNext(); ) {
+      JNIHandleBlock handleBlock = ((JNIHandleBlock) iter.next()).blockContainingHandle(a);
+      if (handleBlock != null) {
+        return handleBlock;
+      }
+    }
+    return null;
+  }
 }
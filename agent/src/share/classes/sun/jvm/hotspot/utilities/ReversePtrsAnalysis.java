@@ -302,7 +302,9 @@ public class ReversePtrsAnalysis {
   }
 
   // Traverse a JNIHandleBlock
-  private void doJNIHandleBlock(JNIHandleBlock handles, AddressVisitor oopVisitor) {
-    handles.oopsDo(oopVisitor);
+  private void doJNIHandleBlock(List stripes, AddressVisitor oopVisitor) {
+    for (Iterator iter = stripes.iterator(); iter.hasNext(); ) {
+      ((JNIHandleBlock) iter.next()).oopsDo(oopVisitor);
+    }
   }
 }
@@ -104,6 +104,12 @@ void CounterOverflowStub::emit_code(LIR_Assembler* ce) {
 }
 
 
+void ProfileBranchSampleStub::emit_code(LIR_Assembler* ce) {
+  // C1ProfileBranchSampleLog is reset to 0 in VM_Version::initialize()
+  ShouldNotReachHere();
+}
+
+
 void DivByZeroStub::emit_code(LIR_Assembler* ce) {
   if (_offset != -1) {
     ce->compilation()->implicit_exception_table()->append(_offset, __ offset());
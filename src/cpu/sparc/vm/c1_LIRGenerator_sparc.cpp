@@ -789,6 +789,10 @@ void LIRGenerator::do_update_CRC32(Intrinsic* x) {
   fatal("CRC32 intrinsic is not implemented on this platform");
 }
 
+void LIRGenerator::do_update_checksum_bytes(Intrinsic* x) {
+  fatal("CRC32C and Adler32 intrinsics are not implemented on this platform");
+}
+
 // _i2l, _i2f, _i2d, _l2i, _l2f, _l2d, _f2i, _f2l, _f2d, _d2i, _d2l, _d2f
 // _i2b, _i2c, _i2s
 void LIRGenerator::do_Convert(Convert* x) {
@@ -1324,6 +1324,57 @@ void Assembler::cpuid() {
   emit_int8((unsigned char)0xA2);
 }
 
+void Assembler::crc32(Register crc, Register v, int8_t sizeInBytes) {
+  assert(VM_Version::supports_sse4_2(), "");
+  emit_int8((unsigned char)0xF2);
+  int encode;
+  switch (sizeInBytes) {
+  case 1:
+    encode = prefix_and_encode(crc->encoding(), v->encoding(), true);
+    break;
+  case 4:
+    encode = prefix_and_encode(crc->encoding(), v->encoding());
+    break;
+#ifdef _LP64
+  case 8:
+    encode = prefixq_and_encode(crc->encoding(), v->encoding());
+    break;
+#endif
+  default:
+    ShouldNotReachHere();
+    encode = 0;
+  }
+  emit_int8(0x0F);
+  emit_int8(0x38);
+  emit_int8((unsigned char)(sizeInBytes == 1 ? 0xF0 : 0xF1));
+  emit_int8((unsigned char)(0xC0 | encode));
+}
+
+void Assembler::crc32(Register crc, Address adr, int8_t sizeInBytes) {
+  assert(VM_Version::supports_sse4_2(), "");
+  InstructionMark im(this);
+  emit_int8((unsigned char)0xF2);
+  switch (sizeInBytes) {
+  case 1:
+    prefix(adr, crc, true);
+    break;
+  case 4:
+    prefix(adr, crc);
+    break;
+#ifdef _LP64
+  case 8:
+    prefixq(adr, crc);
+    break;
+#endif
+  default:
+    ShouldNotReachHere();
+  }
+  emit_int8(0x0F);
+  emit_int8(0x38);
+  emit_int8((unsigned char)(sizeInBytes == 1 ? 0xF0 : 0xF1));
+  emit_operand(crc, adr);
+}
+
 void Assembler::cvtdq2pd(XMMRegister dst, XMMRegister src) {
   NOT_LP64(assert(VM_Version::supports_sse2(), ""));
   emit_simd_arith_nonds(0xE6, dst, src, VEX_SIMD_F3);
@@ -2418,6 +2469,23 @@ void Assembler::pmovzxbw(XMMRegister dst, XMMRegister src) {
   emit_int8((unsigned char)(0xC0 | encode));
 }
 
+void Assembler::pmaddubsw(XMMRegister dst, XMMRegister src) {
+  assert(VM_Version::supports_ssse3(), "");
+  int encode = simd_prefix_and_encode(dst, dst, src, VEX_SIMD_66, VEX_OPCODE_0F_38);
+  emit_int8(0x04);
+  emit_int8((unsigned char)(0xC0 | encode));
+}
+
+void Assembler::pmaddwd(XMMRegister dst, XMMRegister src) {
+  NOT_LP64(assert(VM_Version::supports_sse2(), ""));
+  emit_simd_arith(0xF5, dst, src, VEX_SIMD_66);
+}
+
+void Assembler::psadbw(XMMRegister dst, XMMRegister src) {
+  NOT_LP64(assert(VM_Version::supports_sse2(), ""));
+  emit_simd_arith(0xF6, dst, src, VEX_SIMD_66);
+}
+
 // generic
 void Assembler::pop(Register dst) {
   int encode = prefix_and_encode(dst->encoding());
@@ -2575,6 +2643,15 @@ void Assembler::psrldq(XMMRegister dst, int shift) {
   emit_int8(shift);
 }
 
+void Assembler::pslldq(XMMRegister dst, int shift) {
+  // Shift left 128 bit value in xmm register by number of bytes.
+  NOT_LP64(assert(VM_Version::supports_sse2(), ""));
+  int encode = simd_prefix_and_encode(xmm7, dst, dst, VEX_SIMD_66);
+  emit_int8(0x73);
+  emit_int8((unsigned char)(0xC0 | encode));
+  emit_int8(shift);
+}
+
 void Assembler::ptest(XMMRegister dst, Address src) {
   assert(VM_Version::supports_sse4_1(), "");
   assert((UseAVX > 0), "SSE mode requires address alignment 16 bytes");
@@ -3061,6 +3138,14 @@ void Assembler::xorl(Register dst, Address src) {
   emit_operand(dst, src);
 }
 
+void Assembler::xorb(Register dst, Address src) {
+  NOT_LP64(assert(dst->has_byte_register(), "must have byte register"));
+  InstructionMark im(this);
+  prefix(src, dst, true);
+  emit_int8(0x32);
+  emit_operand(dst, src);
+}
+
 void Assembler::xorl(Register dst, Register src) {
   (void) prefix_and_encode(dst->encoding(), src->encoding());
   emit_arith(0x33, 0xC0, dst, src);
@@ -3786,6 +3871,17 @@ void Assembler::vinsertf128h(XMMRegister dst, XMMRegister nds, XMMRegister src)
   emit_int8(0x01);
 }
 
+void Assembler::vextractf128h(XMMRegister dst, XMMRegister src) {
+  assert(VM_Version::supports_avx(), "");
+  bool vector256 = true;
+  // swap src<->dst for encoding
+  int encode = vex_prefix_and_encode(src, xnoreg, dst, VEX_SIMD_66, vector256, VEX_OPCODE_0F_3A);
+  emit_int8(0x19);
+  emit_int8((unsigned char)(0xC0 | encode));
+  // 0x01 - extract from upper 128 bits
+  emit_int8(0x01);
+}
+
 void Assembler::vinsertf128h(XMMRegister dst, Address src) {
   assert(VM_Version::supports_avx(), "");
   InstructionMark im(this);
@@ -3824,6 +3920,17 @@ void Assembler::vinserti128h(XMMRegister dst, XMMRegister nds, XMMRegister src)
   emit_int8(0x01);
 }
 
+void Assembler::vextracti128h(XMMRegister dst, XMMRegister src) {
+  assert(VM_Version::supports_avx2(), "");
+  bool vector256 = true;
+  // swap src<->dst for encoding
+  int encode = vex_prefix_and_encode(src, xnoreg, dst, VEX_SIMD_66, vector256, VEX_OPCODE_0F_3A);
+  emit_int8(0x39);
+  emit_int8((unsigned char)(0xC0 | encode));
+  // 0x01 - extract from upper 128 bits
+  emit_int8(0x01);
+}
+
 void Assembler::vinserti128h(XMMRegister dst, Address src) {
   assert(VM_Version::supports_avx2(), "");
   InstructionMark im(this);
@@ -1022,6 +1022,10 @@ private:
   // Identify processor type and features
   void cpuid();
 
+  // Accumulate CRC32C (Castagnoli) value of a 1, 4 or 8 byte operand
+  void crc32(Register crc, Register v, int8_t sizeInBytes);
+  void crc32(Register crc, Address adr, int8_t sizeInBytes);
+
   // Convert Scalar Double-Precision Floating-Point Value to Scalar Single-Precision Floating-Point Value
   void cvtsd2ss(XMMRegister dst, XMMRegister src);
   void cvtsd2ss(XMMRegister dst, Address src);
@@ -1488,6 +1492,15 @@ private:
   void pmovzxbw(XMMRegister dst, XMMRegister src);
   void pmovzxbw(XMMRegister dst, Address src);
 
+  // Multiply Unsigned and Signed Bytes and Add Adjacent Words (SSSE3)
+  void pmaddubsw(XMMRegister dst, XMMRegister src);
+
+  // Multiply Words and Add Adjacent Doublewords
+  void pmaddwd(XMMRegister dst, XMMRegister src);
+
+  // Sum of Absolute Differences of Packed Unsigned Bytes
+  void psadbw(XMMRegister dst, XMMRegister src);
+
 #ifndef _LP64 // no 32bit push/pop on amd64
   void popl(Address dst);
 #endif
@@ -1527,6 +1540,8 @@ private:
 
   // Shift Right by bytes Logical DoubleQuadword Immediate
   void psrldq(XMMRegister dst, int shift);
+  // Shift Left by bytes Logical DoubleQuadword Immediate
+  void pslldq(XMMRegister dst, int shift);
 
   // Logical Compare 128bit
   void ptest(XMMRegister dst, XMMRegister src);
@@ -1685,6 +1700,8 @@ private:
   void xorl(Register dst, Address src);
   void xorl(Register dst, Register src);
 
+  void xorb(Register dst, Address src);
+
   void xorq(Register dst, Address src);
   void xorq(Register dst, Register src);
 
@@ -1853,6 +1870,10 @@ private:
   void vinsertf128h(XMMRegister dst, XMMRegister nds, XMMRegister src);
   void vinserti128h(XMMRegister dst, XMMRegister nds, XMMRegister src);
 
+  // Copy high 128bit of YMM registers into low 128bit of XMM registers.
+  void vextractf128h(XMMRegister dst, XMMRegister src);
+  void vextracti128h(XMMRegister dst, XMMRegister src);
+
   // Load/store high 128bit of YMM registers which does not destroy other half.
   void vinsertf128h(XMMRegister dst, Address src);
   void vinserti128h(XMMRegister dst, Address src);
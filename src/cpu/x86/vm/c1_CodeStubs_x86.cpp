@@ -89,6 +89,28 @@ void CounterOverflowStub::emit_code(LIR_Assembler* ce) {
   __ jmp(_continuation);
 }
 
+void ProfileBranchSampleStub::emit_code(LIR_Assembler* ce) {
+  __ bind(_entry);
+  Register md = _md->as_register();
+  Address counter = _offset->is_register()
+                    ? Address(md, _offset->as_pointer_register(), Address::times_1)
+                    : Address(md, _offset->as_jint());
+  __ addptr(counter, DataLayout::counter_increment << C1ProfileBranchSampleLog);
+
+  // Next interval: uniform in [1, 2^(n+1)], from the high bits of an LCG
+  Register thread = _thread->as_pointer_register();
+  Register tmp = _tmp->as_register();
+  __ movl(tmp, Address(thread, JavaThread::profile_sample_seed_offset()));
+  __ imull(tmp, tmp, 1103515245);
+  __ addl(tmp, 12345);
+  __ movl(Address(thread, JavaThread::profile_sample_seed_offset()), tmp);
+  __ shrl(tmp, 16);
+  __ andl(tmp, (2 << C1ProfileBranchSampleLog) - 1);
+  __ incrementl(tmp);
+  __ movl(Address(thread, JavaThread::profile_sample_countdown_offset()), tmp);
+  __ jmp(_continuation);
+}
+
 RangeCheckStub::RangeCheckStub(CodeEmitInfo* info, LIR_Opr index,
                                bool throw_index_out_of_bounds_exception)
   : _throw_index_out_of_bounds_exception(throw_index_out_of_bounds_exception)
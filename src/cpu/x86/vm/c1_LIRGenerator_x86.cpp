@@ -809,6 +809,22 @@ void LIRGenerator::do_CompareAndSwap(Intrinsic* x, ValueType* type) {
 
 void LIRGenerator::do_MathIntrinsic(Intrinsic* x) {
   assert(x->number_of_arguments() == 1 || (x->number_of_arguments() == 2 && x->id() == vmIntrinsics::_dpow), "wrong type");
+
+  address libm_entry = NULL;
+  switch(x->id()) {
+    case vmIntrinsics::_dexp: libm_entry = StubRoutines::dexp(); break;
+    case vmIntrinsics::_dlog: libm_entry = StubRoutines::dlog(); break;
+    case vmIntrinsics::_dpow: libm_entry = StubRoutines::dpow(); break;
+    case vmIntrinsics::_dsin: libm_entry = StubRoutines::dsin(); break;
+    case vmIntrinsics::_dcos: libm_entry = StubRoutines::dcos(); break;
+    case vmIntrinsics::_dtan: libm_entry = StubRoutines::dtan(); break;
+    default:                  break;
+  }
+  if (libm_entry != NULL) {
+    do_LibmIntrinsic(x, libm_entry);
+    return;
+  }
+
   LIRItem value(x->argument_at(0), this);
 
   bool use_fpu = false;
@@ -882,6 +898,29 @@ void LIRGenerator::do_MathIntrinsic(Intrinsic* x) {
 }
 
 
+// Calls one of the libm stubs, which take their arguments and return
+// their result like the C function they replace.
+void LIRGenerator::do_LibmIntrinsic(Intrinsic* x, address entry) {
+  BasicTypeList signature(2);
+  signature.append(T_DOUBLE);
+  if (x->number_of_arguments() == 2) {
+    signature.append(T_DOUBLE);
+  }
+  CallingConvention* cc = frame_map()->c_calling_convention(&signature);
+  const LIR_Opr result_reg = result_register_for(x->type());
+
+  LIRItem value(x->argument_at(0), this);
+  value.load_item_force(cc->at(0));
+  if (x->number_of_arguments() == 2) {
+    LIRItem extra_arg(x->argument_at(1), this);
+    extra_arg.load_item_force(cc->at(1));
+  }
+  LIR_Opr result = rlock_result(x);
+  __ call_runtime_leaf(entry, getThreadTemp(), result_reg, cc->args());
+  __ move(result_reg, result);
+}
+
+
 void LIRGenerator::do_ArrayCopy(Intrinsic* x) {
   assert(x->number_of_arguments() == 5, "wrong type");
 
@@ -1011,6 +1050,103 @@ void LIRGenerator::do_update_CRC32(Intrinsic* x) {
   }
 }
 
+// Checksums over a byte[] range or a raw buffer computed by a stub with the
+// signature of updateBytesCRC32: int (int value, byte* buf, int len).
+//   int java.util.zip.CRC32C.updateBytes(int crc, byte[] b, int off, int end)
+//   int java.util.zip.CRC32C.updateDirectByteBuffer(int crc, long address, int off, int end)
+//   int java.util.zip.Adler32.updateBytes(int adler, byte[] b, int off, int len)
+//   int java.util.zip.Adler32.updateByteBuffer(int adler, long addr, int off, int len)
+void LIRGenerator::do_update_checksum_bytes(Intrinsic* x) {
+  bool is_updateBytes;
+  bool is_end_index;
+  address stub;
+  switch (x->id()) {
+    case vmIntrinsics::_updateBytesCRC32C:
+    case vmIntrinsics::_updateDirectByteBufferCRC32C:
+      assert(UseCRC32CIntrinsics, "need SSE4.2 crc32 instruction support");
+      is_updateBytes = (x->id() == vmIntrinsics::_updateBytesCRC32C);
+      is_end_index = true;
+      stub = StubRoutines::updateBytesCRC32C();
+      break;
+    case vmIntrinsics::_updateBytesAdler32:
+    case vmIntrinsics::_updateByteBufferAdler32:
+      assert(UseAdler32Intrinsics, "need SSSE3 instructions support");
+      is_updateBytes = (x->id() == vmIntrinsics::_updateBytesAdler32);
+      is_end_index = false;
+      stub = StubRoutines::updateBytesAdler32();
+      break;
+    default:
+      ShouldNotReachHere();
+      return;
+  }
+
+  // Make all state_for calls early since they can emit code
+  LIR_Opr result = rlock_result(x);
+
+  LIRItem value(x->argument_at(0), this);
+  LIRItem buf(x->argument_at(1), this);
+  LIRItem off(x->argument_at(2), this);
+  LIRItem len(x->argument_at(3), this);
+  buf.load_item();
+  off.load_nonconstant();
+
+  LIR_Opr index = off.result();
+  int offset = is_updateBytes ? arrayOopDesc::base_offset_in_bytes(T_BYTE) : 0;
+  if (off.result()->is_constant()) {
+    index = LIR_OprFact::illegalOpr;
+    offset += off.result()->as_jint();
+  }
+  LIR_Opr base_op = buf.result();
+
+#ifndef _LP64
+  if (!is_updateBytes) { // long b raw address
+    base_op = new_register(T_INT);
+    __ convert(Bytecodes::_l2i, buf.result(), base_op);
+  }
+#else
+  if (index->is_valid()) {
+    LIR_Opr tmp = new_register(T_LONG);
+    __ convert(Bytecodes::_i2l, index, tmp);
+    index = tmp;
+  }
+#endif
+
+  LIR_Address* a = new LIR_Address(base_op,
+                                   index,
+                                   LIR_Address::times_1,
+                                   offset,
+                                   T_BYTE);
+  BasicTypeList signature(3);
+  signature.append(T_INT);
+  signature.append(T_ADDRESS);
+  signature.append(T_INT);
+  CallingConvention* cc = frame_map()->c_calling_convention(&signature);
+  const LIR_Opr result_reg = result_register_for(x->type());
+
+  LIR_Opr addr = new_pointer_register();
+  __ leal(LIR_OprFact::address(a), addr);
+
+  LIR_Opr length = LIR_OprFact::illegalOpr;
+  if (is_end_index) {
+    // length = end - off
+    len.load_item();
+    length = new_register(T_INT);
+    __ move(len.result(), length);
+    __ sub(length, off.result(), length);
+  }
+
+  value.load_item_force(cc->at(0));
+  __ move(addr, cc->at(1));
+  if (is_end_index) {
+    __ move(length, cc->at(2));
+  } else {
+    len.load_item_force(cc->at(2));
+  }
+
+  __ call_runtime_leaf(stub, getThreadTemp(), result_reg, cc->args());
+  __ move(result_reg, result);
+}
+
 // _i2l, _i2f, _i2d, _l2i, _l2f, _l2d, _f2i, _f2l, _f2d, _d2i, _d2l, _d2f
 // _i2b, _i2c, _i2s
 LIR_Opr fixed_register_for(BasicType type) {
@@ -1319,8 +1455,11 @@ void LIRGenerator::do_If(If* x) {
   LIR_Opr left = xin->result();
   LIR_Opr right = yin->result();
   __ cmp(lir_cond(cond), left, right);
-  // Generate branch profiling. Profiling code doesn't kill flags.
-  profile_branch(x, cond);
+  // Generate branch profiling. Profiling code doesn't kill flags, except
+  // for sampled profiling which compares again; float compares and long
+  // compares that destroy their operands are always profiled in full.
+  bool can_compare_again = !x->x()->type()->is_float_kind() NOT_LP64(&& tag != longTag);
+  profile_branch(x, cond, can_compare_again ? left : LIR_OprFact::illegalOpr, right);
   move_to_phi(x->state());
   if (x->x()->type()->is_float_kind()) {
     __ branch(lir_cond(cond), right->type(), x->tsux(), x->usux());
@@ -41,6 +41,10 @@
   address generate_Reference_get_entry();
   address generate_CRC32_update_entry();
   address generate_CRC32_updateBytes_entry(AbstractInterpreter::MethodKind kind);
+#ifdef _LP64
+  address generate_CRC32C_updateBytes_entry(AbstractInterpreter::MethodKind kind);
+  address generate_Adler32_updateBytes_entry(AbstractInterpreter::MethodKind kind);
+#endif
   void lock_method(void);
   void generate_stack_overflow_check(void);
 
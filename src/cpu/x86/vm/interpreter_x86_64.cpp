@@ -249,8 +249,32 @@ address InterpreterGenerator::generate_math_entry(AbstractInterpreter::MethodKin
   //       this entry point for the corresponding methods in JDK 1.3.
   // get argument
 
+  address libm_entry = NULL;
+  switch (kind) {
+    case Interpreter::java_lang_math_sin : libm_entry = StubRoutines::dsin(); break;
+    case Interpreter::java_lang_math_cos : libm_entry = StubRoutines::dcos(); break;
+    case Interpreter::java_lang_math_tan : libm_entry = StubRoutines::dtan(); break;
+    case Interpreter::java_lang_math_log : libm_entry = StubRoutines::dlog(); break;
+    case Interpreter::java_lang_math_pow : libm_entry = StubRoutines::dpow(); break;
+    case Interpreter::java_lang_math_exp : libm_entry = StubRoutines::dexp(); break;
+    default                              : break;
+  }
+
   if (kind == Interpreter::java_lang_math_sqrt) {
     __ sqrtsd(xmm0, Address(rsp, wordSize));
+  } else if (libm_entry != NULL) {
+    // The libm stubs take their arguments in xmm0 (and xmm1) and may
+    // tail-call into the runtime, so call them like a C function. There
+    // is no interpreter frame here, so bypass the interpreter's version
+    // of call_VM_leaf, which checks the frame's last_sp.
+    if (kind == Interpreter::java_lang_math_pow) {
+      __ movdbl(xmm0, Address(rsp, 3*wordSize)); // first argument (one
+                                                 // empty stack slot)
+      __ movdbl(xmm1, Address(rsp, wordSize));
+    } else {
+      __ movdbl(xmm0, Address(rsp, wordSize));
+    }
+    __ super_call_VM_leaf(libm_entry);
   } else {
     __ fld_d(Address(rsp, wordSize));
     switch (kind) {
@@ -907,8 +907,30 @@ class MacroAssembler: public Assembler {
   // computes pow(x,y). Fallback to runtime call included.
   void pow_with_fallback(int num_fpu_regs_in_use) { pow_or_exp(false, num_fpu_regs_in_use); }
 
+#ifdef _LP64
+  // SSE2 versions of the fdlibm code behind StrictMath.exp/log/pow/sin/cos/tan,
+  // bit-identical to SharedRuntime::dexp etc.  Arguments and result follow the
+  // C calling convention; special cases tail-call the SharedRuntime routine.
+  void fdlibm_exp();
+  void fdlibm_log();
+  void fdlibm_pow();
+  void fdlibm_sin();
+  void fdlibm_cos();
+  void fdlibm_tan();
+#endif
+
 private:
 
+#ifdef _LP64
+  void fdlibm_load_constants();
+  void fdlibm_clear_low(XMMRegister x, Register tmp);
+  void fdlibm_negate(XMMRegister x);
+  void fdlibm_rem_pio2(Label& L_slow);
+  void fdlibm_kernel_sin(bool iy);
+  void fdlibm_kernel_cos();
+  void fdlibm_kernel_tan(Label& L_slow);
+#endif
+
   // call runtime as a fallback for trig functions and pow/exp.
   void fp_runtime_fallback(address runtime_entry, int nb_args, int num_fpu_regs_in_use);
 
@@ -0,0 +1,1186 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "asm/assembler.hpp"
+#include "asm/assembler.inline.hpp"
+#include "runtime/sharedRuntime.hpp"
+#include "runtime/stubRoutines.hpp"
+#include "macroAssembler_x86.hpp"
+
+#ifdef _LP64
+
+// SSE2 translations of the fdlibm routines in sharedRuntimeTrans.cpp and
+// sharedRuntimeTrig.cpp.  Every floating point operation of the common
+// path is performed in the same order and with the same operands as in
+// the C code, so the results are bit-identical to StrictMath.  Arguments
+// the C code treats specially (NaN, infinities, zero, subnormals, huge
+// trig arguments, overflow and underflow) are not handled here: the
+// generated code restores the original arguments and tail-calls the
+// SharedRuntime function instead.
+//
+// The code follows the C calling convention: arguments in xmm0 (and
+// xmm1), result in xmm0.  Only registers that are volatile on both
+// Linux and Windows are used: rax, rcx, rdx, r8 - r11 and xmm0 - xmm5.
+// r8 holds the base of the constant table below.
+
+struct FdlibmConstants {
+  double one, two, three, half, minus_one;
+  // __ieee754_exp
+  double halF[2], ln2HI[2], ln2LO[2];
+  double invln2, P1, P2, P3, P4, P5;
+  // __ieee754_log
+  double third, Lg1, Lg2, Lg3, Lg4, Lg5, Lg6, Lg7;
+  // __ieee754_pow
+  double bp[2], dp_h[2], dp_l[2];
+  double L1X, L2X, L3X, L4X, L5X, L6X;
+  double lg2, lg2_h, lg2_l, cp, cp_h, cp_l;
+  // __ieee754_rem_pio2
+  double invpio2, pio2_1, pio2_1t, pio2_2, pio2_2t, pio2_3, pio2_3t;
+  // __kernel_sin, __kernel_cos
+  double S1, S2, S3, S4, S5, S6;
+  double C1, C2, C3, C4, C5, C6, qx_max;
+  // __kernel_tan
+  double pio4, pio4lo, T[13];
+  jint npio2_hw[32];
+};
+
+static const FdlibmConstants fdlibm_constants = {
+  1.0, 2.0, 3.0, 0.5, -1.0,
+
+  { 0.5, -0.5 },
+  {  6.93147180369123816490e-01,          /* 0x3fe62e42, 0xfee00000 */
+    -6.93147180369123816490e-01 },        /* 0xbfe62e42, 0xfee00000 */
+  {  1.90821492927058770002e-10,          /* 0x3dea39ef, 0x35793c76 */
+    -1.90821492927058770002e-10 },        /* 0xbdea39ef, 0x35793c76 */
+  1.44269504088896338700e+00,             /* 0x3ff71547, 0x652b82fe */
+  1.66666666666666019037e-01,             /* 0x3FC55555, 0x5555553E */
+  -2.77777777770155933842e-03,            /* 0xBF66C16C, 0x16BEBD93 */
+  6.61375632143793436117e-05,             /* 0x3F11566A, 0xAF25DE2C */
+  -1.65339022054652515390e-06,            /* 0xBEBBBD41, 0xC5D26BF1 */
+  4.13813679705723846039e-08,             /* 0x3E663769, 0x72BEA4D0 */
+
+  0.33333333333333333,
+  6.666666666666735130e-01,               /* 3FE55555 55555593 */
+  3.999999999940941908e-01,               /* 3FD99999 9997FA04 */
+  2.857142874366239149e-01,               /* 3FD24924 94229359 */
+  2.222219843214978396e-01,               /* 3FCC71C5 1D8E78AF */
+  1.818357216161805012e-01,               /* 3FC74664 96CB03DE */
+  1.531383769920937332e-01,               /* 3FC39A09 D078C69F */
+  1.479819860511658591e-01,               /* 3FC2F112 DF3E5244 */
+
+  { 1.0, 1.5 },
+  { 0.0, 5.84962487220764160156e-01 },    /* 0x3FE2B803, 0x40000000 */
+  { 0.0, 1.35003920212974897128e-08 },    /* 0x3E4CFDEB, 0x43CFD006 */
+  5.99999999999994648725e-01,             /* 0x3FE33333, 0x33333303 */
+  4.28571428578550184252e-01,             /* 0x3FDB6DB6, 0xDB6FABFF */
+  3.33333329818377432918e-01,             /* 0x3FD55555, 0x518F264D */
+  2.72728123808534006489e-01,             /* 0x3FD17460, 0xA91D4101 */
+  2.30660745775561754067e-01,             /* 0x3FCD864A, 0x93C9DB65 */
+  2.06975017800338417784e-01,             /* 0x3FCA7E28, 0x4A454EEF */
+  6.93147180559945286227e-01,             /* 0x3FE62E42, 0xFEFA39EF */
+  6.93147182464599609375e-01,             /* 0x3FE62E43, 0x00000000 */
+  -1.90465429995776804525e-09,            /* 0xBE205C61, 0x0CA86C39 */
+  9.61796693925975554329e-01,             /* 0x3FEEC709, 0xDC3A03FD */
+  9.61796700954437255859e-01,             /* 0x3FEEC709, 0xE0000000 */
+  -7.02846165095275826516e-09,            /* 0xBE3E2FE0, 0x145B01F5 */
+
+  6.36619772367581382433e-01,             /* 0x3FE45F30, 0x6DC9C883 */
+  1.57079632673412561417e+00,             /* 0x3FF921FB, 0x54400000 */
+  6.07710050650619224932e-11,             /* 0x3DD0B461, 0x1A626331 */
+  6.07710050630396597660e-11,             /* 0x3DD0B461, 0x1A600000 */
+  2.02226624879595063154e-21,             /* 0x3BA3198A, 0x2E037073 */
+  2.02226624871116645580e-21,             /* 0x3BA3198A, 0x2E000000 */
+  8.47842766036889956997e-32,             /* 0x397B839A, 0x252049C1 */
+
+  -1.66666666666666324348e-01,            /* 0xBFC55555, 0x55555549 */
+  8.33333333332248946124e-03,             /* 0x3F811111, 0x1110F8A6 */
+  -1.98412698298579493134e-04,            /* 0xBF2A01A0, 0x19C161D5 */
+  2.75573137070700676789e-06,             /* 0x3EC71DE3, 0x57B1FE7D */
+  -2.50507602534068634195e-08,            /* 0xBE5AE5E6, 0x8A2B9CEB */
+  1.58969099521155010221e-10,             /* 0x3DE5D93A, 0x5ACFD57C */
+  4.16666666666666019037e-02,             /* 0x3FA55555, 0x5555554C */
+  -1.38888888888741095749e-03,            /* 0xBF56C16C, 0x16C15177 */
+  2.48015872894767294178e-05,             /* 0x3EFA01A0, 0x19CB1590 */
+  -2.75573143513906633035e-07,            /* 0xBE927E4F, 0x809C52AD */
+  2.08757232129817482790e-09,             /* 0x3E21EE9E, 0xBDB4B1C4 */
+  -1.13596475577881948265e-11,            /* 0xBDA8FAE9, 0xBE8838D4 */
+  0.28125,
+
+  7.85398163397448278999e-01,             /* 0x3FE921FB, 0x54442D18 */
+  3.06161699786838301793e-17,             /* 0x3C81A626, 0x33145C07 */
+  {  3.33333333333334091986e-01,          /* 0x3FD55555, 0x55555563 */
+     1.33333333333201242699e-01,          /* 0x3FC11111, 0x1110FE7A */
+     5.39682539762260521377e-02,          /* 0x3FABA1BA, 0x1BB341FE */
+     2.18694882948595424599e-02,          /* 0x3F9664F4, 0x8406D637 */
+     8.86323982359930005737e-03,          /* 0x3F8226E3, 0xE96E8493 */
+     3.59207910759131235356e-03,          /* 0x3F6D6D22, 0xC9560328 */
+     1.45620945432529025516e-03,          /* 0x3F57DBC8, 0xFEE08315 */
+     5.88041240820264096874e-04,          /* 0x3F4344D8, 0xF2F26501 */
+     2.46463134818469906812e-04,          /* 0x3F3026F7, 0x1A8D1068 */
+     7.81794442939557092300e-05,          /* 0x3F147E88, 0xA03792A6 */
+     7.14072491382608190305e-05,          /* 0x3F12B80F, 0x32F0A7E9 */
+    -1.85586374855275456654e-05,          /* 0xBEF375CB, 0xDB605373 */
+     2.59073051863633712884e-05 },        /* 0x3EFB2A70, 0x74BF7AD4 */
+
+  { 0x3FF921FB, 0x400921FB, 0x4012D97C, 0x401921FB, 0x401F6A7A, 0x4022D97C,
+    0x4025FDBB, 0x402921FB, 0x402C463A, 0x402F6A7A, 0x4031475C, 0x4032D97C,
+    0x40346B9C, 0x4035FDBB, 0x40378FDB, 0x403921FB, 0x403AB41B, 0x403C463A,
+    0x403DD85A, 0x403F6A7A, 0x40407E4C, 0x4041475C, 0x4042106C, 0x4042D97C,
+    0x4043A28C, 0x40446B9C, 0x404534AC, 0x4045FDBB, 0x4046C6CB, 0x40478FDB,
+    0x404858EB, 0x404921FB }
+};
+
+#define FDLIBM_CONST(name)           Address(r8, (int)offset_of(FdlibmConstants, name))
+#define FDLIBM_ENTRY(name, index)    Address(r8, index, Address::times_8, (int)offset_of(FdlibmConstants, name))
+
+void MacroAssembler::fdlibm_load_constants() {
+  lea(r8, ExternalAddress((address)&fdlibm_constants));
+}
+
+// Clears the low word of a double, like set_low(&x, 0).
+void MacroAssembler::fdlibm_clear_low(XMMRegister x, Register tmp) {
+  movdq(tmp, x);
+  shrq(tmp, 32);
+  shlq(tmp, 32);
+  movdq(x, tmp);
+}
+
+// Flips the sign of a double; destroys r10 and r11.
+void MacroAssembler::fdlibm_negate(XMMRegister x) {
+  mov64(r11, CONST64(0x8000000000000000));
+  movdq(r10, x);
+  xorq(r10, r11);
+  movdq(x, r10);
+}
+
+// __ieee754_exp
+void MacroAssembler::fdlibm_exp() {
+  Label L_slow, L_small, L_general, L_reduced, L_poly, L_scale;
+
+  movdq(rax, xmm0);
+  shrq(rax, 32);
+  movl(rdx, rax);
+  shrl(rdx, 31);                        // xsb
+  andl(rax, 0x7fffffff);                // hx: high word of |x|
+  cmpl(rax, 0x40862E42);                // |x| >= 709.78, inf or NaN
+  jcc(Assembler::aboveEqual, L_slow);
+  fdlibm_load_constants();
+
+  cmpl(rax, 0x3fd62e42);                // |x| <= 0.5 ln2
+  jcc(Assembler::belowEqual, L_small);
+  cmpl(rax, 0x3FF0A2B2);                // |x| >= 1.5 ln2
+  jcc(Assembler::aboveEqual, L_general);
+  movapd(xmm1, xmm0);
+  subsd(xmm1, FDLIBM_ENTRY(ln2HI, rdx)); // hi = x - ln2HI[xsb]
+  movsd(xmm2, FDLIBM_ENTRY(ln2LO, rdx)); // lo = ln2LO[xsb]
+  movl(rcx, 1);
+  subl(rcx, rdx);
+  subl(rcx, rdx);                       // k = 1 - xsb - xsb
+  jmp(L_reduced);
+
+  bind(L_general);
+  movsd(xmm1, FDLIBM_CONST(invln2));
+  mulsd(xmm1, xmm0);
+  addsd(xmm1, FDLIBM_ENTRY(halF, rdx));
+  cvttsd2sil(rcx, xmm1);                // k = (int)(invln2*x + halF[xsb])
+  cmpl(rcx, -1021);                     // result may be subnormal
+  jcc(Assembler::less, L_slow);
+  cvtsi2sdl(xmm3, rcx);                 // t = k
+  movsd(xmm2, FDLIBM_CONST(ln2LO[0]));
+  mulsd(xmm2, xmm3);                    // lo = t*ln2LO[0]
+  mulsd(xmm3, FDLIBM_CONST(ln2HI[0]));
+  movapd(xmm1, xmm0);
+  subsd(xmm1, xmm3);                    // hi = x - t*ln2HI[0]
+
+  bind(L_reduced);
+  movapd(xmm0, xmm1);
+  subsd(xmm0, xmm2);                    // x = hi - lo
+  jmp(L_poly);
+
+  bind(L_small);
+  xorl(rcx, rcx);                       // k = 0
+  cmpl(rax, 0x3e300000);
+  jcc(Assembler::aboveEqual, L_poly);
+  addsd(xmm0, FDLIBM_CONST(one));       // |x| < 2**-28: one + x
+  ret(0);
+
+  bind(L_poly);
+  movapd(xmm3, xmm0);
+  mulsd(xmm3, xmm0);                    // t = x*x
+  movapd(xmm4, xmm3);
+  mulsd(xmm4, FDLIBM_CONST(P5));
+  addsd(xmm4, FDLIBM_CONST(P4));
+  mulsd(xmm4, xmm3);
+  addsd(xmm4, FDLIBM_CONST(P3));
+  mulsd(xmm4, xmm3);
+  addsd(xmm4, FDLIBM_CONST(P2));
+  mulsd(xmm4, xmm3);
+  addsd(xmm4, FDLIBM_CONST(P1));
+  mulsd(xmm4, xmm3);
+  movapd(xmm5, xmm0);
+  subsd(xmm5, xmm4);                    // c = x - t*(P1+t*(P2+t*(P3+t*(P4+t*P5))))
+  movapd(xmm4, xmm0);
+  mulsd(xmm4, xmm5);                    // x*c
+  testl(rcx, rcx);
+  jcc(Assembler::notZero, L_scale);
+  subsd(xmm5, FDLIBM_CONST(two));
+  divsd(xmm4, xmm5);
+  subsd(xmm4, xmm0);
+  movsd(xmm0, FDLIBM_CONST(one));
+  subsd(xmm0, xmm4);                    // one-((x*c)/(c-2.0)-x)
+  ret(0);
+
+  bind(L_scale);
+  movsd(xmm3, FDLIBM_CONST(two));
+  subsd(xmm3, xmm5);
+  divsd(xmm4, xmm3);
+  subsd(xmm2, xmm4);
+  subsd(xmm2, xmm1);
+  movsd(xmm0, FDLIBM_CONST(one));
+  subsd(xmm0, xmm2);                    // y = one-((lo-(x*c)/(2.0-c))-hi)
+  movdq(rax, xmm0);
+  movslq(rcx, rcx);
+  shlq(rcx, 52);
+  addq(rax, rcx);                       // add k to y's exponent
+  movdq(xmm0, rax);
+  ret(0);
+
+  bind(L_slow);
+  jump(RuntimeAddress(CAST_FROM_FN_PTR(address, SharedRuntime::dexp)));
+}
+
+// __ieee754_log
+void MacroAssembler::fdlibm_log() {
+  Label L_slow, L_tiny_f, L_tiny_f_k, L_zero_f_k, L_normal_f, L_no_hfsq, L_hfsq_k, L_no_hfsq_k;
+
+  movdq(rax, xmm0);
+  movq(rdx, rax);
+  shrq(rdx, 32);                        // hx
+  cmpl(rdx, 0x00100000);                // zero, negative or subnormal
+  jcc(Assembler::less, L_slow);
+  cmpl(rdx, 0x7ff00000);                // inf or NaN
+  jcc(Assembler::greaterEqual, L_slow);
+  fdlibm_load_constants();
+
+  movl(rcx, rdx);
+  sarl(rcx, 20);
+  subl(rcx, 1023);                      // k
+  andl(rdx, 0x000fffff);
+  movl(r9, rdx);
+  addl(r9, 0x95f64);
+  andl(r9, 0x100000);                   // i
+  movl(r10, r9);
+  xorl(r10, 0x3ff00000);
+  orl(r10, rdx);
+  shlq(r10, 32);
+  movl(rax, rax);
+  orq(rax, r10);
+  movdq(xmm0, rax);                     // normalize x or x/2
+  shrl(r9, 20);
+  addl(rcx, r9);                        // k += i>>20
+  subsd(xmm0, FDLIBM_CONST(one));       // f = x-1.0
+
+  movl(rax, rdx);
+  addl(rax, 2);
+  andl(rax, 0x000fffff);
+  cmpl(rax, 3);
+  jcc(Assembler::greaterEqual, L_normal_f);
+  // |f| < 2**-20
+  xorpd(xmm1, xmm1);
+  ucomisd(xmm0, xmm1);
+  jcc(Assembler::notEqual, L_tiny_f);
+  testl(rcx, rcx);
+  jcc(Assembler::notZero, L_zero_f_k);
+  movapd(xmm0, xmm1);
+  ret(0);
+
+  bind(L_zero_f_k);
+  cvtsi2sdl(xmm1, rcx);                 // dk
+  movapd(xmm0, xmm1);
+  mulsd(xmm0, FDLIBM_CONST(ln2HI[0]));
+  mulsd(xmm1, FDLIBM_CONST(ln2LO[0]));
+  addsd(xmm0, xmm1);                    // dk*ln2_hi+dk*ln2_lo
+  ret(0);
+
+  bind(L_tiny_f);
+  movapd(xmm1, xmm0);
+  mulsd(xmm1, xmm0);
+  movsd(xmm2, FDLIBM_CONST(third));
+  mulsd(xmm2, xmm0);
+  movsd(xmm3, FDLIBM_CONST(half));
+  subsd(xmm3, xmm2);
+  mulsd(xmm1, xmm3);                    // R = f*f*(0.5-0.33333333333333333*f)
+  testl(rcx, rcx);
+  jcc(Assembler::notZero, L_tiny_f_k);
+  subsd(xmm0, xmm1);                    // f-R
+  ret(0);
+
+  bind(L_tiny_f_k);
+  cvtsi2sdl(xmm2, rcx);                 // dk
+  movapd(xmm3, xmm2);
+  mulsd(xmm3, FDLIBM_CONST(ln2LO[0]));
+  subsd(xmm1, xmm3);
+  subsd(xmm1, xmm0);
+  mulsd(xmm2, FDLIBM_CONST(ln2HI[0]));
+  subsd(xmm2, xmm1);                    // dk*ln2_hi-((R-dk*ln2_lo)-f)
+  movapd(xmm0, xmm2);
+  ret(0);
+
+  bind(L_normal_f);
+  movsd(xmm2, FDLIBM_CONST(two));
+  addsd(xmm2, xmm0);
+  movapd(xmm1, xmm0);
+  divsd(xmm1, xmm2);                    // s = f/(2.0+f)
+  movapd(xmm3, xmm1);
+  mulsd(xmm3, xmm1);                    // z = s*s
+  movapd(xmm4, xmm3);
+  mulsd(xmm4, xmm3);                    // w = z*z
+  movapd(xmm5, xmm4);
+  mulsd(xmm5, FDLIBM_CONST(Lg6));
+  addsd(xmm5, FDLIBM_CONST(Lg4));
+  mulsd(xmm5, xmm4);
+  addsd(xmm5, FDLIBM_CONST(Lg2));
+  mulsd(xmm5, xmm4);                    // t1 = w*(Lg2+w*(Lg4+w*Lg6))
+  movapd(xmm2, xmm4);
+  mulsd(xmm2, FDLIBM_CONST(Lg7));
+  addsd(xmm2, FDLIBM_CONST(Lg5));
+  mulsd(xmm2, xmm4);
+  addsd(xmm2, FDLIBM_CONST(Lg3));
+  mulsd(xmm2, xmm4);
+  addsd(xmm2, FDLIBM_CONST(Lg1));
+  mulsd(xmm2, xmm3);                    // t2 = z*(Lg1+w*(Lg3+w*(Lg5+w*Lg7)))
+  addsd(xmm2, xmm5);                    // R = t2+t1
+  movl(rax, rdx);
+  subl(rax, 0x6147a);
+  movl(r9, 0x6b851);
+  subl(r9, rdx);
+  orl(rax, r9);
+  jcc(Assembler::lessEqual, L_no_hfsq);
+
+  movsd(xmm3, FDLIBM_CONST(half));
+  mulsd(xmm3, xmm0);
+  mulsd(xmm3, xmm0);                    // hfsq = 0.5*f*f
+  movapd(xmm4, xmm3);
+  addsd(xmm4, xmm2);
+  mulsd(xmm4, xmm1);                    // s*(hfsq+R)
+  testl(rcx, rcx);
+  jcc(Assembler::notZero, L_hfsq_k);
+  subsd(xmm3, xmm4);
+  subsd(xmm0, xmm3);                    // f-(hfsq-s*(hfsq+R))
+  ret(0);
+
+  bind(L_hfsq_k);
+  cvtsi2sdl(xmm5, rcx);                 // dk
+  movapd(xmm2, xmm5);
+  mulsd(xmm2, FDLIBM_CONST(ln2LO[0]));
+  addsd(xmm4, xmm2);
+  subsd(xmm3, xmm4);
+  subsd(xmm3, xmm0);
+  mulsd(xmm5, FDLIBM_CONST(ln2HI[0]));
+  subsd(xmm5, xmm3);                    // dk*ln2_hi-((hfsq-(s*(hfsq+R)+dk*ln2_lo))-f)
+  movapd(xmm0, xmm5);
+  ret(0);
+
+  bind(L_no_hfsq);
+  movapd(xmm3, xmm0);
+  subsd(xmm3, xmm2);
+  mulsd(xmm3, xmm1);                    // s*(f-R)
+  testl(rcx, rcx);
+  jcc(Assembler::notZero, L_no_hfsq_k);
+  subsd(xmm0, xmm3);                    // f-s*(f-R)
+  ret(0);
+
+  bind(L_no_hfsq_k);
+  cvtsi2sdl(xmm5, rcx);                 // dk
+  movapd(xmm2, xmm5);
+  mulsd(xmm2, FDLIBM_CONST(ln2LO[0]));
+  subsd(xmm3, xmm2);
+  subsd(xmm3, xmm0);
+  mulsd(xmm5, FDLIBM_CONST(ln2HI[0]));
+  subsd(xmm5, xmm3);                    // dk*ln2_hi-((s*(f-R)-dk*ln2_lo)-f)
+  movapd(xmm0, xmm5);
+  ret(0);
+
+  bind(L_slow);
+  jump(RuntimeAddress(CAST_FROM_FN_PTR(address, SharedRuntime::dlog)));
+}
+
+// __ieee754_pow for positive normal x and finite |y| <= 2**31.
+void MacroAssembler::fdlibm_pow() {
+  Label L_slow, L_one, L_recip, L_not_one, L_not_two, L_x_special;
+  Label L_k_done, L_k_next, L_round_done, L_positive_z;
+
+  movdq(r9, xmm0);                      // x
+  movdq(r11, xmm1);                     // y
+  fdlibm_load_constants();
+
+  movq(rax, r11);
+  shlq(rax, 1);
+  jcc(Assembler::zero, L_one);          // x**0 = 1
+  movq(rax, r9);
+  shrq(rax, 32);                        // hx
+  cmpl(rax, 0x00100000);                // x is zero, negative or subnormal
+  jcc(Assembler::less, L_slow);
+  cmpl(rax, 0x7ff00000);                // x is inf or NaN
+  jcc(Assembler::greaterEqual, L_slow);
+  movq(rdx, r11);
+  shrq(rdx, 32);                        // hy
+  movl(rcx, rdx);
+  andl(rcx, 0x7fffffff);                // iy
+  cmpl(rcx, 0x41e00000);                // |y| > 2**31, inf or NaN
+  jcc(Assembler::greater, L_slow);
+
+  // special values of y
+  testl(r11, r11);
+  jcc(Assembler::notZero, L_x_special);
+  cmpl(rcx, 0x3ff00000);
+  jcc(Assembler::notEqual, L_not_one);
+  testl(rdx, rdx);
+  jcc(Assembler::less, L_recip);
+  ret(0);                               // x**1 = x
+  bind(L_recip);
+  movsd(xmm1, FDLIBM_CONST(one));
+  divsd(xmm1, xmm0);                    // x**-1 = one/x
+  movapd(xmm0, xmm1);
+  ret(0);
+  bind(L_not_one);
+  cmpl(rdx, 0x40000000);
+  jcc(Assembler::notEqual, L_not_two);
+  mulsd(xmm0, xmm0);                    // x**2 = x*x
+  ret(0);
+  bind(L_not_two);
+  cmpl(rdx, 0x3fe00000);
+  jcc(Assembler::notEqual, L_x_special);
+  sqrtsd(xmm0, xmm0);                   // x**0.5 = sqrt(x)
+  ret(0);
+
+  bind(L_x_special);
+  mov64(rdx, CONST64(0x3ff0000000000000));
+  cmpq(r9, rdx);
+  jcc(Assembler::equal, L_one);         // 1**y = 1
+
+  // Compute log2(x) = t1 + t2.
+  movl(r10, rax);
+  sarl(r10, 20);
+  subl(r10, 0x3ff);                     // n
+  movl(rdx, rax);
+  andl(rdx, 0x000fffff);                // j
+  movl(rax, rdx);
+  orl(rax, 0x3ff00000);                 // normalize ix
+  xorl(rcx, rcx);                       // k = 0
+  cmpl(rdx, 0x3988E);                   // |x| < sqrt(3/2)
+  jcc(Assembler::lessEqual, L_k_done);
+  cmpl(rdx, 0xBB67A);                   // |x| < sqrt(3)
+  jcc(Assembler::greaterEqual, L_k_next);
+  movl(rcx, 1);
+  jmp(L_k_done);
+  bind(L_k_next);
+  incrementl(r10);
+  subl(rax, 0x00100000);
+  bind(L_k_done);
+
+  movl(rdx, r9);
+  shlq(rax, 32);
+  orq(rax, rdx);
+  movdq(xmm0, rax);                     // ax
+  shrq(rax, 32);
+  movl(rdx, rax);
+  sarl(rdx, 1);
+  orl(rdx, 0x20000000);
+  addl(rdx, 0x00080000);
+  shll(rcx, 18);
+  addl(rdx, rcx);
+  shrl(rcx, 18);
+  shlq(rdx, 32);                        // high word of ax+bp[k]
+
+  movapd(xmm1, xmm0);
+  subsd(xmm1, FDLIBM_ENTRY(bp, rcx));   // u = ax-bp[k]
+  movapd(xmm2, xmm0);
+  addsd(xmm2, FDLIBM_ENTRY(bp, rcx));
+  movsd(xmm3, FDLIBM_CONST(one));
+  divsd(xmm3, xmm2);                    // v = one/(ax+bp[k])
+  movapd(xmm2, xmm1);
+  mulsd(xmm2, xmm3);                    // ss = u*v
+  movapd(xmm4, xmm2);
+  fdlibm_clear_low(xmm4, rax);          // s_h
+  movdq(xmm5, rdx);                     // t_h
+  subsd(xmm5, FDLIBM_ENTRY(bp, rcx));
+  subsd(xmm0, xmm5);                    // t_l = ax - (t_h-bp[k])
+  movdq(xmm5, rdx);
+  mulsd(xmm5, xmm4);
+  subsd(xmm1, xmm5);
+  movapd(xmm5, xmm4);
+  mulsd(xmm5, xmm0);
+  subsd(xmm1, xmm5);
+  mulsd(xmm1, xmm3);                    // s_l = v*((u-s_h*t_h)-s_h*t_l)
+
+  movapd(xmm0, xmm2);
+  mulsd(xmm0, xmm2);                    // s2 = ss*ss
+  movapd(xmm3, xmm0);
+  mulsd(xmm3, FDLIBM_CONST(L6X));
+  addsd(xmm3, FDLIBM_CONST(L5X));
+  mulsd(xmm3, xmm0);
+  addsd(xmm3, FDLIBM_CONST(L4X));
+  mulsd(xmm3, xmm0);
+  addsd(xmm3, FDLIBM_CONST(L3X));
+  mulsd(xmm3, xmm0);
+  addsd(xmm3, FDLIBM_CONST(L2X));
+  mulsd(xmm3, xmm0);
+  addsd(xmm3, FDLIBM_CONST(L1X));
+  movapd(xmm5, xmm0);
+  mulsd(xmm5, xmm0);
+  mulsd(xmm5, xmm3);                    // r = s2*s2*(L1X+...)
+  movapd(xmm3, xmm4);
+  addsd(xmm3, xmm2);
+  mulsd(xmm3, xmm1);
+  addsd(xmm5, xmm3);                    // r += s_l*(s_h+ss)
+  movapd(xmm0, xmm4);
+  mulsd(xmm0, xmm4);                    // s2 = s_h*s_h
+  movsd(xmm3, FDLIBM_CONST(three));
+  addsd(xmm3, xmm0);
+  addsd(xmm3, xmm5);
+  fdlibm_clear_low(xmm3, rax);          // t_h = 3.0+s2+r
+  movdq(rdx, xmm1);                     // s_l
+  movapd(xmm1, xmm3);
+  subsd(xmm1, FDLIBM_CONST(three));
+  subsd(xmm1, xmm0);
+  subsd(xmm5, xmm1);                    // t_l = r-((t_h-3.0)-s2)
+  mulsd(xmm4, xmm3);                    // u = s_h*t_h
+  movdq(xmm0, rdx);
+  mulsd(xmm0, xmm3);
+  mulsd(xmm5, xmm2);
+  addsd(xmm0, xmm5);                    // v = s_l*t_h+t_l*ss
+  movapd(xmm1, xmm4);
+  addsd(xmm1, xmm0);
+  fdlibm_clear_low(xmm1, rax);          // p_h = u+v
+  movapd(xmm2, xmm1);
+  subsd(xmm2, xmm4);
+  subsd(xmm0, xmm2);                    // p_l = v-(p_h-u)
+  movsd(xmm2, FDLIBM_CONST(cp_h));
+  mulsd(xmm2, xmm1);                    // z_h = cp_h*p_h
+  movsd(xmm3, FDLIBM_CONST(cp_l));
+  mulsd(xmm3, xmm1);
+  mulsd(xmm0, FDLIBM_CONST(cp));
+  addsd(xmm3, xmm0);
+  addsd(xmm3, FDLIBM_ENTRY(dp_l, rcx)); // z_l = cp_l*p_h+p_l*cp+dp_l[k]
+  cvtsi2sdl(xmm4, r10);                 // t = n
+  movapd(xmm5, xmm2);
+  addsd(xmm5, xmm3);
+  addsd(xmm5, FDLIBM_ENTRY(dp_h, rcx));
+  addsd(xmm5, xmm4);
+  fdlibm_clear_low(xmm5, rax);          // t1 = (((z_h+z_l)+dp_h[k])+t)
+  movapd(xmm0, xmm5);
+  subsd(xmm0, xmm4);
+  subsd(xmm0, FDLIBM_ENTRY(dp_h, rcx));
+  subsd(xmm0, xmm2);
+  subsd(xmm3, xmm0);                    // t2 = z_l-(((t1-t)-dp_h[k])-z_h)
+
+  // Split up y into y1+y2 and compute (y1+y2)*(t1+t2).
+  movq(rax, r11);
+  shrq(rax, 32);
+  shlq(rax, 32);
+  movdq(xmm0, rax);                     // y1
+  movdq(xmm1, r11);                     // y
+  movapd(xmm2, xmm1);
+  subsd(xmm2, xmm0);
+  mulsd(xmm2, xmm5);
+  mulsd(xmm1, xmm3);
+  addsd(xmm2, xmm1);                    // p_l = (y-y1)*t1+y*t2
+  mulsd(xmm0, xmm5);                    // p_h = y1*t1
+  movapd(xmm1, xmm2);
+  addsd(xmm1, xmm0);                    // z = p_l+p_h
+  movdq(rax, xmm1);
+  shrq(rax, 32);                        // j
+  movl(r10, rax);
+  cmpl(rax, 0x40900000);                // z >= 1024
+  jcc(Assembler::greaterEqual, L_slow);
+  movl(rdx, rax);
+  andl(rdx, 0x7fffffff);                // i
+  cmpl(rdx, 0x4090cc00);                // z <= -1075
+  jcc(Assembler::greaterEqual, L_slow);
+
+  // Compute 2**(p_h+p_l).
+  xorl(rax, rax);                       // n = 0
+  cmpl(rdx, 0x3fe00000);
+  jcc(Assembler::lessEqual, L_round_done);
+  movl(rcx, rdx);
+  shrl(rcx, 20);
+  subl(rcx, 0x3fe);                     // k+1
+  movl(rax, 0x00100000);
+  shrl(rax);
+  addl(rax, r10);                       // n = j+(0x00100000>>(k+1))
+  movl(rcx, rax);
+  andl(rcx, 0x7fffffff);
+  shrl(rcx, 20);
+  subl(rcx, 0x3ff);                     // new k for n
+  movl(rdx, 0x000fffff);
+  shrl(rdx);
+  notl(rdx);
+  andl(rdx, rax);
+  shlq(rdx, 32);
+  movdq(xmm3, rdx);                     // t
+  andl(rax, 0x000fffff);
+  orl(rax, 0x00100000);
+  negl(rcx);
+  addl(rcx, 20);
+  shrl(rax);                            // n = ((n&0x000fffff)|0x00100000)>>(20-k)
+  testl(r10, r10);
+  jcc(Assembler::greaterEqual, L_positive_z);
+  negl(rax);
+  bind(L_positive_z);
+  subsd(xmm0, xmm3);                    // p_h -= t
+  bind(L_round_done);
+
+  movapd(xmm3, xmm2);
+  addsd(xmm3, xmm0);
+  fdlibm_clear_low(xmm3, rdx);          // t = p_l+p_h
+  movapd(xmm4, xmm3);
+  mulsd(xmm4, FDLIBM_CONST(lg2_h));     // u = t*lg2_h
+  movapd(xmm5, xmm3);
+  subsd(xmm5, xmm0);
+  subsd(xmm2, xmm5);
+  mulsd(xmm2, FDLIBM_CONST(lg2));
+  mulsd(xmm3, FDLIBM_CONST(lg2_l));
+  addsd(xmm2, xmm3);                    // v = (p_l-(t-p_h))*lg2+t*lg2_l
+  movapd(xmm0, xmm4);
+  addsd(xmm0, xmm2);                    // z = u+v
+  movapd(xmm1, xmm0);
+  subsd(xmm1, xmm4);
+  subsd(xmm2, xmm1);                    // w = v-(z-u)
+  movapd(xmm3, xmm0);
+  mulsd(xmm3, xmm0);                    // t = z*z
+  movapd(xmm4, xmm3);
+  mulsd(xmm4, FDLIBM_CONST(P5));
+  addsd(xmm4, FDLIBM_CONST(P4));
+  mulsd(xmm4, xmm3);
+  addsd(xmm4, FDLIBM_CONST(P3));
+  mulsd(xmm4, xmm3);
+  addsd(xmm4, FDLIBM_CONST(P2));
+  mulsd(xmm4, xmm3);
+  addsd(xmm4, FDLIBM_CONST(P1));
+  mulsd(xmm4, xmm3);
+  movapd(xmm1, xmm0);
+  subsd(xmm1, xmm4);                    // t1 = z - t*(P1+t*(P2+t*(P3+t*(P4+t*P5))))
+  movapd(xmm3, xmm0);
+  mulsd(xmm3, xmm1);
+  subsd(xmm1, FDLIBM_CONST(two));
+  divsd(xmm3, xmm1);
+  movapd(xmm4, xmm0);
+  mulsd(xmm4, xmm2);
+  addsd(xmm2, xmm4);
+  subsd(xmm3, xmm2);                    // r = (z*t1)/(t1-two)-(w+z*w)
+  subsd(xmm3, xmm0);
+  movsd(xmm0, FDLIBM_CONST(one));
+  subsd(xmm0, xmm3);                    // z = one-(r-z)
+
+  movdq(rdx, xmm0);
+  movq(rcx, rdx);
+  shrq(rcx, 32);
+  movl(r10, rax);
+  shll(r10, 20);
+  addl(rcx, r10);
+  sarl(rcx, 20);
+  testl(rcx, rcx);                      // subnormal output
+  jcc(Assembler::lessEqual, L_slow);
+  movslq(rax, rax);
+  shlq(rax, 52);
+  addq(rdx, rax);                       // add n to z's exponent
+  movdq(xmm0, rdx);
+  ret(0);
+
+  bind(L_one);
+  movsd(xmm0, FDLIBM_CONST(one));
+  ret(0);
+
+  bind(L_slow);
+  movdq(xmm0, r9);
+  movdq(xmm1, r11);
+  jump(RuntimeAddress(CAST_FROM_FN_PTR(address, SharedRuntime::dpow)));
+}
+
+// __ieee754_rem_pio2 for pi/4 < |x| <= 2**19*(pi/2).
+// In: xmm0 = x, r9 = bits of x, rcx = ix.  Out: rax = n, xmm0 = y[0], xmm1 = y[1].
+void MacroAssembler::fdlibm_rem_pio2(Label& L_slow) {
+  Label L_medium, L_negative, L_near_pio2, L_near_pio2_neg, L_check, L_y1, L_done;
+
+  cmpl(rcx, 0x4002d97c);
+  jcc(Assembler::greaterEqual, L_medium);
+  // |x| < 3pi/4, n = +-1
+  movl(rax, 1);
+  testq(r9, r9);
+  jcc(Assembler::less, L_negative);
+  movapd(xmm2, xmm0);
+  subsd(xmm2, FDLIBM_CONST(pio2_1));    // z = x - pio2_1
+  cmpl(rcx, 0x3ff921fb);
+  jcc(Assembler::equal, L_near_pio2);
+  movapd(xmm0, xmm2);
+  subsd(xmm0, FDLIBM_CONST(pio2_1t));
+  movapd(xmm1, xmm2);
+  subsd(xmm1, xmm0);
+  subsd(xmm1, FDLIBM_CONST(pio2_1t));
+  jmp(L_done);
+  bind(L_near_pio2);
+  subsd(xmm2, FDLIBM_CONST(pio2_2));
+  movapd(xmm0, xmm2);
+  subsd(xmm0, FDLIBM_CONST(pio2_2t));
+  movapd(xmm1, xmm2);
+  subsd(xmm1, xmm0);
+  subsd(xmm1, FDLIBM_CONST(pio2_2t));
+  jmp(L_done);
+
+  bind(L_negative);
+  movl(rax, -1);
+  movapd(xmm2, xmm0);
+  addsd(xmm2, FDLIBM_CONST(pio2_1));    // z = x + pio2_1
+  cmpl(rcx, 0x3ff921fb);
+  jcc(Assembler::equal, L_near_pio2_neg);
+  movapd(xmm0, xmm2);
+  addsd(xmm0, FDLIBM_CONST(pio2_1t));
+  movapd(xmm1, xmm2);
+  subsd(xmm1, xmm0);
+  addsd(xmm1, FDLIBM_CONST(pio2_1t));
+  jmp(L_done);
+  bind(L_near_pio2_neg);
+  addsd(xmm2, FDLIBM_CONST(pio2_2));
+  movapd(xmm0, xmm2);
+  addsd(xmm0, FDLIBM_CONST(pio2_2t));
+  movapd(xmm1, xmm2);
+  subsd(xmm1, xmm0);
+  addsd(xmm1, FDLIBM_CONST(pio2_2t));
+  jmp(L_done);
+
+  bind(L_medium);
+  cmpl(rcx, 0x413921fb);                // large arguments need __kernel_rem_pio2
+  jcc(Assembler::greater, L_slow);
+  movq(rax, r9);
+  shlq(rax, 1);
+  shrq(rax, 1);
+  movdq(xmm2, rax);                     // t = fabs(x)
+  movsd(xmm3, FDLIBM_CONST(invpio2));
+  mulsd(xmm3, xmm2);
+  addsd(xmm3, FDLIBM_CONST(half));
+  cvttsd2sil(rax, xmm3);                // n = (int)(t*invpio2+half)
+  cvtsi2sdl(xmm3, rax);                 // fn
+  movsd(xmm4, FDLIBM_CONST(pio2_1));
+  mulsd(xmm4, xmm3);
+  subsd(xmm2, xmm4);                    // r = t-fn*pio2_1
+  movsd(xmm4, FDLIBM_CONST(pio2_1t));
+  mulsd(xmm4, xmm3);                    // w = fn*pio2_1t
+  movapd(xmm0, xmm2);
+  subsd(xmm0, xmm4);                    // y[0] = r-w
+  cmpl(rax, 32);
+  jcc(Assembler::greaterEqual, L_check);
+  cmpl(rcx, Address(r8, rax, Address::times_4, (int)offset_of(FdlibmConstants, npio2_hw) - 4));
+  jcc(Assembler::notEqual, L_y1);       // quick check no cancellation
+
+  bind(L_check);
+  movl(r11, rcx);
+  shrl(r11, 20);                        // j
+  movdq(rdx, xmm0);
+  shrq(rdx, 52);
+  andl(rdx, 0x7ff);
+  movl(r10, r11);
+  subl(r10, rdx);
+  cmpl(r10, 16);
+  jcc(Assembler::lessEqual, L_y1);
+  // 2nd iteration, good to 118 bits
+  movapd(xmm5, xmm2);                   // t = r
+  movsd(xmm4, FDLIBM_CONST(pio2_2));
+  mulsd(xmm4, xmm3);                    // w = fn*pio2_2
+  movapd(xmm2, xmm5);
+  subsd(xmm2, xmm4);                    // r = t-w
+  movapd(xmm1, xmm5);
+  subsd(xmm1, xmm2);
+  subsd(xmm1, xmm4);
+  movsd(xmm4, FDLIBM_CONST(pio2_2t));
+  mulsd(xmm4, xmm3);
+  subsd(xmm4, xmm1);                    // w = fn*pio2_2t-((t-r)-w)
+  movapd(xmm0, xmm2);
+  subsd(xmm0, xmm4);                    // y[0] = r-w
+  movdq(rdx, xmm0);
+  shrq(rdx, 52);
+  andl(rdx, 0x7ff);
+  movl(r10, r11);
+  subl(r10, rdx);
+  cmpl(r10, 49);
+  jcc(Assembler::lessEqual, L_y1);
+  // 3rd iteration, 151 bits
+  movapd(xmm5, xmm2);
+  movsd(xmm4, FDLIBM_CONST(pio2_3));
+  mulsd(xmm4, xmm3);
+  movapd(xmm2, xmm5);
+  subsd(xmm2, xmm4);
+  movapd(xmm1, xmm5);
+  subsd(xmm1, xmm2);
+  subsd(xmm1, xmm4);
+  movsd(xmm4, FDLIBM_CONST(pio2_3t));
+  mulsd(xmm4, xmm3);
+  subsd(xmm4, xmm1);
+  movapd(xmm0, xmm2);
+  subsd(xmm0, xmm4);
+
+  bind(L_y1);
+  movapd(xmm1, xmm2);
+  subsd(xmm1, xmm0);
+  subsd(xmm1, xmm4);                    // y[1] = (r-y[0])-w
+  testq(r9, r9);
+  jcc(Assembler::greaterEqual, L_done);
+  fdlibm_negate(xmm0);
+  fdlibm_negate(xmm1);
+  negl(rax);
+
+  bind(L_done);
+}
+
+// __kernel_sin(x, y, iy) with x in xmm0 and y in xmm1; destroys rax, xmm2 - xmm5.
+void MacroAssembler::fdlibm_kernel_sin(bool iy) {
+  Label L_done;
+
+  movdq(rax, xmm0);
+  shrq(rax, 32);
+  andl(rax, 0x7fffffff);
+  cmpl(rax, 0x3e400000);                // |x| < 2**-27
+  jcc(Assembler::less, L_done);
+  movapd(xmm2, xmm0);
+  mulsd(xmm2, xmm0);                    // z = x*x
+  movapd(xmm3, xmm2);
+  mulsd(xmm3, xmm0);                    // v = z*x
+  movapd(xmm4, xmm2);
+  mulsd(xmm4, FDLIBM_CONST(S6));
+  addsd(xmm4, FDLIBM_CONST(S5));
+  mulsd(xmm4, xmm2);
+  addsd(xmm4, FDLIBM_CONST(S4));
+  mulsd(xmm4, xmm2);
+  addsd(xmm4, FDLIBM_CONST(S3));
+  mulsd(xmm4, xmm2);
+  addsd(xmm4, FDLIBM_CONST(S2));        // r = S2+z*(S3+z*(S4+z*(S5+z*S6)))
+  if (!iy) {
+    mulsd(xmm2, xmm4);
+    addsd(xmm2, FDLIBM_CONST(S1));
+    mulsd(xmm2, xmm3);
+    addsd(xmm0, xmm2);                  // x+v*(S1+z*r)
+  } else {
+    movsd(xmm5, FDLIBM_CONST(half));
+    mulsd(xmm5, xmm1);
+    mulsd(xmm4, xmm3);
+    subsd(xmm5, xmm4);
+    mulsd(xmm5, xmm2);
+    subsd(xmm5, xmm1);
+    mulsd(xmm3, FDLIBM_CONST(S1));
+    subsd(xmm5, xmm3);
+    subsd(xmm0, xmm5);                  // x-((z*(half*y-v*r)-y)-v*S1)
+  }
+  bind(L_done);
+}
+
+// __kernel_cos(x, y) with x in xmm0 and y in xmm1; destroys rax, xmm1 - xmm5.
+void MacroAssembler::fdlibm_kernel_cos() {
+  Label L_one, L_large, L_quarter, L_qx, L_done;
+
+  movdq(rax, xmm0);
+  shrq(rax, 32);
+  andl(rax, 0x7fffffff);
+  cmpl(rax, 0x3e400000);                // |x| < 2**-27
+  jcc(Assembler::less, L_one);
+  movapd(xmm2, xmm0);
+  mulsd(xmm2, xmm0);                    // z = x*x
+  movapd(xmm3, xmm2);
+  mulsd(xmm3, FDLIBM_CONST(C6));
+  addsd(xmm3, FDLIBM_CONST(C5));
+  mulsd(xmm3, xmm2);
+  addsd(xmm3, FDLIBM_CONST(C4));
+  mulsd(xmm3, xmm2);
+  addsd(xmm3, FDLIBM_CONST(C3));
+  mulsd(xmm3, xmm2);
+  addsd(xmm3, FDLIBM_CONST(C2));
+  mulsd(xmm3, xmm2);
+  addsd(xmm3, FDLIBM_CONST(C1));
+  mulsd(xmm3, xmm2);                    // r = z*(C1+z*(C2+z*(C3+z*(C4+z*(C5+z*C6)))))
+  movapd(xmm4, xmm2);
+  mulsd(xmm4, xmm3);
+  movapd(xmm5, xmm0);
+  mulsd(xmm5, xmm1);
+  subsd(xmm4, xmm5);                    // z*r-x*y
+  movsd(xmm1, FDLIBM_CONST(half));
+  mulsd(xmm1, xmm2);                    // 0.5*z
+  cmpl(rax, 0x3FD33333);                // |x| >= 0.3
+  jcc(Assembler::greaterEqual, L_large);
+  subsd(xmm1, xmm4);
+  movsd(xmm0, FDLIBM_CONST(one));
+  subsd(xmm0, xmm1);                    // one-(0.5*z-(z*r-x*y))
+  jmp(L_done);
+
+  bind(L_large);
+  cmpl(rax, 0x3fe90000);
+  jcc(Assembler::lessEqual, L_quarter);
+  movsd(xmm5, FDLIBM_CONST(qx_max));    // qx = 0.28125
+  jmp(L_qx);
+  bind(L_quarter);
+  subl(rax, 0x00200000);
+  shlq(rax, 32);
+  movdq(xmm5, rax);                     // qx = x/4
+  bind(L_qx);
+  subsd(xmm1, xmm5);                    // h = 0.5*z-qx
+  subsd(xmm1, xmm4);
+  movsd(xmm0, FDLIBM_CONST(one));
+  subsd(xmm0, xmm5);                    // a = one-qx
+  subsd(xmm0, xmm1);                    // a-(h-(z*r-x*y))
+  jmp(L_done);
+
+  bind(L_one);
+  movsd(xmm0, FDLIBM_CONST(one));
+  bind(L_done);
+}
+
+// __kernel_tan(x, y, iy) with x in xmm0, y in xmm1 and iy in rdx;
+// destroys rax, rcx, r10, r11, xmm1 - xmm5.
+void MacroAssembler::fdlibm_kernel_tan(Label& L_slow) {
+  Label L_not_tiny, L_small, L_positive, L_not_big, L_minus, L_done;
+
+  movdq(rcx, xmm0);
+  shrq(rcx, 32);                        // hx
+  movl(rax, rcx);
+  andl(rax, 0x7fffffff);                // ix
+  cmpl(rax, 0x3e300000);                // |x| < 2**-28
+  jcc(Assembler::greaterEqual, L_not_tiny);
+  cmpl(rdx, 1);                         // -1/(x+y) is left to the runtime
+  jcc(Assembler::notEqual, L_slow);
+  jmp(L_done);
+
+  bind(L_not_tiny);
+  cmpl(rax, 0x3FE59428);                // |x| >= 0.6744
+  jcc(Assembler::less, L_small);
+  testl(rcx, rcx);
+  jcc(Assembler::greaterEqual, L_positive);
+  fdlibm_negate(xmm0);
+  fdlibm_negate(xmm1);
+  bind(L_positive);
+  movsd(xmm2, FDLIBM_CONST(pio4));
+  subsd(xmm2, xmm0);                    // z = pio4-x
+  movsd(xmm3, FDLIBM_CONST(pio4lo));
+  subsd(xmm3, xmm1);                    // w = pio4lo-y
+  movapd(xmm0, xmm2);
+  addsd(xmm0, xmm3);                    // x = z+w
+  xorpd(xmm1, xmm1);                    // y = 0.0
+
+  bind(L_small);
+  movapd(xmm2, xmm0);
+  mulsd(xmm2, xmm0);                    // z = x*x
+  movapd(xmm3, xmm2);
+  mulsd(xmm3, xmm2);                    // w = z*z
+  movapd(xmm4, xmm3);
+  mulsd(xmm4, FDLIBM_CONST(T[11]));
+  addsd(xmm4, FDLIBM_CONST(T[9]));
+  mulsd(xmm4, xmm3);
+  addsd(xmm4, FDLIBM_CONST(T[7]));
+  mulsd(xmm4, xmm3);
+  addsd(xmm4, FDLIBM_CONST(T[5]));
+  mulsd(xmm4, xmm3);
+  addsd(xmm4, FDLIBM_CONST(T[3]));
+  mulsd(xmm4, xmm3);
+  addsd(xmm4, FDLIBM_CONST(T[1]));      // r = T[1]+w*(T[3]+w*(T[5]+w*(T[7]+w*(T[9]+w*T[11]))))
+  movapd(xmm5, xmm3);
+  mulsd(xmm5, FDLIBM_CONST(T[12]));
+  addsd(xmm5, FDLIBM_CONST(T[10]));
+  mulsd(xmm5, xmm3);
+  addsd(xmm5, FDLIBM_CONST(T[8]));
+  mulsd(xmm5, xmm3);
+  addsd(xmm5, FDLIBM_CONST(T[6]));
+  mulsd(xmm5, xmm3);
+  addsd(xmm5, FDLIBM_CONST(T[4]));
+  mulsd(xmm5, xmm3);
+  addsd(xmm5, FDLIBM_CONST(T[2]));
+  mulsd(xmm5, xmm2);                    // v = z*(T[2]+w*(T[4]+w*(T[6]+w*(T[8]+w*(T[10]+w*T[12])))))
+  movapd(xmm3, xmm2);
+  mulsd(xmm3, xmm0);                    // s = z*x
+  addsd(xmm4, xmm5);
+  mulsd(xmm4, xmm3);
+  addsd(xmm4, xmm1);
+  mulsd(xmm4, xmm2);
+  addsd(xmm4, xmm1);                    // r = y + z*(s*(r+v)+y)
+  movsd(xmm5, FDLIBM_CONST(T[0]));
+  mulsd(xmm5, xmm3);
+  addsd(xmm4, xmm5);                    // r += T[0]*s
+  movapd(xmm3, xmm0);
+  addsd(xmm3, xmm4);                    // w = x+r
+  cmpl(rax, 0x3FE59428);
+  jcc(Assembler::less, L_not_big);
+  cvtsi2sdl(xmm5, rdx);                 // v = iy
+  movapd(xmm1, xmm3);
+  mulsd(xmm1, xmm3);
+  movapd(xmm2, xmm3);
+  addsd(xmm2, xmm5);
+  divsd(xmm1, xmm2);
+  subsd(xmm1, xmm4);
+  movapd(xmm2, xmm0);
+  subsd(xmm2, xmm1);
+  mulsd(xmm2, FDLIBM_CONST(two));
+  subsd(xmm5, xmm2);                    // v-2.0*(x-(w*w/(w+v)-r))
+  sarl(rcx, 30);
+  andl(rcx, 2);
+  movl(rax, 1);
+  subl(rax, rcx);
+  cvtsi2sdl(xmm0, rax);
+  mulsd(xmm0, xmm5);                    // (double)(1-((hx>>30)&2))*(...)
+  jmp(L_done);
+
+  bind(L_not_big);
+  cmpl(rdx, 1);
+  jcc(Assembler::notEqual, L_minus);
+  movapd(xmm0, xmm3);                   // w
+  jmp(L_done);
+
+  bind(L_minus);
+  // compute -1.0/(x+r) accurately
+  movapd(xmm2, xmm3);
+  fdlibm_clear_low(xmm2, r10);          // z = w
+  movapd(xmm5, xmm2);
+  subsd(xmm5, xmm0);
+  subsd(xmm4, xmm5);                    // v = r-(z - x)
+  movsd(xmm1, FDLIBM_CONST(minus_one));
+  divsd(xmm1, xmm3);                    // a = -1.0/w
+  movapd(xmm5, xmm1);
+  fdlibm_clear_low(xmm5, r10);          // t = a
+  mulsd(xmm2, xmm5);
+  addsd(xmm2, FDLIBM_CONST(one));       // s = 1.0+t*z
+  mulsd(xmm4, xmm5);
+  addsd(xmm2, xmm4);
+  mulsd(xmm1, xmm2);
+  addsd(xmm5, xmm1);                    // t+a*(s+t*v)
+  movapd(xmm0, xmm5);
+
+  bind(L_done);
+}
+
+void MacroAssembler::fdlibm_sin() {
+  Label L_slow, L_reduce, L_cos, L_sign, L_done;
+
+  movdq(r9, xmm0);
+  movq(rcx, r9);
+  shrq(rcx, 32);
+  andl(rcx, 0x7fffffff);                // ix
+  fdlibm_load_constants();
+  cmpl(rcx, 0x3fe921fb);                // |x| ~< pi/4
+  jcc(Assembler::greater, L_reduce);
+  fdlibm_kernel_sin(false);
+  ret(0);
+
+  bind(L_reduce);
+  cmpl(rcx, 0x7ff00000);                // inf or NaN
+  jcc(Assembler::greaterEqual, L_slow);
+  fdlibm_rem_pio2(L_slow);
+  movl(rdx, rax);                       // n
+  testl(rdx, 1);
+  jcc(Assembler::notZero, L_cos);
+  fdlibm_kernel_sin(true);
+  jmp(L_sign);
+  bind(L_cos);
+  fdlibm_kernel_cos();
+  bind(L_sign);
+  testl(rdx, 2);
+  jcc(Assembler::zero, L_done);
+  fdlibm_negate(xmm0);
+  bind(L_done);
+  ret(0);
+
+  bind(L_slow);
+  movdq(xmm0, r9);
+  jump(RuntimeAddress(CAST_FROM_FN_PTR(address, SharedRuntime::dsin)));
+}
+
+void MacroAssembler::fdlibm_cos() {
+  Label L_slow, L_reduce, L_sin, L_sign, L_done;
+
+  movdq(r9, xmm0);
+  movq(rcx, r9);
+  shrq(rcx, 32);
+  andl(rcx, 0x7fffffff);                // ix
+  fdlibm_load_constants();
+  cmpl(rcx, 0x3fe921fb);                // |x| ~< pi/4
+  jcc(Assembler::greater, L_reduce);
+  xorpd(xmm1, xmm1);
+  fdlibm_kernel_cos();
+  ret(0);
+
+  bind(L_reduce);
+  cmpl(rcx, 0x7ff00000);                // inf or NaN
+  jcc(Assembler::greaterEqual, L_slow);
+  fdlibm_rem_pio2(L_slow);
+  movl(rdx, rax);                       // n
+  testl(rdx, 1);
+  jcc(Assembler::notZero, L_sin);
+  fdlibm_kernel_cos();
+  jmp(L_sign);
+  bind(L_sin);
+  fdlibm_kernel_sin(true);
+  bind(L_sign);
+  incrementl(rdx);                      // negate for n&3 == 1 or 2
+  testl(rdx, 2);
+  jcc(Assembler::zero, L_done);
+  fdlibm_negate(xmm0);
+  bind(L_done);
+  ret(0);
+
+  bind(L_slow);
+  movdq(xmm0, r9);
+  jump(RuntimeAddress(CAST_FROM_FN_PTR(address, SharedRuntime::dcos)));
+}
+
+void MacroAssembler::fdlibm_tan() {
+  Label L_slow, L_reduce, L_even;
+
+  movdq(r9, xmm0);
+  movq(rcx, r9);
+  shrq(rcx, 32);
+  andl(rcx, 0x7fffffff);                // ix
+  fdlibm_load_constants();
+  cmpl(rcx, 0x3fe921fb);                // |x| ~< pi/4
+  jcc(Assembler::greater, L_reduce);
+  xorpd(xmm1, xmm1);
+  movl(rdx, 1);
+  fdlibm_kernel_tan(L_slow);
+  ret(0);
+
+  bind(L_reduce);
+  cmpl(rcx, 0x7ff00000);                // inf or NaN
+  jcc(Assembler::greaterEqual, L_slow);
+  fdlibm_rem_pio2(L_slow);
+  movl(rdx, 1);                         // iy = 1-((n&1)<<1)
+  testl(rax, 1);
+  jcc(Assembler::zero, L_even);
+  movl(rdx, -1);
+  bind(L_even);
+  fdlibm_kernel_tan(L_slow);
+  ret(0);
+
+  bind(L_slow);
+  movdq(xmm0, r9);
+  jump(RuntimeAddress(CAST_FROM_FN_PTR(address, SharedRuntime::dtan)));
+}
+
+#undef FDLIBM_CONST
+#undef FDLIBM_ENTRY
+
+#endif // _LP64
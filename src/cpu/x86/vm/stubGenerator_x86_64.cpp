@@ -3639,6 +3639,403 @@ class StubGenerator: public StubCodeGenerator {
     return start;
   }
 
+  // Build the next big-endian counter block in xmmdst from the little-endian
+  // 128-bit counter <hi:lo> and increment the counter.
+  void ctr_make_block(XMMRegister xmmdst, Register hi, Register lo, Register tmp) {
+    __ movq(tmp, hi);
+    __ bswapq(tmp);
+    __ movdq(xmmdst, tmp);
+    __ movq(tmp, lo);
+    __ bswapq(tmp);
+    __ pinsrq(xmmdst, tmp, 1);
+    __ addq(lo, 1);
+    __ adcq(hi, 0);
+  }
+
+  // Encrypt the 'nblocks' blocks in xmm_block[0..nblocks-1] in lock step so
+  // that the aesenc latencies overlap. keylen is the length of the expanded
+  // key in ints: 44, 52 or 60 for 10, 12 or 14 rounds.
+  void aes_encrypt_blocks(const XMMRegister* xmm_block, int nblocks, Register key, Register keylen,
+                          XMMRegister xmm_key, XMMRegister xmm_shuf_mask) {
+    Label L_last_round;
+    load_key(xmm_key, key, 0x00, xmm_shuf_mask);
+    for (int b = 0; b < nblocks; b++) {
+      __ pxor(xmm_block[b], xmm_key);
+    }
+    for (int round = 1; round <= 13; round++) {
+      if (round == 10) {
+        __ cmpl(keylen, 44);
+        __ jcc(Assembler::equal, L_last_round);
+      } else if (round == 12) {
+        __ cmpl(keylen, 52);
+        __ jcc(Assembler::equal, L_last_round);
+      }
+      load_key(xmm_key, key, round * 0x10, xmm_shuf_mask);
+      for (int b = 0; b < nblocks; b++) {
+        __ aesenc(xmm_block[b], xmm_key);
+      }
+    }
+    __ BIND(L_last_round);
+    __ movdqu(xmm_key, Address(key, keylen, Address::times_4, -0x10));
+    __ pshufb(xmm_key, xmm_shuf_mask);
+    for (int b = 0; b < nblocks; b++) {
+      __ aesenclast(xmm_block[b], xmm_key);
+    }
+  }
+
+  // AES counter mode encryption (and decryption, which is the same)
+  // of com.sun.crypto.provider.CounterMode.implCrypt().
+  //
+  // Arguments:
+  //
+  // Inputs:
+  //   c_rarg0   - source byte array address
+  //   c_rarg1   - destination byte array address
+  //   c_rarg2   - K (key) in little endian int array
+  //   c_rarg3   - counter vector byte array address
+  //   Linux
+  //     c_rarg4   -          input length
+  //     c_rarg5   -          saved encryptedCounter start
+  //     rbp + 2 * wordSize - address of the used field
+  //   Windows
+  //     rbp + 6 * wordSize - input length
+  //     rbp + 7 * wordSize - saved encryptedCounter start
+  //     rbp + 8 * wordSize - address of the used field
+  //
+  // Output:
+  //   rax       - input length
+  //
+  // First the unused bytes of the saved encrypted counter are consumed, then
+  // four and single blocks are processed, and a final partial block is
+  // encrypted into the saved encrypted counter and partially consumed, exactly
+  // as the Java code does byte by byte.
+  address generate_counterMode_AESCrypt_Parallel() {
+    assert(UseAESCTRIntrinsics, "need AES instructions and SSE4.1 support");
+    __ align(CodeEntryAlignment);
+    StubCodeMark mark(this, "StubRoutines", "counterMode_AESCrypt");
+    address start = __ pc();
+
+    const Register from    = c_rarg0;  // source array address
+    const Register to      = c_rarg1;  // destination array address
+    const Register key     = c_rarg2;  // key array address
+    const Register counter = c_rarg3;  // counter byte array address
+#ifndef _WIN64
+    const Register len_reg       = c_rarg4;
+    const Register saved_encCounter_start = c_rarg5;
+    const Register used_addr     = r10;
+    const Address  used_mem(rbp, 2 * wordSize);
+    const Register used          = r11;
+#else
+    const Address  len_mem(rbp, 6 * wordSize);
+    const Address  saved_encCounter_mem(rbp, 7 * wordSize);
+    const Address  used_mem(rbp, 8 * wordSize);
+    const Register len_reg       = r10;
+    const Register saved_encCounter_start = r11;
+    const Register used_addr     = rdi;
+    const Register used          = rsi;
+#endif
+    const Register pos     = rax;
+    const Register keylen  = rbx;
+    const Register ctr_lo  = r12;
+    const Register ctr_hi  = r13;
+    const Register tmp     = r14;
+
+    const XMMRegister xmm_shuf_mask = xmm0;
+    const XMMRegister xmm_key       = xmm1;   // also holds the input
+    const XMMRegister xmm_block[] = { xmm2, xmm3, xmm4, xmm5 };
+    const int PARALLEL = 4;
+
+    Label L_pre_loop, L_pre_done, L_loop_parallel, L_loop_single, L_tail,
+          L_tail_loop, L_store_counter, L_exit;
+
+    __ enter(); // required for proper stackwalking of RuntimeStub frame
+    __ push(rbx);
+    __ push(r12);
+    __ push(r13);
+    __ push(r14);
+#ifdef _WIN64
+    __ push(rdi);
+    __ push(rsi);
+    __ movl(len_reg, len_mem);
+    __ movptr(saved_encCounter_start, saved_encCounter_mem);
+#else
+    __ movl(len_reg, len_reg);   // clear the upper half of the int length
+#endif
+    __ movptr(used_addr, used_mem);
+    __ movl(used, Address(used_addr, 0));
+    __ xorl(pos, pos);
+
+    // use the rest of the previous encrypted counter first
+    __ BIND(L_pre_loop);
+    __ cmpl(used, AESBlockSize);
+    __ jccb(Assembler::aboveEqual, L_pre_done);
+    __ cmpq(pos, len_reg);
+    __ jcc(Assembler::equal, L_exit);
+    __ movb(tmp, Address(saved_encCounter_start, used, Address::times_1));
+    __ xorb(tmp, Address(from, pos, Address::times_1));
+    __ movb(Address(to, pos, Address::times_1), tmp);
+    __ incrementl(used);
+    __ incrementq(pos);
+    __ jmpb(L_pre_loop);
+    __ BIND(L_pre_done);
+
+    // the counter as a little-endian 128-bit integer <ctr_hi:ctr_lo>
+    __ movq(ctr_hi, Address(counter, 0));
+    __ bswapq(ctr_hi);
+    __ movq(ctr_lo, Address(counter, 8));
+    __ bswapq(ctr_lo);
+    __ movl(keylen, Address(key, arrayOopDesc::length_offset_in_bytes() - arrayOopDesc::base_offset_in_bytes(T_INT)));
+    __ movdqu(xmm_shuf_mask, ExternalAddress(StubRoutines::x86::key_shuffle_mask_addr()));
+
+    __ BIND(L_loop_parallel);
+    __ movq(tmp, len_reg);
+    __ subq(tmp, pos);
+    __ cmpq(tmp, PARALLEL * AESBlockSize);
+    __ jcc(Assembler::less, L_loop_single);
+    for (int b = 0; b < PARALLEL; b++) {
+      ctr_make_block(xmm_block[b], ctr_hi, ctr_lo, tmp);
+    }
+    aes_encrypt_blocks(xmm_block, PARALLEL, key, keylen, xmm_key, xmm_shuf_mask);
+    for (int b = 0; b < PARALLEL; b++) {
+      __ movdqu(xmm_key, Address(from, pos, Address::times_1, b * AESBlockSize));
+      __ pxor(xmm_block[b], xmm_key);
+      __ movdqu(Address(to, pos, Address::times_1, b * AESBlockSize), xmm_block[b]);
+    }
+    __ addq(pos, PARALLEL * AESBlockSize);
+    __ jmp(L_loop_parallel);
+
+    __ BIND(L_loop_single);
+    __ movq(tmp, len_reg);
+    __ subq(tmp, pos);
+    __ cmpq(tmp, AESBlockSize);
+    __ jcc(Assembler::less, L_tail);
+    ctr_make_block(xmm_block[0], ctr_hi, ctr_lo, tmp);
+    aes_encrypt_blocks(xmm_block, 1, key, keylen, xmm_key, xmm_shuf_mask);
+    __ movdqu(xmm_key, Address(from, pos, Address::times_1, 0));
+    __ pxor(xmm_block[0], xmm_key);
+    __ movdqu(Address(to, pos, Address::times_1, 0), xmm_block[0]);
+    __ addq(pos, AESBlockSize);
+    __ jmp(L_loop_single);
+
+    // a partial block: save its encrypted counter for the next call
+    __ BIND(L_tail);
+    __ cmpq(pos, len_reg);
+    __ jcc(Assembler::equal, L_store_counter);
+    ctr_make_block(xmm_block[0], ctr_hi, ctr_lo, tmp);
+    aes_encrypt_blocks(xmm_block, 1, key, keylen, xmm_key, xmm_shuf_mask);
+    __ movdqu(Address(saved_encCounter_start, 0), xmm_block[0]);
+    __ xorl(used, used);
+    __ BIND(L_tail_loop);
+    __ movb(tmp, Address(saved_encCounter_start, used, Address::times_1));
+    __ xorb(tmp, Address(from, pos, Address::times_1));
+    __ movb(Address(to, pos, Address::times_1), tmp);
+    __ incrementl(used);
+    __ incrementq(pos);
+    __ cmpq(pos, len_reg);
+    __ jccb(Assembler::notEqual, L_tail_loop);
+
+    __ BIND(L_store_counter);
+    __ bswapq(ctr_hi);
+    __ movq(Address(counter, 0), ctr_hi);
+    __ bswapq(ctr_lo);
+    __ movq(Address(counter, 8), ctr_lo);
+
+    __ BIND(L_exit);
+    __ movl(Address(used_addr, 0), used);
+    __ movl(rax, len_reg);  // return the length
+#ifdef _WIN64
+    __ pop(rsi);
+    __ pop(rdi);
+#endif
+    __ pop(r14);
+    __ pop(r13);
+    __ pop(r12);
+    __ pop(rbx);
+    __ leave(); // required for proper stackwalking of RuntimeStub frame
+    __ ret(0);
+
+    return start;
+  }
+
+  // swap the two longs of the GHASH state
+  address generate_ghash_long_swap_mask() {
+    __ align(CodeEntryAlignment);
+    StubCodeMark mark(this, "StubRoutines", "ghash_long_swap_mask");
+    address start = __ pc();
+    __ emit_data64(0x0f0e0d0c0b0a0908, relocInfo::none);
+    __ emit_data64(0x0706050403020100, relocInfo::none);
+    return start;
+  }
+
+  // reverse the bytes of a 16-byte data block
+  address generate_ghash_byte_swap_mask() {
+    __ align(CodeEntryAlignment);
+    StubCodeMark mark(this, "StubRoutines", "ghash_byte_swap_mask");
+    address start = __ pc();
+    __ emit_data64(0x08090a0b0c0d0e0f, relocInfo::none);
+    __ emit_data64(0x0001020304050607, relocInfo::none);
+    return start;
+  }
+
+  // GHASH of com.sun.crypto.provider.GHASH.processBlocks():
+  //   for each block: state = (state ^ block) * H in GF(2^128)
+  // The carry-less product is computed with four pclmulqdq, shifted left by
+  // one bit because of the reflected bit order, and reduced modulo
+  // x^128 + x^7 + x^2 + x + 1 in two phases.
+  //
+  // Arguments:
+  //
+  // Inputs:
+  //   c_rarg0   - long[] state address
+  //   c_rarg1   - long[] subkeyH address
+  //   c_rarg2   - byte[] data address (at the first block)
+  //   c_rarg3   - number of 16-byte blocks, at least one
+  address generate_ghash_processBlocks() {
+    assert(UseGHASHIntrinsics, "need CLMUL and SSSE3 instructions");
+    __ align(CodeEntryAlignment);
+    StubCodeMark mark(this, "StubRoutines", "ghash_processBlocks");
+    address start = __ pc();
+
+    const Register state   = c_rarg0;
+    const Register subkeyH = c_rarg1;
+    const Register data    = c_rarg2;
+    const Register blocks  = c_rarg3;
+
+    const XMMRegister xmm_temp0  = xmm0;
+    const XMMRegister xmm_temp1  = xmm1;
+    const XMMRegister xmm_temp2  = xmm2;
+    const XMMRegister xmm_temp3  = xmm3;
+    const XMMRegister xmm_temp4  = xmm4;
+    const XMMRegister xmm_temp5  = xmm5;
+    const XMMRegister xmm_temp6  = xmm6;
+    const XMMRegister xmm_temp7  = xmm7;
+    const XMMRegister xmm_temp8  = xmm8;
+    const XMMRegister xmm_temp9  = xmm9;
+    const XMMRegister xmm_long_swap_mask = xmm10;
+    const XMMRegister xmm_byte_swap_mask = xmm11;
+
+    Label L_ghash_loop, L_exit;
+
+    __ enter(); // required for proper stackwalking of RuntimeStub frame
+
+#ifdef _WIN64
+    // save the xmm registers which must be preserved 6-11
+    __ subptr(rsp, -rsp_after_call_off * wordSize);
+    for (int i = 6; i <= 11; i++) {
+      __ movdqu(xmm_save(i), as_XMMRegister(i));
+    }
+#endif
+
+    __ movdqu(xmm_long_swap_mask, ExternalAddress(StubRoutines::x86::ghash_long_swap_mask_addr()));
+    __ movdqu(xmm_byte_swap_mask, ExternalAddress(StubRoutines::x86::ghash_byte_swap_mask_addr()));
+
+    __ movdqu(xmm_temp0, Address(state, 0));
+    __ pshufb(xmm_temp0, xmm_long_swap_mask);
+    __ movdqu(xmm_temp1, Address(subkeyH, 0));
+    __ pshufb(xmm_temp1, xmm_long_swap_mask);
+
+    __ BIND(L_ghash_loop);
+    __ movdqu(xmm_temp2, Address(data, 0));
+    __ pshufb(xmm_temp2, xmm_byte_swap_mask);
+
+    __ pxor(xmm_temp0, xmm_temp2);
+
+    //
+    // Multiply with the hash key
+    //
+    __ movdqu(xmm_temp3, xmm_temp0);
+    __ pclmulqdq(xmm_temp3, xmm_temp1, 0);      // xmm3 holds a0*b0
+    __ movdqu(xmm_temp4, xmm_temp0);
+    __ pclmulqdq(xmm_temp4, xmm_temp1, 16);     // xmm4 holds a0*b1
+
+    __ movdqu(xmm_temp5, xmm_temp0);
+    __ pclmulqdq(xmm_temp5, xmm_temp1, 1);      // xmm5 holds a1*b0
+    __ movdqu(xmm_temp6, xmm_temp0);
+    __ pclmulqdq(xmm_temp6, xmm_temp1, 17);     // xmm6 holds a1*b1
+
+    __ pxor(xmm_temp4, xmm_temp5);              // xmm4 holds a0*b1 + a1*b0
+
+    __ movdqu(xmm_temp5, xmm_temp4);            // move the contents of xmm4 to xmm5
+    __ psrldq(xmm_temp4, 8);                    // shift by xmm4 64 bits to the right
+    __ pslldq(xmm_temp5, 8);                    // shift by xmm5 64 bits to the left
+    __ pxor(xmm_temp3, xmm_temp5);
+    __ pxor(xmm_temp6, xmm_temp4);              // Register pair <xmm6:xmm3> holds the result
+                                                // of the carry-less multiplication of
+                                                // xmm0 by xmm1.
+
+    // We shift the result of the multiplication by one bit position
+    // to the left to cope for the fact that the bits are reversed.
+    __ movdqu(xmm_temp7, xmm_temp3);
+    __ movdqu(xmm_temp8, xmm_temp6);
+    __ pslld(xmm_temp3, 1);
+    __ pslld(xmm_temp6, 1);
+    __ psrld(xmm_temp7, 31);
+    __ psrld(xmm_temp8, 31);
+    __ movdqu(xmm_temp9, xmm_temp7);
+    __ pslldq(xmm_temp8, 4);
+    __ pslldq(xmm_temp7, 4);
+    __ psrldq(xmm_temp9, 12);
+    __ por(xmm_temp3, xmm_temp7);
+    __ por(xmm_temp6, xmm_temp8);
+    __ por(xmm_temp6, xmm_temp9);
+
+    //
+    // First phase of the reduction
+    //
+    // Move xmm3 into xmm7, xmm8, xmm9 in order to perform the shifts
+    // independently.
+    __ movdqu(xmm_temp7, xmm_temp3);
+    __ movdqu(xmm_temp8, xmm_temp3);
+    __ movdqu(xmm_temp9, xmm_temp3);
+    __ pslld(xmm_temp7, 31);                    // packed right shift shifting << 31
+    __ pslld(xmm_temp8, 30);                    // packed right shift shifting << 30
+    __ pslld(xmm_temp9, 25);                    // packed right shift shifting << 25
+    __ pxor(xmm_temp7, xmm_temp8);              // xor the shifted versions
+    __ pxor(xmm_temp7, xmm_temp9);
+    __ movdqu(xmm_temp8, xmm_temp7);
+    __ pslldq(xmm_temp7, 12);
+    __ psrldq(xmm_temp8, 4);
+    __ pxor(xmm_temp3, xmm_temp7);              // first phase of the reduction complete
+
+    //
+    // Second phase of the reduction
+    //
+    // Make 3 copies of xmm3 in xmm2, xmm4, xmm5 for doing these
+    // shift operations.
+    __ movdqu(xmm_temp2, xmm_temp3);
+    __ movdqu(xmm_temp4, xmm_temp3);
+    __ movdqu(xmm_temp5, xmm_temp3);
+    __ psrld(xmm_temp2, 1);                     // packed left shifting >> 1
+    __ psrld(xmm_temp4, 2);                     // packed left shifting >> 2
+    __ psrld(xmm_temp5, 7);                     // packed left shifting >> 7
+    __ pxor(xmm_temp2, xmm_temp4);              // xor the shifted versions
+    __ pxor(xmm_temp2, xmm_temp5);
+    __ pxor(xmm_temp2, xmm_temp8);
+    __ pxor(xmm_temp3, xmm_temp2);
+    __ pxor(xmm_temp6, xmm_temp3);              // the result is in xmm6
+
+    __ decrementl(blocks);
+    __ jcc(Assembler::zero, L_exit);
+    __ movdqu(xmm_temp0, xmm_temp6);
+    __ addptr(data, 16);
+    __ jmp(L_ghash_loop);
+
+    __ BIND(L_exit);
+    __ pshufb(xmm_temp6, xmm_long_swap_mask);   // swap the longs of the result back
+    __ movdqu(Address(state, 0), xmm_temp6);    // store the result
+
+#ifdef _WIN64
+    // restore xmm regs belonging to calling function
+    for (int i = 6; i <= 11; i++) {
+      __ movdqu(as_XMMRegister(i), xmm_save(i));
+    }
+#endif
+    __ leave(); // required for proper stackwalking of RuntimeStub frame
+    __ ret(0);
+
+    return start;
+  }
+
   /**
    *  Arguments:
    *
@@ -3679,6 +4076,274 @@ class StubGenerator: public StubCodeGenerator {
     return start;
   }
 
+  // Shift the CRC32C value 'x' over 'chunk' zero bytes and xor the result into 'dst'.
+  void crc32c_shift_xor(Register dst, Register x, Register table, Register idx) {
+    for (int b = 0; b < 4; b++) {
+      __ movl(idx, x);
+      if (b > 0) {
+        __ shrl(idx, 8 * b);
+      }
+      if (b < 3) {
+        __ andl(idx, 0xFF);
+      }
+      __ xorl(dst, Address(table, idx, Address::times_4, b * 256 * sizeof(juint)));
+    }
+  }
+
+  // Process 3 * chunk bytes at a time as three independent streams so that
+  // the crc32 instructions of the streams overlap, and fold the three values
+  // with the shift tables.
+  void crc32c_proc_chunks(int chunk, Register crc, Register crc_b, Register crc_c,
+                          Register buf, Register len, Register cnt, Register idx) {
+    Label L_outer, L_inner, L_done;
+    __ BIND(L_outer);
+    __ cmpq(len, 3 * chunk);
+    __ jcc(Assembler::below, L_done);
+    __ xorl(crc_b, crc_b);
+    __ xorl(crc_c, crc_c);
+    __ movl(cnt, chunk / 8);
+    __ align(16);
+    __ BIND(L_inner);
+    __ crc32(crc,   Address(buf, 0),         8);
+    __ crc32(crc_b, Address(buf, chunk),     8);
+    __ crc32(crc_c, Address(buf, 2 * chunk), 8);
+    __ addq(buf, 8);
+    __ decrementl(cnt);
+    __ jccb(Assembler::notZero, L_inner);
+
+    __ addq(buf, 2 * chunk);
+    __ subq(len, 3 * chunk);
+    // cnt is zero here and serves as the table register
+    __ lea(cnt, ExternalAddress(StubRoutines::x86::crc32c_shift_table_addr(chunk)));
+    crc32c_shift_xor(crc_b, crc, cnt, idx);     // b ^= shift(a)
+    crc32c_shift_xor(crc_c, crc_b, cnt, idx);   // c ^= shift(b)
+    __ movl(crc, crc_c);
+    __ jmp(L_outer);
+    __ BIND(L_done);
+  }
+
+  /**
+   *  Arguments:
+   *
+   * Inputs:
+   *   c_rarg0   - int crc
+   *   c_rarg1   - byte* buf
+   *   c_rarg2   - int length
+   *
+   * Ouput:
+   *       rax   - int crc result
+   *
+   * The crc is neither inverted on entry nor on exit, this is done by the
+   * Java code of java.util.zip.CRC32C.
+   */
+  address generate_updateBytesCRC32C() {
+    assert(UseCRC32CIntrinsics, "need SSE4.2 crc32 instruction");
+
+    __ align(CodeEntryAlignment);
+    StubCodeMark mark(this, "StubRoutines", "updateBytesCRC32C");
+
+    address start = __ pc();
+    // Only volatile registers on both Win64 and Unix are used.
+    const Register crc   = rax;
+    const Register buf   = r10;
+    const Register len   = r11;
+    const Register crc_b = r8;
+    const Register crc_c = r9;
+    const Register cnt   = rcx;
+    const Register idx   = rdx;
+
+    Label L_tail_8, L_tail_1, L_exit;
+
+    BLOCK_COMMENT("Entry:");
+    __ enter(); // required for proper stackwalking of RuntimeStub frame
+
+    __ movl(crc, c_rarg0);
+    __ mov(buf, c_rarg1);
+    __ movl(len, c_rarg2);
+
+    crc32c_proc_chunks(StubRoutines::x86::crc32c_long_chunk,  crc, crc_b, crc_c, buf, len, cnt, idx);
+    crc32c_proc_chunks(StubRoutines::x86::crc32c_short_chunk, crc, crc_b, crc_c, buf, len, cnt, idx);
+
+    __ BIND(L_tail_8);
+    __ cmpq(len, 8);
+    __ jccb(Assembler::below, L_tail_1);
+    __ crc32(crc, Address(buf, 0), 8);
+    __ addq(buf, 8);
+    __ subq(len, 8);
+    __ jmpb(L_tail_8);
+
+    __ BIND(L_tail_1);
+    __ testq(len, len);
+    __ jccb(Assembler::zero, L_exit);
+    __ crc32(crc, Address(buf, 0), 1);
+    __ incrementq(buf);
+    __ decrementq(len);
+    __ jmpb(L_tail_1);
+
+    __ BIND(L_exit);
+    __ movl(rax, crc);
+    __ leave(); // required for proper stackwalking of RuntimeStub frame
+    __ ret(0);
+
+    return start;
+  }
+
+  /**
+   *  Arguments:
+   *
+   * Inputs:
+   *   c_rarg0   - int adler
+   *   c_rarg1   - byte* buf
+   *   c_rarg2   - int length
+   *
+   * Ouput:
+   *       rax   - int adler result
+   *
+   * Blocks of at most 5552 bytes (zlib's NMAX) are summed without reduction:
+   * for each 16 bytes psadbw adds the bytes to s1, pmaddubsw/pmaddwd add the
+   * bytes weighted 16..1 to s2, and the s1 of the previous 16-byte blocks is
+   * accumulated separately and added to s2 times 16 at the end of the block.
+   */
+  address generate_updateBytesAdler32() {
+    assert(UseAdler32Intrinsics, "need SSSE3 instructions");
+
+    __ align(CodeEntryAlignment);
+    StubCodeMark mark(this, "StubRoutines", "updateBytesAdler32");
+
+    address start = __ pc();
+    const int BASE = 65521;
+    const int NMAX = 5552;
+
+    // Only volatile registers on both Win64 and Unix are used, except xmm6.
+    const Register s1  = r10;
+    const Register buf = r11;
+    const Register len = r9;
+    const Register s2  = r8;
+    const Register cnt = rcx;
+
+    const XMMRegister xzero    = xmm0;
+    const XMMRegister xweights = xmm1;
+    const XMMRegister xones    = xmm2;
+    const XMMRegister xs1      = xmm3;
+    const XMMRegister xps      = xmm4;
+    const XMMRegister xs2      = xmm5;
+    const XMMRegister xdata    = xmm6;
+
+    Label L_block, L_block_size, L_tail, L_tail_loop, L_exit;
+
+    BLOCK_COMMENT("Entry:");
+    __ enter(); // required for proper stackwalking of RuntimeStub frame
+
+    // c_rarg2 is r8 on Win64, so copy the length before s2 is set up
+    __ movl(s1, c_rarg0);
+    __ mov(buf, c_rarg1);
+    __ movl(len, c_rarg2);
+    __ movl(s2, s1);
+    __ shrl(s2, 16);
+    __ andl(s1, 0xFFFF);
+
+#ifdef _WIN64
+    // xmm6 must be preserved
+    __ subptr(rsp, -rsp_after_call_off * wordSize);
+    __ movdqu(xmm_save(6), xdata);
+#endif
+
+    __ pxor(xzero, xzero);
+    __ movdqu(xweights, ExternalAddress(StubRoutines::x86::adler32_constants_addr()));
+    __ movdqu(xones, ExternalAddress(StubRoutines::x86::adler32_constants_addr() + 16));
+
+    __ BIND(L_block);
+    __ cmpl(len, 16);
+    __ jcc(Assembler::below, L_tail);
+    // cnt = min(len & ~15, NMAX)
+    __ movl(cnt, len);
+    __ andl(cnt, ~15);
+    __ cmpl(cnt, NMAX);
+    __ jccb(Assembler::belowEqual, L_block_size);
+    __ movl(cnt, NMAX);
+    __ BIND(L_block_size);
+    __ subl(len, cnt);
+    // s2 += n * s1
+    __ movl(rax, cnt);
+    __ imulq(rax, s1);
+    __ addq(s2, rax);
+    __ shrl(cnt, 4);
+    __ pxor(xs1, xs1);
+    __ pxor(xps, xps);
+    __ pxor(xs2, xs2);
+
+    Label L_inner;
+    __ align(16);
+    __ BIND(L_inner);
+    __ paddd(xps, xs1);
+    __ movdqu(xdata, Address(buf, 0));
+    __ psadbw(xdata, xzero);
+    __ paddd(xs1, xdata);
+    __ movdqu(xdata, Address(buf, 0));
+    __ pmaddubsw(xdata, xweights);
+    __ pmaddwd(xdata, xones);
+    __ paddd(xs2, xdata);
+    __ addq(buf, 16);
+    __ decrementl(cnt);
+    __ jccb(Assembler::notZero, L_inner);
+
+    // s2 += 16 * hsum(xps) + hsum(xs2), s1 += hsum(xs1)
+    hsum_dwords(rax, xps, xdata);
+    __ shlq(rax, 4);
+    __ addq(s2, rax);
+    hsum_dwords(rax, xs2, xdata);
+    __ addq(s2, rax);
+    hsum_dwords(rax, xs1, xdata);
+    __ addq(s1, rax);
+    adler32_mod(s1, cnt, BASE);
+    adler32_mod(s2, cnt, BASE);
+    __ jmp(L_block);
+
+    __ BIND(L_tail);
+    __ testl(len, len);
+    __ jccb(Assembler::zero, L_exit);
+    __ BIND(L_tail_loop);
+    __ movzbl(rax, Address(buf, 0));
+    __ addl(s1, rax);
+    __ addl(s2, s1);
+    __ incrementq(buf);
+    __ decrementl(len);
+    __ jccb(Assembler::notZero, L_tail_loop);
+    adler32_mod(s1, cnt, BASE);
+    adler32_mod(s2, cnt, BASE);
+
+    __ BIND(L_exit);
+#ifdef _WIN64
+    __ movdqu(xdata, xmm_save(6));
+#endif
+    __ movl(rax, s2);
+    __ shll(rax, 16);
+    __ orl(rax, s1);
+    __ leave(); // required for proper stackwalking of RuntimeStub frame
+    __ ret(0);
+
+    return start;
+  }
+
+  // dst = sum of the four dwords of src, clobbers src and tmp
+  void hsum_dwords(Register dst, XMMRegister src, XMMRegister tmp) {
+    __ pshufd(tmp, src, 0x4E);
+    __ paddd(src, tmp);
+    __ pshufd(tmp, src, 0xB1);
+    __ paddd(src, tmp);
+    __ movdl(dst, src);
+  }
+
+  // x = x % base for x < 2^48, clobbers rax, rdx and tmp
+  void adler32_mod(Register x, Register tmp, int base) {
+    __ movq(rdx, x);
+    __ shrq(rdx, 32);
+    __ movl(rax, x);
+    __ movl(tmp, base);
+    __ divl(tmp);
+    __ movl(x, rdx);
+  }
+
 
   /**
    *  Arguments:
@@ -3843,6 +4508,173 @@ class StubGenerator: public StubCodeGenerator {
     return start;
   }
 
+  /**
+   *  Arguments:
+   *
+   *  Input:
+   *    c_rarg0   - a address
+   *    c_rarg1   - b address
+   *    c_rarg2   - length (in elements)
+   *    c_rarg3   - log2 of the element size
+   *
+   *  Output:
+   *        rax   - index of the first mismatching element or -1
+   */
+  address generate_vectorizedMismatch() {
+    __ align(CodeEntryAlignment);
+    StubCodeMark mark(this, "StubRoutines", "vectorizedMismatch");
+
+    address start = __ pc();
+    // Win64: rcx, rdx, r8, r9 (c_rarg0, c_rarg1, ...)
+    // Unix:  rdi, rsi, rdx, rcx, r8, r9 (c_rarg0, c_rarg1, ...)
+    const Register a     = r10;
+    const Register b     = r11;
+    const Register limit = rax;  // length in bytes
+    const Register index = rdx;  // byte index
+    const Register tmp1  = r8;
+    const Register tmp2  = r9;
+
+    Label L_loop_vector, L_loop_8, L_loop_1, L_found_8, L_found, L_equal, L_exit;
+
+    BLOCK_COMMENT("Entry:");
+    __ enter(); // required for proper stackwalking of RuntimeStub frame
+
+    // Read all arguments before their registers are reused.
+    __ movptr(a, c_rarg0);
+    __ movptr(b, c_rarg1);
+    __ movl(limit, c_rarg2);
+    __ movl(rcx, c_rarg3);
+    __ shlq(limit);            // elements to bytes
+    __ xorl(index, index);
+
+    // Compare 32 or 16 bytes at a time. On a mismatch fall into the
+    // 8-byte loop which locates it within the chunk.
+    if (UseAVX >= 2) {
+      __ bind(L_loop_vector);
+      __ movq(tmp1, limit);
+      __ subq(tmp1, 32);
+      __ cmpq(index, tmp1);
+      __ jcc(Assembler::greater, L_loop_8);
+      __ vmovdqu(xmm0, Address(a, index, Address::times_1));
+      __ vpxor(xmm0, xmm0, Address(b, index, Address::times_1), true);
+      __ vptest(xmm0, xmm0);
+      __ jcc(Assembler::notZero, L_loop_8);
+      __ addq(index, 32);
+      __ jmp(L_loop_vector);
+    } else if (UseSSE >= 4) {
+      __ bind(L_loop_vector);
+      __ movq(tmp1, limit);
+      __ subq(tmp1, 16);
+      __ cmpq(index, tmp1);
+      __ jcc(Assembler::greater, L_loop_8);
+      __ movdqu(xmm0, Address(a, index, Address::times_1));
+      __ movdqu(xmm1, Address(b, index, Address::times_1));
+      __ pxor(xmm0, xmm1);
+      __ ptest(xmm0, xmm0);
+      __ jcc(Assembler::notZero, L_loop_8);
+      __ addq(index, 16);
+      __ jmp(L_loop_vector);
+    }
+
+    __ bind(L_loop_8);
+    __ movq(tmp1, limit);
+    __ subq(tmp1, 8);
+    __ cmpq(index, tmp1);
+    __ jcc(Assembler::greater, L_loop_1);
+    __ movq(tmp1, Address(a, index, Address::times_1));
+    __ xorq(tmp1, Address(b, index, Address::times_1));
+    __ jcc(Assembler::notZero, L_found_8);
+    __ addq(index, 8);
+    __ jmp(L_loop_8);
+
+    __ bind(L_found_8);
+    __ bsfq(tmp1, tmp1);       // lowest differing byte (little endian)
+    __ shrq(tmp1, 3);
+    __ addq(index, tmp1);
+    __ jmp(L_found);
+
+    __ bind(L_loop_1);
+    __ cmpq(index, limit);
+    __ jcc(Assembler::greaterEqual, L_equal);
+    __ movzbl(tmp1, Address(a, index, Address::times_1));
+    __ movzbl(tmp2, Address(b, index, Address::times_1));
+    __ cmpl(tmp1, tmp2);
+    __ jcc(Assembler::notEqual, L_found);
+    __ incrementq(index);
+    __ jmp(L_loop_1);
+
+    __ bind(L_found);
+    __ movq(rax, index);
+    __ shrq(rax);              // bytes to elements, rcx still holds the shift
+    __ jmp(L_exit);
+
+    __ bind(L_equal);
+    __ movl(rax, -1);
+
+    __ bind(L_exit);
+    if (UseAVX >= 2) {
+      __ vzeroupper();
+    }
+    __ leave(); // required for proper stackwalking of RuntimeStub frame
+    __ ret(0);
+
+    return start;
+  }
+
+  /**
+   *  Math stubs: the argument(s) and the result are in xmm0 (and xmm1 for
+   *  pow) as for a C call to the SharedRuntime routine, which the stubs
+   *  tail-call for the arguments they do not handle themselves.  They are
+   *  leaf stubs without a frame and only clobber caller-saved registers.
+   */
+  address generate_libmExp() {
+    __ align(CodeEntryAlignment);
+    StubCodeMark mark(this, "StubRoutines", "libmExp");
+    address start = __ pc();
+    __ fdlibm_exp();
+    return start;
+  }
+
+  address generate_libmLog() {
+    __ align(CodeEntryAlignment);
+    StubCodeMark mark(this, "StubRoutines", "libmLog");
+    address start = __ pc();
+    __ fdlibm_log();
+    return start;
+  }
+
+  address generate_libmPow() {
+    __ align(CodeEntryAlignment);
+    StubCodeMark mark(this, "StubRoutines", "libmPow");
+    address start = __ pc();
+    __ fdlibm_pow();
+    return start;
+  }
+
+  address generate_libmSin() {
+    __ align(CodeEntryAlignment);
+    StubCodeMark mark(this, "StubRoutines", "libmSin");
+    address start = __ pc();
+    __ fdlibm_sin();
+    return start;
+  }
+
+  address generate_libmCos() {
+    __ align(CodeEntryAlignment);
+    StubCodeMark mark(this, "StubRoutines", "libmCos");
+    address start = __ pc();
+    __ fdlibm_cos();
+    return start;
+  }
+
+  address generate_libmTan() {
+    __ align(CodeEntryAlignment);
+    StubCodeMark mark(this, "StubRoutines", "libmTan");
+    address start = __ pc();
+    __ fdlibm_tan();
+    return start;
+  }
+
 
 #undef __
 #define __ masm->
@@ -4022,6 +4854,23 @@ class StubGenerator: public StubCodeGenerator {
       StubRoutines::_crc_table_adr = (address)StubRoutines::x86::_crc_table;
       StubRoutines::_updateBytesCRC32 = generate_updateBytesCRC32();
     }
+    if (UseCRC32CIntrinsics) {
+      // set up the tables used to combine the three streams
+      StubRoutines::x86::generate_CRC32C_shift_table();
+      StubRoutines::_updateBytesCRC32C = generate_updateBytesCRC32C();
+    }
+    if (UseAdler32Intrinsics) {
+      StubRoutines::_updateBytesAdler32 = generate_updateBytesAdler32();
+    }
+    // The interpreter's math entries call these, so build them early.
+    if (UseLibmIntrinsic) {
+      StubRoutines::_dexp = generate_libmExp();
+      StubRoutines::_dlog = generate_libmLog();
+      StubRoutines::_dpow = generate_libmPow();
+      StubRoutines::_dsin = generate_libmSin();
+      StubRoutines::_dcos = generate_libmCos();
+      StubRoutines::_dtan = generate_libmTan();
+    }
   }
 
   void generate_all() {
@@ -4076,6 +4925,16 @@ class StubGenerator: public StubCodeGenerator {
       StubRoutines::_cipherBlockChaining_encryptAESCrypt = generate_cipherBlockChaining_encryptAESCrypt();
       StubRoutines::_cipherBlockChaining_decryptAESCrypt = generate_cipherBlockChaining_decryptAESCrypt_Parallel();
     }
+    if (UseAESCTRIntrinsics) {
+      StubRoutines::_counterMode_AESCrypt = generate_counterMode_AESCrypt_Parallel();
+    }
+
+    // Generate GHASH intrinsics code
+    if (UseGHASHIntrinsics) {
+      StubRoutines::x86::_ghash_long_swap_mask_addr = generate_ghash_long_swap_mask();
+      StubRoutines::x86::_ghash_byte_swap_mask_addr = generate_ghash_byte_swap_mask();
+      StubRoutines::_ghash_processBlocks = generate_ghash_processBlocks();
+    }
 
     // Safefetch stubs.
     generate_safefetch("SafeFetch32", sizeof(int),     &StubRoutines::_safefetch32_entry,
@@ -4094,6 +4953,9 @@ class StubGenerator: public StubCodeGenerator {
     if (UseMulAddIntrinsic) {
       StubRoutines::_mulAdd = generate_mulAdd();
     }
+    if (UseVectorizedMismatchIntrinsic) {
+      StubRoutines::_vectorizedMismatch = generate_vectorizedMismatch();
+    }
 
 #ifndef _WINDOWS
     if (UseMontgomeryMultiplyIntrinsic) {
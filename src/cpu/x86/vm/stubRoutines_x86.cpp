@@ -33,6 +33,8 @@
 
 address StubRoutines::x86::_verify_mxcsr_entry = NULL;
 address StubRoutines::x86::_key_shuffle_mask_addr = NULL;
+address StubRoutines::x86::_ghash_long_swap_mask_addr = NULL;
+address StubRoutines::x86::_ghash_byte_swap_mask_addr = NULL;
 
 uint64_t StubRoutines::x86::_crc_by128_masks[] =
 {
@@ -128,3 +130,47 @@ juint StubRoutines::x86::_crc_table[] =
     0x5d681b02UL, 0x2a6f2b94UL, 0xb40bbe37UL, 0xc30c8ea1UL, 0x5a05df1bUL,
     0x2d02ef8dUL
 };
+
+juint StubRoutines::x86::_crc32c_shift_table[2 * StubRoutines::x86::crc32c_shift_table_size];
+
+/**
+ * Adler32: the weights 16..1 of the bytes of a 16-byte block for pmaddubsw,
+ * followed by the word ones for pmaddwd.
+ */
+juint StubRoutines::x86::_adler32_constants[] =
+{
+    0x0d0e0f10UL, 0x090a0b0cUL, 0x05060708UL, 0x01020304UL,
+    0x00010001UL, 0x00010001UL, 0x00010001UL, 0x00010001UL
+};
+
+/**
+ * CRC32C is linear over GF(2): running a value through n zero bytes is a
+ * 32x32 bit matrix multiply. For each chunk size the matrix is stored as four
+ * 256-entry tables, one per byte of the value, so that shifting a value costs
+ * four lookups.
+ */
+void StubRoutines::x86::generate_CRC32C_shift_table() {
+  const int chunks[] = { crc32c_long_chunk, crc32c_short_chunk };
+  for (int k = 0; k < 2; k++) {
+    juint* table = &_crc32c_shift_table[k * crc32c_shift_table_size];
+    juint shifted_bit[32];
+    for (int j = 0; j < 32; j++) {
+      juint v = 1U << j;
+      for (int n = 0; n < chunks[k] * BitsPerByte; n++) {
+        v = (v >> 1) ^ (0x82F63B78U & (0U - (v & 1)));
+      }
+      shifted_bit[j] = v;
+    }
+    for (int b = 0; b < 4; b++) {
+      for (int i = 0; i < 256; i++) {
+        juint v = 0;
+        for (int j = 0; j < 8; j++) {
+          if ((i & (1 << j)) != 0) {
+            v ^= shifted_bit[b * 8 + j];
+          }
+        }
+        table[b * 256 + i] = v;
+      }
+    }
+  }
+}
@@ -33,13 +33,34 @@
   static address _verify_mxcsr_entry;
   // shuffle mask for fixing up 128-bit words consisting of big-endian 32-bit integers
   static address _key_shuffle_mask_addr;
+  // masks for GHASH: swap the two longs of the state, reverse the bytes of a data block
+  static address _ghash_long_swap_mask_addr;
+  static address _ghash_byte_swap_mask_addr;
   // masks and table for CRC32
   static uint64_t _crc_by128_masks[];
   static juint    _crc_table[];
+  // tables shifting a CRC32C value over a chunk of zero bytes, used to
+  // combine the values of the three streams of the CRC32C stub
+  static juint    _crc32c_shift_table[];
+  // byte weights and word ones for the Adler32 stub
+  static juint    _adler32_constants[];
 
  public:
+  enum {
+    crc32c_long_chunk  = 1024,  // bytes per stream and iteration for long inputs
+    crc32c_short_chunk = 128,   // bytes per stream and iteration for the remainder
+    crc32c_shift_table_size = 4 * 256  // one 256-entry table per state byte
+  };
+
   static address verify_mxcsr_entry()    { return _verify_mxcsr_entry; }
   static address key_shuffle_mask_addr() { return _key_shuffle_mask_addr; }
+  static address ghash_long_swap_mask_addr() { return _ghash_long_swap_mask_addr; }
+  static address ghash_byte_swap_mask_addr() { return _ghash_byte_swap_mask_addr; }
   static address crc_by128_masks_addr()  { return (address)_crc_by128_masks; }
+  static address crc32c_shift_table_addr(int chunk) {
+    return (address)&_crc32c_shift_table[(chunk == crc32c_long_chunk ? 0 : 1) * crc32c_shift_table_size];
+  }
+  static address adler32_constants_addr() { return (address)_adler32_constants; }
+  static void    generate_CRC32C_shift_table();
 
 #endif // CPU_X86_VM_STUBROUTINES_X86_32_HPP
@@ -582,6 +582,56 @@ void VM_Version::get_processor_features() {
     FLAG_SET_DEFAULT(UseCRC32Intrinsics, false);
   }
 
+#ifdef _LP64
+  // The CRC32C stub is built around the SSE4.2 crc32 instruction.
+  if (supports_sse4_2()) {
+    if (FLAG_IS_DEFAULT(UseCRC32CIntrinsics)) {
+      UseCRC32CIntrinsics = true;
+    }
+  } else if (UseCRC32CIntrinsics) {
+    if (!FLAG_IS_DEFAULT(UseCRC32CIntrinsics))
+      warning("CRC32C intrinsics require SSE4.2 instructions (not available on this CPU)");
+    FLAG_SET_DEFAULT(UseCRC32CIntrinsics, false);
+  }
+
+  if (supports_ssse3()) {
+    if (FLAG_IS_DEFAULT(UseAdler32Intrinsics)) {
+      UseAdler32Intrinsics = true;
+    }
+  } else if (UseAdler32Intrinsics) {
+    if (!FLAG_IS_DEFAULT(UseAdler32Intrinsics))
+      warning("Adler32 intrinsics require SSSE3 instructions (not available on this CPU)");
+    FLAG_SET_DEFAULT(UseAdler32Intrinsics, false);
+  }
+
+  // The libm stubs only need SSE2 and give the same results as StrictMath.
+  if (UseSSE >= 2) {
+    if (FLAG_IS_DEFAULT(UseLibmIntrinsic)) {
+      UseLibmIntrinsic = true;
+    }
+  } else if (UseLibmIntrinsic) {
+    if (!FLAG_IS_DEFAULT(UseLibmIntrinsic))
+      warning("libm intrinsics require SSE2 instructions");
+    FLAG_SET_DEFAULT(UseLibmIntrinsic, false);
+  }
+#else
+  if (UseCRC32CIntrinsics) {
+    if (!FLAG_IS_DEFAULT(UseCRC32CIntrinsics))
+      warning("CRC32C intrinsics are not available in 32-bit VM");
+    FLAG_SET_DEFAULT(UseCRC32CIntrinsics, false);
+  }
+  if (UseAdler32Intrinsics) {
+    if (!FLAG_IS_DEFAULT(UseAdler32Intrinsics))
+      warning("Adler32 intrinsics are not available in 32-bit VM");
+    FLAG_SET_DEFAULT(UseAdler32Intrinsics, false);
+  }
+  if (UseLibmIntrinsic) {
+    if (!FLAG_IS_DEFAULT(UseLibmIntrinsic))
+      warning("libm intrinsics are not available in 32-bit VM");
+    FLAG_SET_DEFAULT(UseLibmIntrinsic, false);
+  }
+#endif
+
   // The AES intrinsic stubs require AES instruction support (of course)
   // but also require sse3 mode for instructions it use.
   if (UseAES && (UseSSE > 2)) {
@@ -594,6 +644,41 @@ void VM_Version::get_processor_features() {
     FLAG_SET_DEFAULT(UseAESIntrinsics, false);
   }
 
+#ifdef _LP64
+  // The counter mode stub builds the counter blocks with pinsrq (SSE4.1).
+  if (UseAESIntrinsics && supports_sse4_1()) {
+    if (FLAG_IS_DEFAULT(UseAESCTRIntrinsics)) {
+      UseAESCTRIntrinsics = true;
+    }
+  } else if (UseAESCTRIntrinsics) {
+    if (!FLAG_IS_DEFAULT(UseAESCTRIntrinsics))
+      warning("AES-CTR intrinsics require AES intrinsics and SSE4.1 instructions");
+    FLAG_SET_DEFAULT(UseAESCTRIntrinsics, false);
+  }
+
+  // GHASH multiplies with pclmulqdq and byte swaps with pshufb (SSSE3).
+  if (UseCLMUL && supports_ssse3()) {
+    if (FLAG_IS_DEFAULT(UseGHASHIntrinsics)) {
+      UseGHASHIntrinsics = true;
+    }
+  } else if (UseGHASHIntrinsics) {
+    if (!FLAG_IS_DEFAULT(UseGHASHIntrinsics))
+      warning("GHASH intrinsics require CLMUL and SSSE3 instructions (not available on this CPU)");
+    FLAG_SET_DEFAULT(UseGHASHIntrinsics, false);
+  }
+#else
+  if (UseAESCTRIntrinsics) {
+    if (!FLAG_IS_DEFAULT(UseAESCTRIntrinsics))
+      warning("AES-CTR intrinsics are not available in 32-bit VM");
+    FLAG_SET_DEFAULT(UseAESCTRIntrinsics, false);
+  }
+  if (UseGHASHIntrinsics) {
+    if (!FLAG_IS_DEFAULT(UseGHASHIntrinsics))
+      warning("GHASH intrinsics are not available in 32-bit VM");
+    FLAG_SET_DEFAULT(UseGHASHIntrinsics, false);
+  }
+#endif
+
   if (UseSHA) {
     warning("SHA instructions are not available on this CPU");
     FLAG_SET_DEFAULT(UseSHA, false);
@@ -718,6 +803,9 @@ void VM_Version::get_processor_features() {
   if (FLAG_IS_DEFAULT(UseMontgomerySquareIntrinsic)) {
     UseMontgomerySquareIntrinsic = true;
   }
+  if (FLAG_IS_DEFAULT(UseVectorizedMismatchIntrinsic)) {
+    UseVectorizedMismatchIntrinsic = true;
+  }
 #else
   if (UseMultiplyToLenIntrinsic) {
     if (!FLAG_IS_DEFAULT(UseMultiplyToLenIntrinsic)) {
@@ -749,6 +837,12 @@ void VM_Version::get_processor_features() {
     }
     FLAG_SET_DEFAULT(UseMontgomerySquareIntrinsic, false);
   }
+  if (UseVectorizedMismatchIntrinsic) {
+    if (!FLAG_IS_DEFAULT(UseVectorizedMismatchIntrinsic)) {
+      warning("vectorizedMismatch intrinsic is not available in 32-bit VM");
+    }
+    FLAG_SET_DEFAULT(UseVectorizedMismatchIntrinsic, false);
+  }
 #endif
 #endif // COMPILER2
 
@@ -160,15 +160,54 @@ VtableStub* VtableStubs::create_itable_stub(int itable_index) {
   const Register resolved_klass_reg = rbx; // resolved interface klass (REFC)
   const Register temp_reg           = r11;
 
-  Label L_no_such_interface;
+  Label L_no_such_interface, L_call;
 
   const Register icholder_reg = rax;
+  assert(VtableStub::receiver_location() == j_rarg0->as_VMReg(), "receiver expected in j_rarg0");
+
+  // With compressed class pointers the CompiledICHolder of the call site
+  // caches recent receiver classes, each together with the offset of its
+  // method entry in one word.  r13 holds on to the CompiledICHolder during
+  // the itable scan; it is not used to pass arguments to compiled code.
+  const bool use_cache = UseItableStubCache && UseCompressedClassPointers;
+  const Register cache_icholder_reg = r13;
+  address npe_addr;
+  if (use_cache) {
+    Label L_hit, L_miss;
+    // get receiver narrow klass (also an implicit null-check)
+    npe_addr = __ pc();
+    __ movl(temp_reg, Address(j_rarg0, oopDesc::klass_offset_in_bytes()));
+    for (int i = 0; i < ItableStubCacheSize; i++) {
+      __ movq(rbx, Address(icholder_reg, CompiledICHolder::itable_cache_offset() + i * BytesPerLong));
+      __ cmpl(rbx, temp_reg);
+      if (i < ItableStubCacheSize - 1) {
+        __ jcc(Assembler::equal, L_hit);
+      } else {
+        __ jcc(Assembler::notEqual, L_miss);
+      }
+    }
+    __ bind(L_hit);
+#ifndef PRODUCT
+    if (CountCompiledCalls) {
+      __ incrementl(ExternalAddress((address) SharedRuntime::nof_itable_stub_cache_hits_addr()));
+    }
+#endif
+    __ shrq(rbx, 32);
+    __ decode_klass_not_null(temp_reg);
+    __ movptr(rbx, Address(temp_reg, rbx, Address::times_1));
+    __ jmp(L_call);
+
+    __ bind(L_miss);
+    __ movptr(cache_icholder_reg, icholder_reg);
+  }
+
   __ movptr(resolved_klass_reg, Address(icholder_reg, CompiledICHolder::holder_klass_offset()));
   __ movptr(holder_klass_reg,   Address(icholder_reg, CompiledICHolder::holder_metadata_offset()));
 
   // get receiver klass (also an implicit null-check)
-  assert(VtableStub::receiver_location() == j_rarg0->as_VMReg(), "receiver expected in j_rarg0");
-  address npe_addr = __ pc();
+  if (!use_cache) {
+    npe_addr = __ pc();
+  }
   __ load_klass(recv_klass_reg, j_rarg0);
 
   // Receiver subtype check against REFC.
@@ -189,6 +228,25 @@ VtableStub* VtableStubs::create_itable_stub(int itable_index) {
                        method, temp_reg,
                        L_no_such_interface);
 
+  if (use_cache) {
+    // Fill the cache entries round robin.  Sites that keep missing are
+    // megamorphic beyond the cache size and stop writing to it.
+    const Register index_reg = recv_klass_reg;
+    __ movl(index_reg, Address(cache_icholder_reg, CompiledICHolder::itable_misses_offset()));
+    __ cmpl(index_reg, ItableStubCacheMissLimit);
+    __ jcc(Assembler::aboveEqual, L_call);
+    __ incrementl(Address(cache_icholder_reg, CompiledICHolder::itable_misses_offset()));
+    __ andl(index_reg, ItableStubCacheSize - 1);
+    // temp_reg: offset of the itable method block from the klass
+    __ lea(temp_reg, Address(temp_reg, itable_index * wordSize + itableMethodEntry::method_offset_in_bytes()));
+    __ shlq(temp_reg, 32);
+    __ movl(holder_klass_reg, Address(j_rarg0, oopDesc::klass_offset_in_bytes()));
+    __ orq(temp_reg, holder_klass_reg);
+    __ movq(Address(cache_icholder_reg, index_reg, Address::times_8, CompiledICHolder::itable_cache_offset()), temp_reg);
+  }
+
+  __ bind(L_call);
+
   // If we take a trap while this arg is on the stack we will not
   // be able to walk the stack properly. This is not an issue except
   // when there are mistakes in this assembly code that could generate
@@ -242,7 +300,10 @@ int VtableStub::pd_code_size_limit(bool is_vtable_stub) {
   } else {
     // Itable stub size
     return (DebugVtables ? 512 : 140) + (CountCompiledCalls ? 13 : 0) +
-           (UseCompressedClassPointers ? 2 * MacroAssembler::instr_size_for_decode_klass_not_null() : 0);
+           (UseCompressedClassPointers ? 2 * MacroAssembler::instr_size_for_decode_klass_not_null() : 0) +
+           ((UseItableStubCache && UseCompressedClassPointers) ?
+            96 + 16 * ItableStubCacheSize + (CountCompiledCalls ? 13 : 0) +
+            MacroAssembler::instr_size_for_decode_klass_not_null() : 0);
   }
   // In order to tune these parameters, run the JVM with VM options
   // +PrintMiscellaneous and +WizardMode to see information about
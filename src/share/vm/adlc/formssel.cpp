@@ -4139,6 +4139,10 @@ bool MatchRule::is_vector() const {
     "MulVS","MulVI","MulVF","MulVD",
     "DivVF","DivVD",
     "AndV" ,"XorV" ,"OrV",
+    "AddReductionVI","AddReductionVL","AddReductionVF","AddReductionVD",
+    "MulReductionVI","MulReductionVF","MulReductionVD",
+    "AndReductionVI","AndReductionVL","OrReductionVI","OrReductionVL",
+    "XorReductionVI","XorReductionVL",
     "LShiftCntV","RShiftCntV",
     "LShiftVB","LShiftVS","LShiftVI","LShiftVL",
     "RShiftVB","RShiftVS","RShiftVI","RShiftVL",
@@ -115,6 +115,37 @@ public:
 
 };
 
+// Out of line part of a sampled branch profile update: adds the weight
+// of one sample to the MDO cell and picks the next sampling interval
+// for the current thread (see C1ProfileBranchSampleLog).
+class ProfileBranchSampleStub: public CodeStub {
+ private:
+  LIR_Opr _md;        // the MDO
+  LIR_Opr _offset;    // byte offset of the counter cell, register or constant
+  LIR_Opr _thread;
+  LIR_Opr _tmp;
+
+ public:
+  ProfileBranchSampleStub(LIR_Opr md, LIR_Opr offset, LIR_Opr thread, LIR_Opr tmp) :
+    _md(md), _offset(offset), _thread(thread), _tmp(tmp) {
+  }
+
+  virtual void emit_code(LIR_Assembler* e);
+
+  virtual void visit(LIR_OpVisitState* visitor) {
+    visitor->do_input(_md);
+    if (_offset->is_register()) {
+      visitor->do_input(_offset);
+    }
+    visitor->do_input(_thread);
+    visitor->do_temp(_tmp);
+  }
+
+#ifndef PRODUCT
+  virtual void print_name(outputStream* out) const { out->print("ProfileBranchSampleStub"); }
+#endif // PRODUCT
+};
+
 class ConversionStub: public CodeStub {
  private:
   Bytecodes::Code _bytecode;
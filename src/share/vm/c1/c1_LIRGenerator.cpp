@@ -934,7 +934,7 @@ LIR_Opr LIRGenerator::force_to_spill(LIR_Opr value, BasicType t) {
   return tmp;
 }
 
-void LIRGenerator::profile_branch(If* if_instr, If::Condition cond) {
+void LIRGenerator::profile_branch(If* if_instr, If::Condition cond, LIR_Opr left, LIR_Opr right) {
   if (if_instr->should_profile()) {
     ciMethod* method = if_instr->profiled_method();
     assert(method != NULL, "method should be set if branch is profiled");
@@ -960,6 +960,13 @@ void LIRGenerator::profile_branch(If* if_instr, If::Condition cond) {
              LIR_OprFact::intptrConst(not_taken_count_offset),
              data_offset_reg, as_BasicType(if_instr->x()->type()));
 
+    if (C1ProfileBranchSampleLog > 0 && left->is_valid()) {
+      sample_profile_counter(md_reg, data_offset_reg);
+      // the sampling code kills the condition codes
+      __ cmp(lir_cond(cond), left, right);
+      return;
+    }
+
     // MDO cells are intptr_t, so the data_reg width is arch-dependent.
     LIR_Opr data_reg = new_pointer_register();
     LIR_Address* data_addr = new LIR_Address(md_reg, data_offset_reg, data_reg->type());
@@ -971,6 +978,24 @@ void LIRGenerator::profile_branch(If* if_instr, If::Condition cond) {
   }
 }
 
+// Sampled update of a branch counter at md_reg + offset: a per-thread
+// countdown selects about one execution in 2^C1ProfileBranchSampleLog, and
+// the out of line stub adds the weight of the whole interval to the MDO.
+// Hot branches then mostly touch thread-local memory instead of the shared
+// MDO.  Kills the condition codes.
+void LIRGenerator::sample_profile_counter(LIR_Opr md_reg, LIR_Opr offset) {
+  LIR_Opr thread = getThreadPointer();
+  LIR_Address* countdown_addr = new LIR_Address(thread, in_bytes(JavaThread::profile_sample_countdown_offset()), T_INT);
+  LIR_Opr countdown = new_register(T_INT);
+  __ load(countdown_addr, countdown);
+  __ sub(countdown, LIR_OprFact::intConst(1), countdown);
+  __ store(countdown, countdown_addr);
+  __ cmp(lir_cond_lessEqual, countdown, LIR_OprFact::intConst(0));
+  CodeStub* sample = new ProfileBranchSampleStub(md_reg, offset, thread, new_register(T_INT));
+  __ branch(lir_cond_lessEqual, T_INT, sample);
+  __ branch_destination(sample->continuation());
+}
+
 // Phi technique:
 // This is about passing live values from one basic block to the other.
 // In code generated with Java it is rather rare that more than one
@@ -2602,8 +2627,12 @@ void LIRGenerator::do_Goto(Goto* x) {
     LIR_Opr md_reg = new_register(T_METADATA);
     __ metadata2reg(md->constant_encoding(), md_reg);
 
-    increment_counter(new LIR_Address(md_reg, offset,
-                                      NOT_LP64(T_INT) LP64_ONLY(T_LONG)), DataLayout::counter_increment);
+    if (C1ProfileBranchSampleLog > 0) {
+      sample_profile_counter(md_reg, LIR_OprFact::intConst(offset));
+    } else {
+      increment_counter(new LIR_Address(md_reg, offset,
+                                        NOT_LP64(T_INT) LP64_ONLY(T_LONG)), DataLayout::counter_increment);
+    }
   }
 
   // emit phi-instruction move after safepoint since this simplifies
@@ -3180,6 +3209,13 @@ void LIRGenerator::do_Intrinsic(Intrinsic* x) {
     do_update_CRC32(x);
     break;
 
+  case vmIntrinsics::_updateBytesCRC32C:
+  case vmIntrinsics::_updateDirectByteBufferCRC32C:
+  case vmIntrinsics::_updateBytesAdler32:
+  case vmIntrinsics::_updateByteBufferAdler32:
+    do_update_checksum_bytes(x);
+    break;
+
   default: ShouldNotReachHere(); break;
   }
 }
@@ -57,6 +57,7 @@
 #include "runtime/vframeArray.hpp"
 #include "utilities/copy.hpp"
 #include "utilities/events.hpp"
+#include "utilities/log.hpp"
 
 
 // Implementation of StubAssembler
@@ -300,6 +301,8 @@ const char* Runtime1::name_for_address(address entry) {
   FUNCTION_CASE(entry, TRACE_TIME_METHOD);
 #endif
   FUNCTION_CASE(entry, StubRoutines::updateBytesCRC32());
+  FUNCTION_CASE(entry, StubRoutines::updateBytesCRC32C());
+  FUNCTION_CASE(entry, StubRoutines::updateBytesAdler32());
 
 #undef FUNCTION_CASE
 
@@ -434,6 +437,28 @@ JRT_BLOCK_ENTRY(address, Runtime1::counter_overflow(JavaThread* thread, int bci,
     if (osr_nm != NULL) {
       RegisterMap map(thread, false);
       frame fr =  thread->last_frame().sender(&map);
+      if (C1EagerOSRMigration) {
+        // The interpreter frame resumes at the branch. Make its next backedge
+        // notify the policy so that it migrates into the OSR version right away
+        // instead of after another Tier0BackedgeNotifyFreqLog backedges.
+        Method* osr_method = osr_nm->method();
+        MethodData* mdo = osr_method->method_data();
+        if (mdo != NULL) {
+          mdo->backedge_counter()->set_notify_on_next(Tier0BackedgeNotifyFreqLog);
+        }
+        MethodCounters* mcs = osr_method->method_counters();
+        if (mcs != NULL) {
+          mcs->backedge_counter()->set_notify_on_next(Tier0BackedgeNotifyFreqLog);
+        }
+        if (Log::is_enabled(LogTag::compilation, LogLevel::debug)) {
+          ResourceMark rm(thread);
+          nmethod* nm = fr.cb()->as_nmethod_or_null();
+          Log::print(LogTag::compilation, LogLevel::debug,
+                     "%s migrates from level %d code into the level %d OSR code at bci %d",
+                     osr_method->name_and_sig_as_C_string(), nm != NULL ? nm->comp_level() : -1,
+                     osr_nm->comp_level(), osr_nm->osr_entry_bci());
+        }
+      }
       Deoptimization::deoptimize_frame(thread, fr.id());
     }
   JRT_BLOCK_END
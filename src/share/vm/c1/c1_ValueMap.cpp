@@ -181,9 +181,11 @@ Value ValueMap::find_insert(Value x) {
 #define MUST_KILL_MEMORY(must_kill, entry, value)                                        \
   bool must_kill = value->as_LoadField() != NULL || value->as_LoadIndexed() != NULL;
 
+// the verifier ensures that arrays loaded and stored with different
+// element types never alias
 #define MUST_KILL_ARRAY(must_kill, entry, value)                                         \
-  bool must_kill = value->as_LoadIndexed() != NULL                                       \
-                   && value->type()->tag() == type->tag();
+  LoadIndexed* li = value->as_LoadIndexed();                                             \
+  bool must_kill = li != NULL && li->elt_type() == elt_type;
 
 #define MUST_KILL_FIELD(must_kill, entry, value)                                         \
   /* ciField's are not unique; must compare their contents */                            \
@@ -197,7 +199,7 @@ void ValueMap::kill_memory() {
   GENERIC_KILL_VALUE(MUST_KILL_MEMORY);
 }
 
-void ValueMap::kill_array(ValueType* type) {
+void ValueMap::kill_array(BasicType elt_type) {
   GENERIC_KILL_VALUE(MUST_KILL_ARRAY);
 }
 
@@ -265,8 +267,9 @@ class ShortLoopOptimizer : public ValueNumberingVisitor {
   GlobalValueNumbering* _gvn;
   BlockList             _loop_blocks;
   bool                  _too_complicated_loop;
-  bool                  _has_field_store[T_ARRAY + 1];
+  bool                  _has_field_store[T_ARRAY + 1];   // stores to unresolved fields, by type
   bool                  _has_indexed_store[T_ARRAY + 1];
+  GrowableArray<ciField*> _field_stores;                 // resolved fields stored to in the loop
 
   // simplified access to methods of GlobalValueNumbering
   ValueMap* current_map()                        { return _gvn->current_map(); }
@@ -277,12 +280,17 @@ class ShortLoopOptimizer : public ValueNumberingVisitor {
   void      kill_field(ciField* field, bool all_offsets)  {
     current_map()->kill_field(field, all_offsets);
     assert(field->type()->basic_type() >= 0 && field->type()->basic_type() <= T_ARRAY, "Invalid type");
-    _has_field_store[field->type()->basic_type()] = true;
+    if (all_offsets) {
+      // the offset is not known yet, so any field of this type may be stored to
+      _has_field_store[field->type()->basic_type()] = true;
+    } else {
+      _field_stores.append(field);
+    }
   }
-  void      kill_array(ValueType* type)                   {
-    current_map()->kill_array(type);
-    BasicType basic_type = as_BasicType(type); assert(basic_type >= 0 && basic_type <= T_ARRAY, "Invalid type");
-    _has_indexed_store[basic_type] = true;
+  void      kill_array(BasicType elt_type)                {
+    current_map()->kill_array(elt_type);
+    assert(elt_type >= 0 && elt_type <= T_ARRAY, "Invalid type");
+    _has_indexed_store[elt_type] = true;
   }
 
  public:
@@ -290,6 +298,7 @@ class ShortLoopOptimizer : public ValueNumberingVisitor {
     : _gvn(gvn)
     , _loop_blocks(ValueMapMaxLoopSize)
     , _too_complicated_loop(false)
+    , _field_stores(4)
   {
     for (int i=0; i<= T_ARRAY; i++){
       _has_field_store[i] = false;
@@ -297,9 +306,21 @@ class ShortLoopOptimizer : public ValueNumberingVisitor {
     }
   }
 
-  bool has_field_store(BasicType type) {
+  // a store in the loop may write the field: field identity is the holder
+  // and offset, ciFields are not unique
+  bool has_field_store(ciField* field) {
+    BasicType type = field->type()->basic_type();
     assert(type >= 0 && type <= T_ARRAY, "Invalid type");
-    return _has_field_store[type];
+    if (_has_field_store[type]) {
+      return true;
+    }
+    for (int i = 0; i < _field_stores.length(); i++) {
+      ciField* stored = _field_stores.at(i);
+      if (stored->holder() == field->holder() && stored->offset() == field->offset()) {
+        return true;
+      }
+    }
+    return false;
   }
 
   bool has_indexed_store(BasicType type) {
@@ -381,13 +402,13 @@ void LoopInvariantCodeMotion::process_block(BlockBegin* block) {
     } else if (cur->as_LoadField() != NULL) {
       LoadField* lf = (LoadField*)cur;
       // deoptimizes on NullPointerException
-      cur_invariant = !lf->needs_patching() && !lf->field()->is_volatile() && !_short_loop_optimizer->has_field_store(lf->field()->type()->basic_type()) && is_invariant(lf->obj()) && _insert_is_pred;
+      cur_invariant = !lf->needs_patching() && !lf->field()->is_volatile() && !_short_loop_optimizer->has_field_store(lf->field()) && is_invariant(lf->obj()) && _insert_is_pred;
     } else if (cur->as_ArrayLength() != NULL) {
       ArrayLength *length = cur->as_ArrayLength();
       cur_invariant = is_invariant(length->array());
     } else if (cur->as_LoadIndexed() != NULL) {
       LoadIndexed *li = (LoadIndexed *)cur->as_LoadIndexed();
-      cur_invariant = !_short_loop_optimizer->has_indexed_store(as_BasicType(cur->type())) && is_invariant(li->array()) && is_invariant(li->index()) && _insert_is_pred;
+      cur_invariant = !_short_loop_optimizer->has_indexed_store(li->elt_type()) && is_invariant(li->array()) && is_invariant(li->index()) && _insert_is_pred;
     }
 
     if (cur_invariant) {
@@ -411,7 +432,7 @@ void LoopInvariantCodeMotion::process_block(BlockBegin* block) {
       //  Clear exception handlers
       cur->set_exception_handlers(NULL);
 
-      TRACE_VALUE_NUMBERING(tty->print_cr("Instruction %c%d is loop invariant", cur->type()->tchar(), cur->id()));
+      TRACE_VALUE_NUMBERING(tty->print_cr("Instruction %s %c%d is loop invariant", cur->name(), cur->type()->tchar(), cur->id()));
 
       if (cur->state_before() != NULL) {
         cur->set_state_before(_state->copy());
@@ -434,6 +455,11 @@ bool ShortLoopOptimizer::process(BlockBegin* loop_header) {
 
   _too_complicated_loop = false;
   _loop_blocks.clear();
+  _field_stores.clear();
+  for (int i = 0; i <= T_ARRAY; i++) {
+    _has_field_store[i] = false;
+    _has_indexed_store[i] = false;
+  }
   _loop_blocks.append(loop_header);
 
   for (int i = 0; i < _loop_blocks.length(); i++) {
@@ -323,6 +323,11 @@
   product(bool, C1ProfileBranches, true,                                    \
           "Profile branches when generating code for updating MDOs")        \
                                                                             \
+  product(intx, C1ProfileBranchSampleLog, 0,                                \
+          "Update the branch profile of a tier 3 method about once every "  \
+          "2^n executions of a branch, weighting each update by 2^n; "      \
+          "0 updates it on every execution")                                \
+                                                                            \
   product(bool, C1ProfileCheckcasts, true,                                  \
           "Profile checkcasts when generating code for updating MDOs")      \
                                                                             \
@@ -332,6 +337,10 @@
   product(bool, C1UpdateMethodData, trueInTiered,                           \
           "Update MethodData*s in Tier1-generated code")                    \
                                                                             \
+  product(bool, C1EagerOSRMigration, true,                                  \
+          "When a loop in C1 code has a higher level OSR version, let the "  \
+          "interpreter enter it at the first backedge after deoptimization")\
+                                                                            \
   develop(bool, PrintCFGToFile, false,                                      \
           "print control flow graph to a separate file during compilation") \
                                                                             \
@@ -568,6 +568,7 @@ ClassLoaderData* ClassLoaderDataGraph::_saved_unloading = NULL;
 ClassLoaderData* ClassLoaderDataGraph::_saved_head = NULL;
 
 bool ClassLoaderDataGraph::_should_purge = false;
+ClassLoaderData* volatile ClassLoaderDataGraph::_parallel_claimed_cld = NULL;
 
 // Add a new class loader data node to the list.  Assign the newly created
 // ClassLoaderData into the java/lang/ClassLoader object as a hidden field
@@ -655,6 +656,33 @@ void ClassLoaderDataGraph::roots_cld_do(CLDClosure* strong, CLDClosure* weak) {
   }
 }
 
+uint ClassLoaderDataGraph::possibly_parallel_roots_cld_do(CLDClosure* strong, CLDClosure* weak) {
+  assert(SafepointSynchronize::is_at_safepoint(), "must be at safepoint");
+  uint claimed = 0;
+  for (;;) {
+    // Grab the next chunk of CLDs
+    ClassLoaderData* start = (ClassLoaderData*) OrderAccess::load_ptr_acquire(&_parallel_claimed_cld);
+    if (start == NULL) {
+      break;
+    }
+    ClassLoaderData* end = start;
+    for (int i = 0; i < ClaimChunkSize && end != NULL; i++) {
+      end = end->_next;
+    }
+    if (Atomic::cmpxchg_ptr(end, &_parallel_claimed_cld, start) != start) {
+      continue;
+    }
+    claimed++;
+    for (ClassLoaderData* cld = start; cld != end; cld = cld->_next) {
+      CLDClosure* closure = cld->keep_alive() ? strong : weak;
+      if (closure != NULL) {
+        closure->do_cld(cld);
+      }
+    }
+  }
+  return claimed;
+}
+
 void ClassLoaderDataGraph::keep_alive_cld_do(CLDClosure* cl) {
   roots_cld_do(cl, NULL);
 }
@@ -68,6 +68,9 @@ class ClassLoaderDataGraph : public AllStatic {
   static ClassLoaderData* _saved_head;
   static ClassLoaderData* _saved_unloading;
   static bool _should_purge;
+  // Parallel GC root processing support.
+  enum { ClaimChunkSize = 16 };       // CLDs claimed at a time
+  static ClassLoaderData* volatile _parallel_claimed_cld;
 
   static ClassLoaderData* add(Handle class_loader, bool anonymous, TRAPS);
   static void post_class_unload_events(void);
@@ -83,6 +86,10 @@ class ClassLoaderDataGraph : public AllStatic {
   // cld do
   static void cld_do(CLDClosure* cl);
   static void roots_cld_do(CLDClosure* strong, CLDClosure* weak);
+  // Same as roots_cld_do, but may be called by several GC workers, each of
+  // which claims chunks of CLDs. Returns the number of chunks claimed.
+  static uint possibly_parallel_roots_cld_do(CLDClosure* strong, CLDClosure* weak);
+  static void clear_parallel_claimed_index() { _parallel_claimed_cld = _head; }
   static void keep_alive_cld_do(CLDClosure* cl);
   static void always_strong_cld_do(CLDClosure* cl);
   // klass do
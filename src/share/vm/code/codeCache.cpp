@@ -123,6 +123,7 @@ int CodeCache::_number_of_blobs = 0;
 int CodeCache::_number_of_adapters = 0;
 int CodeCache::_number_of_nmethods = 0;
 int CodeCache::_number_of_nmethods_with_dependencies = 0;
+CodeBlob* volatile CodeCache::_parallel_claimed_blob = NULL;
 bool CodeCache::_needs_cache_clean = false;
 nmethod* CodeCache::_scavenge_root_nmethods = NULL;
 
@@ -173,7 +174,7 @@ nmethod* CodeCache::next_nmethod (CodeBlob* cb) {
 
 static size_t maxCodeCacheUsed = 0;
 
-CodeBlob* CodeCache::allocate(int size, bool is_critical) {
+CodeBlob* CodeCache::allocate(int size, bool is_critical, bool is_hot) {
   // Do not seize the CodeCache lock here--if the caller has not
   // already done so, we are going to lose bigtime, since the code
   // cache will contain a garbage CodeBlob until the caller can
@@ -184,7 +185,7 @@ CodeBlob* CodeCache::allocate(int size, bool is_critical) {
   CodeBlob* cb = NULL;
   _number_of_blobs++;
   while (true) {
-    cb = (CodeBlob*)_heap->allocate(size, is_critical);
+    cb = (CodeBlob*)_heap->allocate(size, is_critical, is_hot && CodeCacheSegregateHotCode);
     if (cb != NULL) break;
     if (!_heap->expand_by(CodeCacheExpansionSize)) {
       // Expansion failed
@@ -335,6 +336,43 @@ void CodeCache::blobs_do(CodeBlobClosure* f) {
   }
 }
 
+uint CodeCache::possibly_parallel_blobs_do(CodeBlobClosure* f) {
+  assert(SafepointSynchronize::is_at_safepoint(), "must be at safepoint");
+  uint claimed = 0;
+  for (;;) {
+    // Grab the next chunk of CodeBlobs
+    CodeBlob* start = (CodeBlob*) OrderAccess::load_ptr_acquire(&_parallel_claimed_blob);
+    if (start == NULL) {
+      break;
+    }
+    CodeBlob* end = start;
+    for (int i = 0; i < ClaimChunkSize && end != NULL; i++) {
+      end = next(end);
+    }
+    if (Atomic::cmpxchg_ptr(end, &_parallel_claimed_blob, start) != start) {
+      continue;
+    }
+    claimed++;
+    for (CodeBlob* cb = start; cb != end; cb = next(cb)) {
+      if (!cb->is_alive()) {
+        continue;
+      }
+      f->do_code_blob(cb);
+
+#ifdef ASSERT
+      if (cb->is_nmethod())
+        ((nmethod*)cb)->verify_scavenge_root_oops();
+#endif //ASSERT
+    }
+  }
+  return claimed;
+}
+
+void CodeCache::clear_parallel_claimed_index() {
+  assert(SafepointSynchronize::is_at_safepoint(), "must be at safepoint");
+  _parallel_claimed_blob = first();
+}
+
 // Walk the list of methods which might contain non-perm oops.
 void CodeCache::scavenge_root_nmethods_do(CodeBlobToOopClosure* f) {
   assert_locked_or_safepoint(CodeCache_lock);
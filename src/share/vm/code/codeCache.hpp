@@ -58,6 +58,10 @@ class CodeCache : AllStatic {
   static bool _needs_cache_clean;
   static nmethod* _scavenge_root_nmethods;  // linked via nm->scavenge_root_link()
 
+  // Parallel GC root processing support
+  enum { ClaimChunkSize = 32 };             // CodeBlobs claimed at a time
+  static CodeBlob* volatile _parallel_claimed_blob;
+
   static void verify_if_often() PRODUCT_RETURN;
 
   static void mark_scavenge_root_nmethods() PRODUCT_RETURN;
@@ -77,7 +81,7 @@ class CodeCache : AllStatic {
   static void report_codemem_full();
 
   // Allocation/administration
-  static CodeBlob* allocate(int size, bool is_critical = false); // allocates a new CodeBlob
+  static CodeBlob* allocate(int size, bool is_critical = false, bool is_hot = false); // allocates a new CodeBlob
   static void commit(CodeBlob* cb);                 // called when the allocated CodeBlob has been filled
   static int alignment_unit();                      // guaranteed alignment of all CodeBlobs
   static int alignment_offset();                    // guaranteed offset of first CodeBlob byte within alignment unit (i.e., allocation header)
@@ -86,6 +90,9 @@ class CodeCache : AllStatic {
   static bool contains(void *p);                    // returns whether p is included
   static void blobs_do(void f(CodeBlob* cb));       // iterates over all CodeBlobs
   static void blobs_do(CodeBlobClosure* f);         // iterates over all CodeBlobs
+  static uint possibly_parallel_blobs_do(CodeBlobClosure* f); // as above, by several GC workers claiming chunks of CodeBlobs;
+                                                    // returns the number of chunks claimed
+  static void clear_parallel_claimed_index();
   static void nmethods_do(void f(nmethod* nm));     // iterates over all nmethods
   static void alive_nmethods_do(void f(nmethod* nm)); // iterates over all alive nmethods
 
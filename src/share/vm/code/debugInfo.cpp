@@ -47,7 +47,7 @@ void DebugInfoWriteStream::write_metadata(Metadata* h) {
   write_int(recorder()->oop_recorder()->find_index(h));
 }
 
-ScopeValue* DebugInfoReadStream::read_object_value() {
+ScopeValue* DebugInfoReadStream::read_object_value(bool has_length) {
   int id = read_int();
 #ifdef ASSERT
   assert(_obj_pool != NULL, "object pool does not exist");
@@ -58,7 +58,7 @@ ScopeValue* DebugInfoReadStream::read_object_value() {
   ObjectValue* result = new ObjectValue(id);
   // Cache the object since an object field could reference it.
   _obj_pool->push(result);
-  result->read_object(this);
+  result->read_object(this, has_length);
   return result;
 }
 
@@ -79,7 +79,8 @@ ScopeValue* DebugInfoReadStream::get_cached_object() {
 
 enum { LOCATION_CODE = 0, CONSTANT_INT_CODE = 1,  CONSTANT_OOP_CODE = 2,
                           CONSTANT_LONG_CODE = 3, CONSTANT_DOUBLE_CODE = 4,
-                          OBJECT_CODE = 5,        OBJECT_ID_CODE = 6 };
+                          OBJECT_CODE = 5,        OBJECT_ID_CODE = 6,
+                          ARRAY_OBJECT_CODE = 7 };
 
 ScopeValue* ScopeValue::read_from(DebugInfoReadStream* stream) {
   ScopeValue* result = NULL;
@@ -89,7 +90,8 @@ ScopeValue* ScopeValue::read_from(DebugInfoReadStream* stream) {
    case CONSTANT_OOP_CODE:    result = new ConstantOopReadValue(stream); break;
    case CONSTANT_LONG_CODE:   result = new ConstantLongValue(stream);    break;
    case CONSTANT_DOUBLE_CODE: result = new ConstantDoubleValue(stream);  break;
-   case OBJECT_CODE:          result = stream->read_object_value();      break;
+   case OBJECT_CODE:          result = stream->read_object_value(false); break;
+   case ARRAY_OBJECT_CODE:    result = stream->read_object_value(true);  break;
    case OBJECT_ID_CODE:       result = stream->get_cached_object();      break;
    default: ShouldNotReachHere();
   }
@@ -113,9 +115,12 @@ void LocationValue::print_on(outputStream* st) const {
 
 // ObjectValue
 
-void ObjectValue::read_object(DebugInfoReadStream* stream) {
+void ObjectValue::read_object(DebugInfoReadStream* stream, bool has_length) {
   _klass = read_from(stream);
   assert(_klass->is_constant_oop(), "should be constant java mirror oop");
+  if (has_length) {
+    _length = read_from(stream);
+  }
   int length = stream->read_int();
   for (int i = 0; i < length; i++) {
     ScopeValue* val = read_from(stream);
@@ -129,9 +134,12 @@ void ObjectValue::write_on(DebugInfoWriteStream* stream) {
     stream->write_int(_id);
   } else {
     _visited = true;
-    stream->write_int(OBJECT_CODE);
+    stream->write_int(has_length() ? ARRAY_OBJECT_CODE : OBJECT_CODE);
     stream->write_int(_id);
     _klass->write_on(stream);
+    if (has_length()) {
+      _length->write_on(stream);
+    }
     int length = _field_values.length();
     stream->write_int(length);
     for (int i = 0; i < length; i++) {
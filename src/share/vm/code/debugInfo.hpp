@@ -90,6 +90,7 @@ class ObjectValue: public ScopeValue {
  private:
   int                        _id;
   ScopeValue*                _klass;
+  ScopeValue*                _length;       // array length if not implied by the elements
   GrowableArray<ScopeValue*> _field_values;
   Handle                     _value;
   bool                       _visited;
@@ -98,6 +99,7 @@ class ObjectValue: public ScopeValue {
   ObjectValue(int id, ScopeValue* klass)
      : _id(id)
      , _klass(klass)
+     , _length(NULL)
      , _field_values()
      , _value()
      , _visited(false) {
@@ -107,6 +109,7 @@ class ObjectValue: public ScopeValue {
   ObjectValue(int id)
      : _id(id)
      , _klass(NULL)
+     , _length(NULL)
      , _field_values()
      , _value()
      , _visited(false) {}
@@ -115,6 +118,8 @@ class ObjectValue: public ScopeValue {
   bool                        is_object() const         { return true; }
   int                         id() const                { return _id; }
   ScopeValue*                 klass() const             { return _klass; }
+  ScopeValue*                 length() const            { return _length; }
+  bool                        has_length() const        { return _length != NULL; }
   GrowableArray<ScopeValue*>* field_values()            { return &_field_values; }
   ScopeValue*                 field_at(int i) const     { return _field_values.at(i); }
   int                         field_size()              { return _field_values.length(); }
@@ -122,10 +127,11 @@ class ObjectValue: public ScopeValue {
   bool                        is_visited() const        { return _visited; }
 
   void                        set_value(oop value)      { _value = Handle(value); }
+  void                        set_length(ScopeValue* l) { _length = l; }
   void                        set_visited(bool visited) { _visited = false; }
 
   // Serialization of debugging information
-  void read_object(DebugInfoReadStream* stream);
+  void read_object(DebugInfoReadStream* stream, bool has_length);
   void write_on(DebugInfoWriteStream* stream);
 
   // Printing
@@ -277,7 +283,7 @@ class DebugInfoReadStream : public CompressedReadStream {
     assert(o == NULL || o->is_metadata(), "meta data only");
     return o;
   }
-  ScopeValue* read_object_value();
+  ScopeValue* read_object_value(bool has_length);
   ScopeValue* get_cached_object();
   // BCI encoding is mostly unsigned, but -1 is a distinguished value
   int read_bci() { return read_int() + InvocationEntryBci; }
@@ -33,6 +33,7 @@
 #include "compiler/compileLog.hpp"
 #include "compiler/compilerOracle.hpp"
 #include "compiler/disassembler.hpp"
+#include "compiler/lambdaFormSharing.hpp"
 #include "interpreter/bytecode.hpp"
 #include "oops/methodData.hpp"
 #include "prims/jvmtiRedefineClassesTrace.hpp"
@@ -42,6 +43,7 @@
 #include "runtime/sweeper.hpp"
 #include "utilities/dtrace.hpp"
 #include "utilities/events.hpp"
+#include "utilities/log.hpp"
 #include "utilities/xmlstream.hpp"
 #ifdef SHARK
 #include "shark/sharkCompiler.hpp"
@@ -610,7 +612,7 @@ nmethod* nmethod::new_nmethod(methodHandle method,
       + round_to(nul_chk_table->size_in_bytes(), oopSize)
       + round_to(debug_info->data_size()       , oopSize);
 
-    nm = new (nmethod_size)
+    nm = new (nmethod_size, comp_level)
     nmethod(method(), nmethod_size, compile_id, entry_bci, offsets,
             orig_pc_offset, debug_info, dependencies, code_buffer, frame_size,
             oop_maps,
@@ -832,6 +834,12 @@ void* nmethod::operator new(size_t size, int nmethod_size) throw() {
   return CodeCache::allocate(nmethod_size);
 }
 
+void* nmethod::operator new(size_t size, int nmethod_size, int comp_level) throw() {
+  // Fully optimized code is what the application spends its time in, so
+  // keep it together in the code cache
+  return CodeCache::allocate(nmethod_size, false, comp_level == CompLevel_full_optimization);
+}
+
 nmethod::nmethod(
   Method* method,
   int nmethod_size,
@@ -1363,14 +1371,19 @@ void nmethod::make_unloaded(BoolObjectClosure* is_alive, oop cause) {
   // so we don't have to break the cycle. Note that it is possible to
   // have the Method* live here, in case we unload the nmethod because
   // it is pointing to some oop (other than the Method*) being unloaded.
+  bool is_lambda_form = false;
   if (_method != NULL) {
     // OSR methods point to the Method*, but the Method* does not
     // point back!
     if (_method->code() == this) {
       _method->clear_code(); // Break a cycle
     }
+    is_lambda_form = _method->is_compiled_lambda_form();
     _method = NULL;            // Clear the method of this dead nmethod
   }
+  if (ShareLambdaFormCode && is_lambda_form) {
+    LambdaFormSharing::unshare(this);
+  }
   // Make the class unloaded - i.e., change state and notify sweeper
   assert(SafepointSynchronize::is_at_safepoint(), "must be at safepoint");
   if (is_in_use()) {
@@ -1444,6 +1457,9 @@ bool nmethod::make_not_entrant_or_zombie(unsigned int state) {
   // would be prone to deadlocks.
   // This flag is used to remember whether we need to later lock and unregister.
   bool nmethod_needs_unregister = false;
+  // Number of methods that ran this code instead of their own, logged once
+  // the locks are released.
+  int unshared = 0;
 
   {
     // invalidate osr nmethod before acquiring the patching lock since
@@ -1455,6 +1471,12 @@ bool nmethod::make_not_entrant_or_zombie(unsigned int state) {
       invalidate_osr_method();
     }
 
+    // Methods that run this code instead of their own are reset together
+    // with the method.  The sharing table is locked before the Patching_lock,
+    // as in LambdaFormSharing::share().
+    bool unshare = ShareLambdaFormCode && the_method.not_null() && the_method->is_compiled_lambda_form();
+    MutexLockerEx ml(unshare ? LambdaFormSharing_lock : NULL, Mutex::_no_safepoint_check_flag);
+
     // Enter critical section.  Does not block for safepoint.
     MutexLockerEx pl(Patching_lock, Mutex::_no_safepoint_check_flag);
 
@@ -1511,8 +1533,17 @@ bool nmethod::make_not_entrant_or_zombie(unsigned int state) {
       HandleMark hm;
       method()->clear_code(false /* already owns Patching_lock */);
     }
+    if (unshare) {
+      unshared = LambdaFormSharing::unshare(this, false /* already owns both locks */);
+    }
   } // leave critical region under Patching_lock
 
+  if (unshared > 0 && Log::is_enabled(LogTag::compilation, LogLevel::debug)) {
+    ResourceMark rm;
+    Log::print(LogTag::compilation, LogLevel::debug, "%d methods no longer share the level %d code of %s",
+               unshared, comp_level(), the_method->name_and_sig_as_C_string());
+  }
+
   // When the nmethod becomes zombie it is no longer alive so the
   // dependencies must be flushed.  nmethods in the not_entrant
   // state will be flushed later when the transition to zombie
@@ -1752,6 +1783,7 @@ void static clean_ic_if_metadata_is_dead(CompiledIC *ic, BoolObjectClosure *is_a
     }
 
     if (cichk_oop->is_loader_alive(is_alive)) {
+      cichk_oop->clean_itable_cache(is_alive);
       return;
     }
   } else {
@@ -28,7 +28,9 @@
 #include "code/codeCache.hpp"
 #include "compiler/compileBroker.hpp"
 #include "compiler/compileLog.hpp"
+#include "compiler/compilerCPUBudget.hpp"
 #include "compiler/compilerOracle.hpp"
+#include "compiler/lambdaFormSharing.hpp"
 #include "interpreter/linkResolver.hpp"
 #include "memory/allocation.inline.hpp"
 #include "oops/methodData.hpp"
@@ -37,9 +39,11 @@
 #include "prims/nativeLookup.hpp"
 #include "runtime/arguments.hpp"
 #include "runtime/compilationPolicy.hpp"
+#include "runtime/deoptimization.hpp"
 #include "runtime/init.hpp"
 #include "runtime/interfaceSupport.hpp"
 #include "runtime/javaCalls.hpp"
+#include "runtime/atomic.inline.hpp"
 #include "runtime/os.hpp"
 #include "runtime/sharedRuntime.hpp"
 #include "runtime/sweeper.hpp"
@@ -182,6 +186,7 @@ int CompileBroker::_sum_nmethod_size             = 0;
 int CompileBroker::_sum_nmethod_code_size        = 0;
 
 long CompileBroker::_peak_compilation_time       = 0;
+size_t CompileBroker::_peak_compilation_memory   = 0;
 
 CompileQueue* CompileBroker::_c2_compile_queue   = NULL;
 CompileQueue* CompileBroker::_c1_compile_queue   = NULL;
@@ -319,6 +324,7 @@ void CompileTask::initialize(int compile_id,
   _is_blocking = is_blocking;
   _comp_level = comp_level;
   _num_inlined_bytecodes = 0;
+  _arena_peak = 0;
 
   _is_complete = false;
   _is_success = false;
@@ -615,6 +621,9 @@ void CompileTask::log_task_done(CompileLog* log) {
   if (_num_inlined_bytecodes != 0) {
     log->print(" inlined_bytes='%d'", _num_inlined_bytecodes);
   }
+  if (_arena_peak != 0) {
+    log->print(" arena_peak='" SIZE_FORMAT "'", _arena_peak);
+  }
   log->stamp();
   log->end_elem();
   log->tail("task");
@@ -758,6 +767,17 @@ CompileTask* CompileQueue::get() {
   return task;
 }
 
+bool CompileQueue::claim_active_thread(int limit) {
+  jint active;
+  do {
+    active = _active_threads;
+    if (active >= limit) {
+      return false;
+    }
+  } while (Atomic::cmpxchg(active + 1, &_active_threads, active) != active);
+  return true;
+}
+
 // Clean & deallocate stale compile tasks.
 // Temporarily releases MethodCompileQueue lock.
 void CompileQueue::purge_stale_tasks() {
@@ -911,6 +931,8 @@ void CompileBroker::compilation_init() {
   _compilers[1] = new SharkCompiler();
 #endif // SHARK
 
+  CompilerCPUBudget::initialize();
+
   // Start the CompilerThreads
   init_compiler_threads(c1_count, c2_count);
   // totalTime performance counter is always created as it is required
@@ -1010,6 +1032,8 @@ void CompileBroker::compilation_init() {
                                           PerfData::U_None,
                                           (jlong)CompileBroker::no_compile,
                                           CHECK);
+
+    Deoptimization::init_counters(CHECK);
   }
 
   _initialized = true;
@@ -1374,6 +1398,12 @@ nmethod* CompileBroker::compile_method(methodHandle method, int osr_bci,
     if (method->is_not_osr_compilable(comp_level)) return NULL;
   }
 
+  // A LambdaForm identical to one that is compiled already runs its code
+  if (osr_bci == InvocationEntryBci && ShareLambdaFormCode && method->is_compiled_lambda_form() &&
+      LambdaFormSharing::share(method, comp_level)) {
+    return NULL;
+  }
+
   assert(!HAS_PENDING_EXCEPTION, "No exception should be present");
   // some prerequisites that are compiler specific
   if (comp->is_c2() || comp->is_shark()) {
@@ -1789,8 +1819,14 @@ void CompileBroker::compiler_thread_loop() {
       handle_full_code_cache();
     }
 
+    // Hold back while the compiler is using all the threads its CPU budget allows
+    if (!CompilerCPUBudget::wait_for_turn(thread)) {
+      continue;
+    }
+
     CompileTask* task = queue->get();
     if (task == NULL) {
+      queue->release_active_thread();
       continue;
     }
 
@@ -1821,6 +1857,7 @@ void CompileBroker::compiler_thread_loop() {
         task->set_failure_reason("compilation is disabled");
       }
     }
+    queue->release_active_thread();
   }
 
   // Shut down compiler runtime
@@ -1927,6 +1964,7 @@ void CompileBroker::invoke_compiler_on_method(CompileTask* task) {
 
   CompilerThread* thread = CompilerThread::current();
   ResourceMark rm(thread);
+  jlong cpu_start = os::is_thread_cpu_time_supported() ? os::current_thread_cpu_time() : 0;
 
   if (LogEvents) {
     _compilation_log->log_compile(thread, task);
@@ -1971,6 +2009,8 @@ void CompileBroker::invoke_compiler_on_method(CompileTask* task) {
     NoHandleMark  nhm;
     ThreadToNativeFromVM ttn(thread);
 
+    // Account the arenas of the compilation, including the ciEnv's
+    thread->start_arena_accounting(CompilerMemoryLimit);
     ciEnv ci_env(task, system_dictionary_modification_counter);
     if (should_break) {
       ci_env.set_break_at_compile(true);
@@ -1999,6 +2039,12 @@ void CompileBroker::invoke_compiler_on_method(CompileTask* task) {
       comp->compile_method(&ci_env, target, osr_bci);
     }
 
+    task->set_arena_peak(thread->arena_peak());
+    if (thread->arena_limit_exceeded()) {
+      // Compiling the method again at this level would hit the limit again
+      ci_env.record_method_not_compilable("compilation memory limit exceeded", !TieredCompilation);
+    }
+
     if (!ci_env.failing() && task->code() == NULL) {
       //assert(false, "compiler should always document failure");
       // The compiler elected, without comment, not to register a result.
@@ -2051,6 +2097,9 @@ void CompileBroker::invoke_compiler_on_method(CompileTask* task) {
   DTRACE_METHOD_COMPILE_END_PROBE(method, compiler_name(task_level), task->is_success());
 
   collect_statistics(thread, time, task);
+  if (os::is_thread_cpu_time_supported()) {
+    CompilerCPUBudget::record(os::current_thread_cpu_time() - cpu_start);
+  }
 
   if (PrintCompilation && PrintCompilation2) {
     tty->print("%7d ", (int) tty->time_stamp().milliseconds());  // print timestamp
@@ -2059,7 +2108,8 @@ void CompileBroker::invoke_compiler_on_method(CompileTask* task) {
     if (task->code() != NULL) {
       tty->print("size: %d(%d) ", task->code()->total_size(), task->code()->insts_size());
     }
-    tty->print_cr("time: %d inlined: %d bytes", (int)time.milliseconds(), task->num_inlined_bytecodes());
+    tty->print_cr("time: %d inlined: %d bytes arena: " SIZE_FORMAT "K",
+                  (int)time.milliseconds(), task->num_inlined_bytecodes(), task->arena_peak() / K);
   }
 
   if (PrintCodeCacheOnCompilation)
@@ -2269,6 +2319,8 @@ void CompileBroker::collect_statistics(CompilerThread* thread, elapsedTimer time
   assert(code == NULL || code->is_locked_by_vm(), "will survive the MutexLocker");
   MutexLocker locker(CompileStatistics_lock);
 
+  _peak_compilation_memory = MAX2(_peak_compilation_memory, task->arena_peak());
+
   // _perf variables are production performance counters which are
   // updated regardless of the setting of the CITime and CITimeEach flags
   //
@@ -2392,6 +2444,8 @@ void CompileBroker::print_times() {
   tty->cr();
   tty->print_cr("  nmethod code size        : %6d bytes", CompileBroker::_sum_nmethod_code_size);
   tty->print_cr("  nmethod total size       : %6d bytes", CompileBroker::_sum_nmethod_size);
+  tty->print_cr("  Peak compilation memory  : %6d Kbytes", (int)(CompileBroker::_peak_compilation_memory / K));
+  tty->print_cr("  Compiler CPU time        : %7.3f s", (double)CompilerCPUBudget::total_cpu_time() / NANOSECS_PER_SEC);
 }
 
 // Debugging output for failure
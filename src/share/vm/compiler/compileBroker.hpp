@@ -27,6 +27,7 @@
 
 #include "ci/compilerInterface.hpp"
 #include "compiler/abstractCompiler.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/perfData.hpp"
 
 class nmethod;
@@ -55,6 +56,7 @@ class CompileTask : public CHeapObj<mtCompiler> {
   bool         _is_blocking;
   int          _comp_level;
   int          _num_inlined_bytecodes;
+  size_t       _arena_peak;   // arena memory used by the compilation, in bytes
   nmethodLocker* _code_handle;  // holder of eventual result
   CompileTask* _next, *_prev;
   bool         _is_free;
@@ -101,6 +103,9 @@ class CompileTask : public CHeapObj<mtCompiler> {
   int          num_inlined_bytecodes() const     { return _num_inlined_bytecodes; }
   void         set_num_inlined_bytecodes(int n)  { _num_inlined_bytecodes = n; }
 
+  size_t       arena_peak() const                { return _arena_peak; }
+  void         set_arena_peak(size_t bytes)      { _arena_peak = bytes; }
+
   CompileTask* next() const                      { return _next; }
   void         set_next(CompileTask* next)       { _next = next; }
   CompileTask* prev() const                      { return _prev; }
@@ -204,6 +209,7 @@ class CompileQueue : public CHeapObj<mtCompiler> {
   CompileTask* _first_stale;
 
   int _size;
+  volatile jint _active_threads;  // threads processing a task from this queue
 
   void purge_stale_tasks();
  public:
@@ -213,6 +219,7 @@ class CompileQueue : public CHeapObj<mtCompiler> {
     _first = NULL;
     _last = NULL;
     _size = 0;
+    _active_threads = 0;
     _first_stale = NULL;
   }
 
@@ -230,6 +237,11 @@ class CompileQueue : public CHeapObj<mtCompiler> {
   bool         is_empty() const                  { return _first == NULL; }
   int          size()     const                  { return _size;          }
 
+  // A thread claims one of at most limit active slots before it takes
+  // a task, and releases it when done with the task
+  bool         claim_active_thread(int limit);
+  void         release_active_thread()           { Atomic::dec(&_active_threads); }
+
 
   // Redefine Classes support
   void mark_on_stack();
@@ -334,6 +346,7 @@ class CompileBroker: AllStatic {
   static int _sum_nmethod_size;
   static int _sum_nmethod_code_size;
   static long _peak_compilation_time;
+  static size_t _peak_compilation_memory;
 
   static volatile jint _print_compilation_warning;
 
@@ -472,6 +485,7 @@ class CompileBroker: AllStatic {
   static int get_sum_nmethod_size() {             return _sum_nmethod_size;}
   static int get_sum_nmethod_code_size() {        return _sum_nmethod_code_size; }
   static long get_peak_compilation_time() {       return _peak_compilation_time; }
+  static size_t get_peak_compilation_memory() {   return _peak_compilation_memory; }
   static long get_total_compilation_time() {      return _t_total_compilation.milliseconds(); }
 };
 
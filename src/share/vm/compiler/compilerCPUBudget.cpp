@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2016, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "compiler/abstractCompiler.hpp"
+#include "compiler/compileBroker.hpp"
+#include "compiler/compilerCPUBudget.hpp"
+#include "runtime/mutexLocker.hpp"
+#include "runtime/os.hpp"
+#include "runtime/thread.inline.hpp"
+#include "utilities/log.hpp"
+
+jlong  CompilerCPUBudget::_window_start    = 0;
+jlong  CompilerCPUBudget::_window_cpu      = 0;
+jlong  CompilerCPUBudget::_total_cpu       = 0;
+double CompilerCPUBudget::_share           = 0.0;
+double CompilerCPUBudget::_thread_fraction = 1.0;
+double CompilerCPUBudget::_threshold_scale = 1.0;
+
+PerfCounter*  CompilerCPUBudget::_perf_cpu_time  = NULL;
+PerfVariable* CompilerCPUBudget::_perf_cpu_share = NULL;
+
+void CompilerCPUBudget::initialize() {
+  _window_start = os::javaTimeNanos();
+  if (UsePerfData) {
+    EXCEPTION_MARK;
+    _perf_cpu_time  = PerfDataManager::create_counter(SUN_CI, "compilerCPUTime",
+                                                      PerfData::U_Ticks, CHECK);
+    _perf_cpu_share = PerfDataManager::create_variable(SUN_CI, "compilerCPUShare",
+                                                       PerfData::U_None, CHECK);
+  }
+}
+
+// Called with CompileStatistics_lock held
+void CompilerCPUBudget::end_window(jlong now) {
+  jlong elapsed = now - _window_start;
+  int cpus = MAX2(os::active_processor_count(), 1);
+  _share = (double)_window_cpu / ((double)elapsed * cpus);
+  _window_start = now;
+  _window_cpu = 0;
+
+  if (is_enabled()) {
+    double budget = CompilerCPUBudgetPercentage / 100.0;
+    if (_share > budget) {
+      // Cut the number of compiling threads in proportion, and queue
+      // only methods that are that much hotter.
+      _thread_fraction = MAX2(_thread_fraction * budget / _share, 0.01);
+      _threshold_scale = MIN2(_threshold_scale * _share / budget, 100.0);
+    } else if (_share < budget / 2) {
+      _thread_fraction = MIN2(_thread_fraction * 2, 1.0);
+      _threshold_scale = MAX2(_threshold_scale / 2, 1.0);
+    }
+  }
+
+  if (_perf_cpu_share != NULL) {
+    // In hundredths of a percent
+    _perf_cpu_share->set_value((jlong)(_share * 10000));
+  }
+  if (Log::is_enabled(LogTag::compilation, LogLevel::debug)) {
+    Log::print(LogTag::compilation, LogLevel::debug,
+               "compiler CPU share %.2f%% of %d CPUs, thread fraction %.2f, threshold scale %.2f",
+               _share * 100, cpus, _thread_fraction, _threshold_scale);
+  }
+}
+
+void CompilerCPUBudget::record(jlong cpu_time) {
+  MutexLocker locker(CompileStatistics_lock);
+  _window_cpu += cpu_time;
+  _total_cpu += cpu_time;
+  if (_perf_cpu_time != NULL) {
+    _perf_cpu_time->inc(cpu_time * os::elapsed_frequency() / NANOSECS_PER_SEC);
+  }
+  jlong now = os::javaTimeNanos();
+  if (now - _window_start >= (jlong)CompilerCPUBudgetWindow * NANOSECS_PER_MILLISEC) {
+    end_window(now);
+  }
+}
+
+bool CompilerCPUBudget::wait_for_turn(CompilerThread* thread) {
+  CompileQueue* queue = thread->queue();
+  int threads = thread->compiler()->num_compiler_threads();
+  while (!CompileBroker::is_compilation_disabled_forever()) {
+    int allowed = is_enabled() ? MAX2((int)ceil(threads * _thread_fraction), 1) : max_jint;
+    if (queue->claim_active_thread(allowed)) {
+      return true;
+    }
+    {
+      // Wait on the queue lock, which blocks for safepoints
+      MutexLocker ml(queue->lock());
+      queue->lock()->wait(!Mutex::_no_safepoint_check_flag, MAX2(CompilerCPUBudgetWindow / 10, (uintx)1));
+    }
+    // Keep ending windows while waiting, so that the limits relax once
+    // the compiling threads go quiet
+    MutexLocker locker(CompileStatistics_lock);
+    jlong now = os::javaTimeNanos();
+    if (now - _window_start >= (jlong)CompilerCPUBudgetWindow * NANOSECS_PER_MILLISEC) {
+      end_window(now);
+    }
+  }
+  return false;
+}
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2016, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_VM_COMPILER_COMPILERCPUBUDGET_HPP
+#define SHARE_VM_COMPILER_COMPILERCPUBUDGET_HPP
+
+#include "memory/allocation.hpp"
+#include "runtime/perfData.hpp"
+
+class CompilerThread;
+
+// CPU time used by the compiler threads
+//
+// The CPU time of every compilation is measured, and at the end of each
+// CompilerCPUBudgetWindow the share of the available CPUs it amounts to is
+// computed.  The available CPUs are those of os::active_processor_count(),
+// which follows the cgroup CPU quota inside a container.
+//
+// With CompilerCPUBudgetPercentage set, the compiler threads are kept
+// within that share.  When a window goes over budget, fewer threads of each
+// compiler may work at the same time, and the tiered policy raises its
+// thresholds so that only the hottest methods are queued.  When a window
+// uses well below the budget, the limits are relaxed again.
+
+class CompilerCPUBudget : AllStatic {
+ private:
+  static jlong  _window_start;       // os::javaTimeNanos() when the window started
+  static jlong  _window_cpu;         // compiler CPU time in the window, in ns
+  static jlong  _total_cpu;          // compiler CPU time since startup, in ns
+  static double _share;              // fraction of the available CPUs used in the last window
+  static double _thread_fraction;    // fraction of each compiler's threads that may compile
+  static double _threshold_scale;    // policy threshold scale, at least 1
+
+  static PerfCounter*  _perf_cpu_time;
+  static PerfVariable* _perf_cpu_share;
+
+  static void end_window(jlong now);
+
+ public:
+  static bool is_enabled()                 { return CompilerCPUBudgetPercentage > 0; }
+
+  static void initialize();
+
+  // Adds the CPU time of a finished compilation
+  static void record(jlong cpu_time);
+
+  // Blocks the current compiler thread while its compiler already uses as
+  // many threads as the budget allows, then claims an active slot of its
+  // queue.  Returns false, without a slot, once compilation is disabled
+  // forever.
+  static bool wait_for_turn(CompilerThread* thread);
+
+  static double share()                    { return _share; }
+  static double threshold_scale()          { return _threshold_scale; }
+  static jlong  total_cpu_time()           { return _total_cpu; }
+};
+
+#endif // SHARE_VM_COMPILER_COMPILERCPUBUDGET_HPP
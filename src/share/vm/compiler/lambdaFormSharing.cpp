@@ -0,0 +1,340 @@
+/*
+ * Copyright (c) 2016, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "code/nmethod.hpp"
+#include "compiler/lambdaFormSharing.hpp"
+#include "interpreter/bytecodes.hpp"
+#include "memory/allocation.inline.hpp"
+#include "memory/resourceArea.hpp"
+#include "oops/constantPool.hpp"
+#include "oops/method.hpp"
+#include "prims/jvm.h"
+#include "prims/jvmtiExport.hpp"
+#include "runtime/mutexLocker.hpp"
+#include "utilities/log.hpp"
+
+// One entry per compiled LambdaForm seen by share()
+class LambdaFormSharing::Entry : public CHeapObj<mtCompiler> {
+ public:
+  Method*      _method;
+  unsigned int _hash;
+  nmethod*     _shared;          // code of an equivalent method run by _method, or NULL
+  bool         _compile_alone;   // reached the interpreter while sharing, see share()
+  Entry*       _next;
+
+  Entry(Method* m, unsigned int hash, Entry* next) :
+    _method(m), _hash(hash), _shared(NULL), _compile_alone(false), _next(next) { }
+};
+
+LambdaFormSharing::Entry* LambdaFormSharing::_table[LambdaFormSharing::table_size];
+int                       LambdaFormSharing::_shared_count = 0;
+
+
+unsigned int LambdaFormSharing::hash(Method* m) {
+  const address code_base = m->code_base();
+  const int code_size = m->code_size();
+  unsigned int h = m->signature()->identity_hash() + code_size;
+  for (int bci = 0; bci < code_size; bci += Bytecodes::java_length_at(m, code_base + bci)) {
+    h = 31 * h + Bytecodes::java_code_at(m, code_base + bci);
+  }
+  return h;
+}
+
+
+// Only methods that are alone in their class are considered, so that a
+// reference to the holder cannot reach anything but the method itself.
+bool LambdaFormSharing::is_shareable(Method* m) {
+  InstanceKlass* holder = m->method_holder();
+  return m->is_compiled_lambda_form() &&
+         holder->is_anonymous() &&
+         holder->methods()->length() == 1 &&
+         holder->java_fields_count() == 0 &&
+         m->number_of_breakpoints() == 0;
+}
+
+
+// The only class entry resolved to the holder itself is its this_class
+// entry, which the class file parser resolves eagerly for anonymous classes.
+bool LambdaFormSharing::refers_to_holder(ConstantPool* cp, int klass_index) {
+  return cp->tag_at(klass_index).is_klass() && cp->resolved_klass_at(klass_index) == cp->pool_holder();
+}
+
+
+bool LambdaFormSharing::is_equivalent_entry(ConstantPool* cp1, ConstantPool* cp2, int index) {
+  constantTag tag1 = cp1->tag_at(index);
+  constantTag tag2 = cp2->tag_at(index);
+
+  if (tag1.is_klass_or_reference() && tag2.is_klass_or_reference()) {
+    // Class entries may be resolved in one pool only
+    if (tag1.is_unresolved_klass_in_error() || tag2.is_unresolved_klass_in_error()) {
+      return false;
+    }
+    Klass* k1 = tag1.is_klass() ? cp1->resolved_klass_at(index) : NULL;
+    Klass* k2 = tag2.is_klass() ? cp2->resolved_klass_at(index) : NULL;
+    if (k1 != NULL && k2 != NULL) {
+      // The this_class entries of the two holders differ but match: the
+      // shared code would see the other holder through them, so is_equivalent()
+      // rejects methods whose bytecodes or member references use them.
+      return k1 == k2 || (k1 == cp1->pool_holder() && k2 == cp2->pool_holder());
+    }
+    // Both holders have the same loader, so the same name resolves to the
+    // same class, unless the resolved one is an anonymous class patched in.
+    Klass* k = (k1 != NULL) ? k1 : k2;
+    if (k != NULL && k->oop_is_instance() && InstanceKlass::cast(k)->is_anonymous()) {
+      return false;
+    }
+    return cp1->klass_name_at(index) == cp2->klass_name_at(index);
+  }
+
+  if (tag1.value() != tag2.value()) {
+    return false;
+  }
+  switch (tag1.value()) {
+  case JVM_CONSTANT_Invalid:
+    return true;
+  case JVM_CONSTANT_Utf8:
+    return cp1->symbol_at(index) == cp2->symbol_at(index);
+  case JVM_CONSTANT_Integer:
+    return cp1->int_at(index) == cp2->int_at(index);
+  case JVM_CONSTANT_Float:
+    return jint_cast(cp1->float_at(index)) == jint_cast(cp2->float_at(index));
+  case JVM_CONSTANT_Long:
+    return cp1->long_at(index) == cp2->long_at(index);
+  case JVM_CONSTANT_Double:
+    return jlong_cast(cp1->double_at(index)) == jlong_cast(cp2->double_at(index));
+  case JVM_CONSTANT_String: {
+    Symbol* s1 = cp1->unresolved_string_at(index);
+    Symbol* s2 = cp2->unresolved_string_at(index);
+    if (s1 != NULL || s2 != NULL) {
+      return s1 == s2;
+    }
+    // Patched constants must be the very same objects
+    return cp1->pseudo_string_at(index) == cp2->pseudo_string_at(index);
+  }
+  case JVM_CONSTANT_Fieldref:
+  case JVM_CONSTANT_Methodref:
+  case JVM_CONSTANT_InterfaceMethodref:
+    return !refers_to_holder(cp1, cp1->uncached_klass_ref_index_at(index)) &&
+           cp1->uncached_klass_ref_index_at(index) == cp2->uncached_klass_ref_index_at(index) &&
+           cp1->uncached_name_and_type_ref_index_at(index) == cp2->uncached_name_and_type_ref_index_at(index);
+  case JVM_CONSTANT_NameAndType:
+    return cp1->name_ref_index_at(index) == cp2->name_ref_index_at(index) &&
+           cp1->signature_ref_index_at(index) == cp2->signature_ref_index_at(index);
+  case JVM_CONSTANT_MethodHandle:
+    return cp1->method_handle_ref_kind_at(index) == cp2->method_handle_ref_kind_at(index) &&
+           cp1->method_handle_index_at(index) == cp2->method_handle_index_at(index);
+  case JVM_CONSTANT_MethodType:
+    return cp1->method_type_index_at(index) == cp2->method_type_index_at(index);
+  default:
+    // invokedynamic and entries that failed to resolve
+    return false;
+  }
+}
+
+
+// The methods are equivalent if they would be compiled to the same code.
+// Rewritten bytecodes are compared as the Java bytecodes they stand for,
+// since the interpreter quickens each copy on its own.
+bool LambdaFormSharing::is_equivalent(Method* m1, Method* m2) {
+  const int code_size = m1->code_size();
+  if (code_size != m2->code_size() ||
+      m1->signature() != m2->signature() ||
+      m1->max_stack() != m2->max_stack() ||
+      m1->max_locals() != m2->max_locals() ||
+      (m1->access_flags().as_int() & JVM_RECOGNIZED_METHOD_MODIFIERS) !=
+      (m2->access_flags().as_int() & JVM_RECOGNIZED_METHOD_MODIFIERS) ||
+      m1->force_inline() != m2->force_inline() ||
+      m1->dont_inline() != m2->dont_inline()) {
+    return false;
+  }
+
+  InstanceKlass* h1 = m1->method_holder();
+  InstanceKlass* h2 = m2->method_holder();
+  if (h1->host_klass() != h2->host_klass() || h1->class_loader() != h2->class_loader()) {
+    return false;
+  }
+
+  const int handlers = m1->exception_table_length();
+  if (handlers != m2->exception_table_length()) {
+    return false;
+  }
+  if (handlers > 0) {
+    ExceptionTableElement* et1 = m1->exception_table_start();
+    ExceptionTableElement* et2 = m2->exception_table_start();
+    for (int i = 0; i < handlers; i++) {
+      if (et1[i].start_pc         != et2[i].start_pc   ||
+          et1[i].end_pc           != et2[i].end_pc     ||
+          et1[i].handler_pc       != et2[i].handler_pc ||
+          et1[i].catch_type_index != et2[i].catch_type_index ||
+          (et1[i].catch_type_index != 0 && refers_to_holder(m1->constants(), et1[i].catch_type_index))) {
+        return false;
+      }
+    }
+  }
+
+  const address code1 = m1->code_base();
+  const address code2 = m2->code_base();
+  int bc_length;
+  for (int bci = 0; bci < code_size; bci += bc_length) {
+    Bytecodes::Code c = Bytecodes::java_code_at(m1, code1 + bci);
+    if (c != Bytecodes::java_code_at(m2, code2 + bci)) {
+      return false;
+    }
+    bc_length = Bytecodes::java_length_at(m1, code1 + bci);
+    if (bc_length <= 0 || memcmp(code1 + bci + 1, code2 + bci + 1, bc_length - 1) != 0) {
+      return false;
+    }
+    // Class constants are not rewritten, so their operand is a pool index
+    int klass_index = 0;
+    switch (Bytecodes::code_at(m1, code1 + bci)) {
+    case Bytecodes::_ldc:
+      klass_index = *(code1 + bci + 1);
+      break;
+    case Bytecodes::_ldc_w:
+    case Bytecodes::_new:
+    case Bytecodes::_anewarray:
+    case Bytecodes::_multianewarray:
+    case Bytecodes::_checkcast:
+    case Bytecodes::_instanceof:
+      klass_index = Bytes::get_Java_u2(code1 + bci + 1);
+      break;
+    default:
+      break;
+    }
+    if (klass_index != 0 && refers_to_holder(m1->constants(), klass_index)) {
+      return false;
+    }
+  }
+
+  ConstantPool* cp1 = m1->constants();
+  ConstantPool* cp2 = m2->constants();
+  if (cp1->length() != cp2->length()) {
+    return false;
+  }
+  for (int index = 1; index < cp1->length(); index++) {
+    if (!is_equivalent_entry(cp1, cp2, index)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+
+LambdaFormSharing::Entry* LambdaFormSharing::find_or_add(Method* m) {
+  assert_lock_strong(LambdaFormSharing_lock);
+  unsigned int h = hash(m);
+  Entry** bucket = &_table[h % table_size];
+  for (Entry* e = *bucket; e != NULL; e = e->_next) {
+    if (e->_method == m) {
+      return e;
+    }
+  }
+  *bucket = new Entry(m, h, *bucket);
+  return *bucket;
+}
+
+
+bool LambdaFormSharing::share(methodHandle m, int comp_level) {
+  if (JvmtiExport::can_hotswap_or_post_breakpoint() || !is_shareable(m())) {
+    return false;
+  }
+
+  ResourceMark rm;
+  const char* shared_name = NULL;
+  int shared_level = CompLevel_none;
+  {
+    MutexLockerEx ml(LambdaFormSharing_lock, Mutex::_no_safepoint_check_flag);
+    Entry* e = find_or_add(m());
+    if (e->_shared != NULL || e->_compile_alone) {
+      // The method was interpreted although it runs shared code, so it is
+      // also called directly: give it code of its own.
+      e->_compile_alone = true;
+      return false;
+    }
+    if (m->code() != NULL) {
+      return false;
+    }
+    for (Entry* c = _table[e->_hash % table_size]; c != NULL; c = c->_next) {
+      if (c == e || c->_hash != e->_hash) {
+        continue;
+      }
+      nmethod* nm = c->_method->code();
+      if (nm != NULL && nm->is_in_use() && nm->comp_level() >= comp_level &&
+          is_equivalent(m(), c->_method) && Method::set_shared_code(m, nm)) {
+        e->_shared = nm;
+        _shared_count++;
+        shared_name = c->_method->name_and_sig_as_C_string();
+        shared_level = nm->comp_level();
+        break;
+      }
+    }
+  }
+
+  if (shared_name != NULL) {
+    if (Log::is_enabled(LogTag::compilation, LogLevel::debug)) {
+      Log::print(LogTag::compilation, LogLevel::debug, "%s shares the level %d code of %s",
+                 m->name_and_sig_as_C_string(), shared_level, shared_name);
+    }
+    return true;
+  }
+  return false;
+}
+
+
+int LambdaFormSharing::unshare(nmethod* nm, bool acquire_lock /* = true */) {
+  MutexLockerEx ml(acquire_lock ? LambdaFormSharing_lock : NULL, Mutex::_no_safepoint_check_flag);
+  assert_lock_strong(LambdaFormSharing_lock);
+  int unshared = 0;
+  if (_shared_count == 0) {
+    return unshared;
+  }
+  for (int i = 0; i < table_size; i++) {
+    for (Entry* e = _table[i]; e != NULL; e = e->_next) {
+      if (e->_shared == nm) {
+        e->_method->clear_shared_code(nm, acquire_lock);
+        e->_shared = NULL;
+        _shared_count--;
+        unshared++;
+      }
+    }
+  }
+  return unshared;
+}
+
+
+void LambdaFormSharing::remove(Method* m) {
+  MutexLockerEx ml(LambdaFormSharing_lock, Mutex::_no_safepoint_check_flag);
+  for (Entry** p = &_table[hash(m) % table_size]; *p != NULL; p = &(*p)->_next) {
+    Entry* e = *p;
+    if (e->_method == m) {
+      if (e->_shared != NULL) {
+        _shared_count--;
+      }
+      *p = e->_next;
+      delete e;
+      return;
+    }
+  }
+}
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2016, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_VM_COMPILER_LAMBDAFORMSHARING_HPP
+#define SHARE_VM_COMPILER_LAMBDAFORMSHARING_HPP
+
+#include "memory/allocation.hpp"
+#include "runtime/handles.hpp"
+
+class nmethod;
+
+// Sharing of compiled LambdaForms
+//
+// The LambdaForms of java.lang.invoke are spun into anonymous classes with
+// a single method.  The Java side caches them, but the same form is still
+// spun more than once, e.g. when two threads race to compile it or after
+// a cache entry was cleared, and every copy gets compiled separately.
+//
+// With -XX:+ShareLambdaFormCode a compiled LambdaForm that is about to be
+// compiled is first matched against the compiled LambdaForms seen so far:
+// bytecodes, signature and constant pool entries must be the same, and
+// patched constants must be the same objects.  If one of them has code at
+// the requested level or higher, the method runs that code instead of
+// being compiled, and its invocations profile into the other method.
+//
+// The sharing method keeps no nmethod of its own: only its compiled and
+// interpreted entry points are redirected, and they are reset as soon as
+// the shared nmethod stops being entrant.  A method that still reaches the
+// interpreter while it is shared, through a direct call bound to its c2i
+// adapter, is compiled on its own on its next compilation request.
+
+class LambdaFormSharing : AllStatic {
+ private:
+  class Entry;
+
+  enum { table_size = 256 };
+  static Entry* _table[table_size];
+  static int    _shared_count;   // number of methods running shared code
+
+  static unsigned int hash(Method* m);
+  static bool is_shareable(Method* m);
+  static bool is_equivalent(Method* m1, Method* m2);
+  static bool is_equivalent_entry(ConstantPool* cp1, ConstantPool* cp2, int index);
+  static bool refers_to_holder(ConstantPool* cp, int klass_index);
+  static Entry* find_or_add(Method* m);
+
+ public:
+  // Called for a standard compilation request of a compiled LambdaForm.
+  // Returns true if the method now runs the code of an equivalent method
+  // and must not be compiled.
+  static bool share(methodHandle m, int comp_level);
+
+  // Resets the methods running the code of nm; called when nm is made
+  // not entrant, zombie or unloaded.  Without acquire_lock the caller
+  // owns both the LambdaFormSharing_lock and the Patching_lock.  Returns
+  // the number of methods that were reset.
+  static int unshare(nmethod* nm, bool acquire_lock = true);
+
+  // Called when the metadata of a compiled LambdaForm is freed.
+  static void remove(Method* m);
+};
+
+#endif // SHARE_VM_COMPILER_LAMBDAFORMSHARING_HPP
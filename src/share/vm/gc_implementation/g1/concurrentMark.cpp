@@ -2464,6 +2464,126 @@ void G1CMRefProcTaskExecutor::execute(EnqueueTask& enq_task) {
   _g1h->set_par_threads(0);
 }
 
+// Closures used to preclean the discovered reference lists concurrently.
+// They differ from the remark closures above in how they deal with a
+// marking step that was aborted because a safepoint is pending: retrying
+// the step would abort it again and never let the safepoint start.
+//
+// While a discovered list is being walked, the iterator holds pointers to
+// Reference objects that a young GC may move, so the 'keep alive' closure
+// stops draining and leaves the remaining entries on the task's queues.
+// The list walk then stops (see G1PrecleanYieldClosure) and the 'drain'
+// closure, which runs with no list iterator live, yields to the safepoint
+// and completes the marking.
+
+class G1PrecleanKeepAliveClosure: public OopClosure {
+  ConcurrentMark* _cm;
+  CMTask*         _task;
+  int             _ref_counter_limit;
+  int             _ref_counter;
+ public:
+  G1PrecleanKeepAliveClosure(ConcurrentMark* cm, CMTask* task) :
+    _cm(cm), _task(task), _ref_counter_limit(G1RefProcDrainInterval) {
+    assert(_ref_counter_limit > 0, "sanity");
+    assert(_task->worker_id() == 0, "only task 0 precleans");
+    _ref_counter = _ref_counter_limit;
+  }
+
+  virtual void do_oop(narrowOop* p) { do_oop_work(p); }
+  virtual void do_oop(      oop* p) { do_oop_work(p); }
+
+  template <class T> void do_oop_work(T* p) {
+    if (_cm->has_overflown()) {
+      return;
+    }
+    oop obj = oopDesc::load_decode_heap_oop(p);
+    _task->deal_with_reference(obj);
+    _ref_counter--;
+
+    if (_ref_counter == 0) {
+      do {
+        _task->do_marking_step(G1ConcMarkStepDurationMillis,
+                               false /* do_termination */,
+                               true  /* is_serial */);
+      } while (_task->has_aborted() && !_cm->has_overflown() &&
+               !SuspendibleThreadSet::should_yield());
+      _ref_counter = _ref_counter_limit;
+    }
+  }
+};
+
+class G1PrecleanDrainMarkingStackClosure: public VoidClosure {
+  ConcurrentMark* _cm;
+  CMTask*         _task;
+ public:
+  G1PrecleanDrainMarkingStackClosure(ConcurrentMark* cm, CMTask* task) :
+    _cm(cm), _task(task) {
+    assert(_task->worker_id() == 0, "only task 0 precleans");
+  }
+
+  void do_void() {
+    do {
+      _task->do_marking_step(1000000000.0 /* something very large */,
+                             true         /* do_termination */,
+                             true         /* is_serial */);
+      if (_task->has_aborted()) {
+        _cm->do_yield_check();
+      }
+    } while (_task->has_aborted() && !_cm->has_overflown() && !_cm->has_aborted());
+  }
+};
+
+class G1PrecleanYieldClosure : public YieldClosure {
+  ConcurrentMark* _cm;
+ public:
+  G1PrecleanYieldClosure(ConcurrentMark* cm) : _cm(cm) { }
+
+  // Between lists: yield, and stop if the cycle was aborted meanwhile.
+  virtual bool should_return() {
+    _cm->do_yield_check();
+    return _cm->has_aborted() || _cm->has_overflown();
+  }
+
+  // Within a list: stop walking it so that the safepoint can proceed.
+  virtual bool should_return_fine_grain() {
+    return SuspendibleThreadSet::should_yield() || _cm->has_overflown();
+  }
+};
+
+void ConcurrentMark::preclean() {
+  assert(G1UseReferencePrecleaning, "Precleaning must be enabled.");
+  if (has_aborted() || has_overflown()) {
+    return;
+  }
+
+  SuspendibleThreadSetJoiner sts_join;
+
+  G1PrecleanKeepAliveClosure keep_alive(this, task(0));
+  G1PrecleanDrainMarkingStackClosure drain_mark_stack(this, task(0));
+  G1PrecleanYieldClosure yield_cl(this);
+
+  set_concurrency_and_phase(1, true /* concurrent */);
+
+  ReferenceProcessor* rp = _g1h->ref_processor_cm();
+  {
+    // Precleaning is done by this thread alone, so the references it
+    // discovers while marking go to the lists in round-robin fashion.
+    ReferenceProcessorMTDiscoveryMutator rp_mut_discovery(rp, false);
+    rp->preclean_discovered_references(rp->is_alive_non_header(),
+                                       &keep_alive,
+                                       &drain_mark_stack,
+                                       &yield_cl,
+                                       _g1h->gc_timer_cm(),
+                                       concurrent_gc_id());
+  }
+
+  // Task 0 normally clears this when it completes a marking step, which
+  // it may not have done if precleaning was cut short.
+  if (concurrent_marking_in_progress()) {
+    clear_concurrent_marking_in_progress();
+  }
+}
+
 void ConcurrentMark::weakRefsWorkParallelPart(BoolObjectClosure* is_alive, bool purged_classes) {
   G1CollectedHeap::heap()->parallel_cleaning(is_alive, true, true, purged_classes);
 }
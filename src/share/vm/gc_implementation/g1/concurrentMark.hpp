@@ -381,6 +381,9 @@ class ConcurrentMark: public CHeapObj<mtGC> {
   friend class G1CMRefProcTaskExecutor;
   friend class G1CMKeepAliveAndDrainClosure;
   friend class G1CMDrainMarkingStackClosure;
+  friend class G1PrecleanKeepAliveClosure;
+  friend class G1PrecleanDrainMarkingStackClosure;
+  friend class G1PrecleanYieldClosure;
 
 protected:
   ConcurrentMarkThread* _cmThread;   // the thread doing the work
@@ -767,6 +770,11 @@ public:
   // Do concurrent phase of marking, to a tentative transitive closure.
   void markFromRoots();
 
+  // Remove the references whose referents have been marked from the
+  // discovered lists, and mark from the others that are no longer active,
+  // to shorten reference processing in the remark pause.
+  void preclean();
+
   void checkpointRootsFinal(bool clear_all_soft_refs);
   void checkpointRootsFinalWork();
   void cleanup();
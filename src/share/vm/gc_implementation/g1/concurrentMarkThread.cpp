@@ -154,6 +154,22 @@ void ConcurrentMarkThread::run() {
                                       mark_end_sec - mark_start_sec);
           }
 
+          if (G1UseReferencePrecleaning) {
+            double preclean_start_sec = os::elapsedTime();
+            if (G1Log::fine()) {
+              gclog_or_tty->gclog_stamp(cm()->concurrent_gc_id());
+              gclog_or_tty->print_cr("[GC concurrent-preclean-start]");
+            }
+
+            _cm->preclean();
+
+            if (G1Log::fine()) {
+              gclog_or_tty->gclog_stamp(cm()->concurrent_gc_id());
+              gclog_or_tty->print_cr("[GC concurrent-preclean-end, %1.7lf secs]",
+                                     os::elapsedTime() - preclean_start_sec);
+            }
+          }
+
           CMCheckpointRootsFinalClosure final_cl(_cm);
           VM_CGC_Operation op(&final_cl, "GC remark", true /* needs_pll */);
           VMThread::execute(&op);
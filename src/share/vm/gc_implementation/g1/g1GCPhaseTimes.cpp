@@ -284,6 +284,12 @@ G1GCPhaseTimes::G1GCPhaseTimes(uint max_gc_threads) :
   _termination_attempts = new WorkerDataArray<size_t>(max_gc_threads, "Termination Attempts", true, G1Log::LevelFinest, 3);
   _gc_par_phases[Termination]->link_thread_work_items(_termination_attempts);
 
+  _jni_claimed_stripes = new WorkerDataArray<size_t>(max_gc_threads, "Claimed Stripes", true, G1Log::LevelFinest, 4);
+  _gc_par_phases[JNIRoots]->link_thread_work_items(_jni_claimed_stripes);
+
+  _cldg_claimed_chunks = new WorkerDataArray<size_t>(max_gc_threads, "Claimed Chunks", true, G1Log::LevelFinest, 4);
+  _gc_par_phases[CLDGRoots]->link_thread_work_items(_cldg_claimed_chunks);
+
   _gc_par_phases[StringDedupQueueFixup] = new WorkerDataArray<double>(max_gc_threads, "Queue Fixup (ms)", true, G1Log::LevelFiner, 2);
   _gc_par_phases[StringDedupTableFixup] = new WorkerDataArray<double>(max_gc_threads, "Table Fixup (ms)", true, G1Log::LevelFiner, 2);
 
@@ -79,6 +79,8 @@ class G1GCPhaseTimes : public CHeapObj<mtGC> {
   WorkerDataArray<double>* _gc_par_phases[GCParPhasesSentinel];
   WorkerDataArray<size_t>* _update_rs_processed_buffers;
   WorkerDataArray<size_t>* _termination_attempts;
+  WorkerDataArray<size_t>* _jni_claimed_stripes;
+  WorkerDataArray<size_t>* _cldg_claimed_chunks;
   WorkerDataArray<size_t>* _redirtied_cards;
 
   double _cur_collection_par_time_ms;
@@ -264,8 +264,11 @@ void G1RootProcessor::process_java_roots(OopClosure* strong_roots,
   // let the thread process the weak CLDs and nmethods.
   {
     G1GCParPhaseTimesTracker x(phase_times, G1GCPhaseTimes::CLDGRoots, worker_i);
-    if (!_process_strong_tasks.is_task_claimed(G1RP_PS_ClassLoaderDataGraph_oops_do)) {
-      ClassLoaderDataGraph::roots_cld_do(strong_clds, weak_clds);
+    // All threads execute the following. A chunk of CLDs is the
+    // individual task.
+    uint claimed = ClassLoaderDataGraph::possibly_parallel_roots_cld_do(strong_clds, weak_clds);
+    if (phase_times != NULL) {
+      phase_times->record_thread_work_item(G1GCPhaseTimes::CLDGRoots, worker_i, claimed);
     }
   }
 
@@ -288,8 +291,11 @@ void G1RootProcessor::process_vm_roots(OopClosure* strong_roots,
 
   {
     G1GCParPhaseTimesTracker x(phase_times, G1GCPhaseTimes::JNIRoots, worker_i);
-    if (!_process_strong_tasks.is_task_claimed(G1RP_PS_JNIHandles_oops_do)) {
-      JNIHandles::oops_do(strong_roots);
+    // All threads execute the following. A stripe of global JNI
+    // handle blocks is the individual task.
+    uint claimed = JNIHandles::possibly_parallel_oops_do(strong_roots);
+    if (phase_times != NULL) {
+      phase_times->record_thread_work_item(G1GCPhaseTimes::JNIRoots, worker_i, claimed);
     }
   }
 
@@ -342,9 +348,9 @@ void G1RootProcessor::process_string_table_roots(OopClosure* weak_roots, G1GCPha
 void G1RootProcessor::process_code_cache_roots(CodeBlobClosure* code_closure,
                                                G1GCPhaseTimes* phase_times,
                                                uint worker_i) {
-  if (!_process_strong_tasks.is_task_claimed(G1RP_PS_CodeCache_oops_do)) {
-    CodeCache::blobs_do(code_closure);
-  }
+  // All threads execute the following. A chunk of CodeBlobs is the
+  // individual task.
+  CodeCache::possibly_parallel_blobs_do(code_closure);
 }
 
 void G1RootProcessor::scan_remembered_sets(G1ParPushHeapRSClosure* scan_rs,
@@ -55,14 +55,11 @@ class G1RootProcessor : public StackObj {
 
   enum G1H_process_roots_tasks {
     G1RP_PS_Universe_oops_do,
-    G1RP_PS_JNIHandles_oops_do,
     G1RP_PS_ObjectSynchronizer_oops_do,
     G1RP_PS_FlatProfiler_oops_do,
     G1RP_PS_Management_oops_do,
     G1RP_PS_SystemDictionary_oops_do,
-    G1RP_PS_ClassLoaderDataGraph_oops_do,
     G1RP_PS_jvmti_oops_do,
-    G1RP_PS_CodeCache_oops_do,
     G1RP_PS_filter_satb_buffers,
     G1RP_PS_refProcessor_oops_do,
     // Leave this one last.
@@ -82,6 +82,10 @@
           "The number of discovered reference objects to process before "   \
           "draining concurrent marking work queues.")                       \
                                                                             \
+  product(bool, G1UseReferencePrecleaning, false,                           \
+          "Concurrently preclean the discovered java.lang.ref.Reference "   \
+          "instances before the remark pause.")                             \
+                                                                            \
   experimental(bool, G1UseConcMarkReferenceProcessing, true,                \
           "If true, enable reference discovery during concurrent "          \
           "marking and reference processing at the end of remark.")         \
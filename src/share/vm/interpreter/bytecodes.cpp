@@ -93,6 +93,22 @@ Bytecodes::Code Bytecodes::code_at(Method* method, int bci) {
   return code_at(method, method->bcp_from(bci));
 }
 
+Bytecodes::Code Bytecodes::superinstruction_for(Code first, Code second) {
+#define SUPERINSTRUCTION_FOR(code, name, format, f, s)                                \
+  if (first == f && second == s)  return code;
+  SUPERINSTRUCTIONS_DO(SUPERINSTRUCTION_FOR)
+#undef SUPERINSTRUCTION_FOR
+  return _illegal;
+}
+
+Bytecodes::Code Bytecodes::superinstruction_second(Code code) {
+#define SUPERINSTRUCTION_SECOND(c, name, format, f, s)                                \
+  if (code == c)  return s;
+  SUPERINSTRUCTIONS_DO(SUPERINSTRUCTION_SECOND)
+#undef SUPERINSTRUCTION_SECOND
+  return _illegal;
+}
+
 Bytecodes::Code Bytecodes::non_breakpoint_code_at(const Method* method, address bcp) {
   assert(method != NULL, "must have the method for breakpoint conversion");
   assert(method->contains(bcp), "must be valid bcp in method");
@@ -542,6 +558,14 @@ void Bytecodes::initialize() {
 
   def(_shouldnotreachhere  , "_shouldnotreachhere" , "b"    , NULL    , T_VOID   ,  0, false);
 
+  // superinstructions
+#define SUPERINSTRUCTION_DEF(code, name, format, first, second)                       \
+  assert(length_for(second) == 1 && !can_trap(second), "see SUPERINSTRUCTIONS_DO");  \
+  def(code, name, format, NULL, result_type(second), depth(first) + depth(second),   \
+      can_trap(first), first);
+  SUPERINSTRUCTIONS_DO(SUPERINSTRUCTION_DEF)
+#undef SUPERINSTRUCTION_DEF
+
   // platform specific JVM bytecodes
   pd_initialize();
 
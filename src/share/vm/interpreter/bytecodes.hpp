@@ -28,6 +28,25 @@
 #include "memory/allocation.hpp"
 #include "utilities/top.hpp"
 
+// Superinstructions are frequent pairs of bytecodes, picked from the
+// BytecodePairHistogram (-XX:+CountBytecodes -XX:+PrintBytecodePairHistogram),
+// that the Rewriter replaces at link time by a single bytecode executing both,
+// saving one dispatch.  Only the first bytecode is rewritten; the second one
+// stays in place for branches into the pair.  The second bytecode must be one
+// byte long, must neither trap nor call the VM, and takes its input from the
+// expression stack.
+//
+//  template(code, name, format, first, second)
+#define SUPERINSTRUCTIONS_DO(template)                                                   \
+  template(_fast_aload_0_aload_1, "fast_aload_0_aload_1", "b_",  _aload_0, _aload_1 )    \
+  template(_fast_aload_0_iload_1, "fast_aload_0_iload_1", "b_",  _aload_0, _iload_1 )    \
+  template(_fast_aload_0_dup,     "fast_aload_0_dup",     "b_",  _aload_0, _dup     )    \
+  template(_fast_aload_1_aload_2, "fast_aload_1_aload_2", "b_",  _aload_1, _aload_2 )    \
+  template(_fast_iload_1_iload_2, "fast_iload_1_iload_2", "b_",  _iload_1, _iload_2 )    \
+  template(_fast_iload_iconst_1,  "fast_iload_iconst_1",  "bi_", _iload,   _iconst_1)
+
+#define SUPERINSTRUCTION_ENUM(code, name, format, first, second) code,
+
 // Bytecodes specifies all bytecodes used in the VM and
 // provides utility functions to get bytecode attributes.
 
@@ -288,6 +307,9 @@ class Bytecodes: AllStatic {
 
     _shouldnotreachhere,      // For debugging
 
+    // superinstructions:
+    SUPERINSTRUCTIONS_DO(SUPERINSTRUCTION_ENUM)
+
     // Platform specific JVM bytecodes
 #ifdef TARGET_ARCH_x86
 # include "bytecodes_x86.hpp"
@@ -416,6 +438,10 @@ class Bytecodes: AllStatic {
   static int         java_length_at (Method* method, address bcp)  { return length_for_code_at(java_code_at(method, bcp), bcp); }
   static bool        is_java_code   (Code code)    { return 0 <= code && code < number_of_java_codes; }
 
+  // Superinstructions
+  static Code        superinstruction_for(Code first, Code second);  // _illegal if the pair has none
+  static Code        superinstruction_second(Code code);             // _illegal for other bytecodes
+
   static bool        is_aload       (Code code)    { return (code == _aload  || code == _aload_0  || code == _aload_1
                                                                              || code == _aload_2  || code == _aload_3); }
   static bool        is_astore      (Code code)    { return (code == _astore || code == _astore_0 || code == _astore_1
@@ -83,6 +83,7 @@ class InvocationCounter VALUE_OBJ_CLASS_SPEC {
   void set_state(State state);                   // sets state and initializes counter correspondingly
   inline void set(State state, int count);       // sets state and counter
   inline void decay();                           // decay counter (divide by two)
+  inline void set_notify_on_next(int freq_log);  // next increment reaches a multiple of 2^freq_log
   void set_carry();                              // set the sticky carry bit
   void set_carry_flag()                          {  _counter |= carry_mask; }
 
@@ -152,5 +153,16 @@ inline void InvocationCounter::decay() {
   set(state(), new_count);
 }
 
+// The interpreter calls into the runtime when an increment leaves the low
+// freq_log bits of the count clear. Round the count up so that this happens
+// on the very next increment.
+inline void InvocationCounter::set_notify_on_next(int freq_log) {
+  int c = count();
+  int new_count = (((c >> freq_log) + 1) << freq_log) - 1;
+  if (new_count > c && new_count < count_limit) {
+    set(state(), new_count);
+  }
+}
+
 
 #endif // SHARE_VM_INTERPRETER_INVOCATIONCOUNTER_HPP
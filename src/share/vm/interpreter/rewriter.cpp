@@ -541,6 +541,31 @@ void Rewriter::rewrite(instanceKlassHandle klass, TRAPS) {
 }
 
 
+// Replaces the first bytecode of every pair listed in SUPERINSTRUCTIONS_DO by
+// the superinstruction of the pair.  The second bytecode is left in place, so
+// branch targets, exception ranges and the debug info of the method stay
+// valid.  This runs last, after the cp cache indices have been patched in.
+void Rewriter::rewrite_superinstructions(Method* method) {
+  No_Safepoint_Verifier nsv;
+  const address code_base = method->code_base();
+  const int code_length = method->code_size();
+
+  int bc_length;
+  for (int bci = 0; bci < code_length; bci += bc_length) {
+    address bcp = code_base + bci;
+    Bytecodes::Code c = (Bytecodes::Code)(*bcp);
+    bc_length = Bytecodes::length_at(method, bcp);
+    if (bci + bc_length < code_length) {
+      Bytecodes::Code next = (Bytecodes::Code)(*(bcp + bc_length));
+      Bytecodes::Code s = Bytecodes::superinstruction_for(c, next);
+      if (s != Bytecodes::_illegal) {
+        (*bcp) = s;
+      }
+    }
+  }
+}
+
+
 Rewriter::Rewriter(instanceKlassHandle klass, constantPoolHandle cpool, Array<Method*>* methods, TRAPS)
   : _klass(klass),
     _pool(cpool),
@@ -586,5 +611,10 @@ Rewriter::Rewriter(instanceKlassHandle klass, constantPoolHandle cpool, Array<Me
       // Method might have gotten rewritten.
       methods->at_put(i, m());
     }
+#ifndef CC_INTERP
+    else if (RewriteSuperinstructions && RewriteFrequentPairs && !DumpSharedSpaces) {
+      rewrite_superinstructions(m());
+    }
+#endif // CC_INTERP
   }
 }
@@ -206,6 +206,7 @@ class Rewriter: public StackObj {
   void restore_bytecodes();
 
   static methodHandle rewrite_jsrs(methodHandle m, TRAPS);
+  static void rewrite_superinstructions(Method* method);
  public:
   // Driver routine:
   static void rewrite(instanceKlassHandle klass, TRAPS);
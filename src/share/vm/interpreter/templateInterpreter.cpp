@@ -401,6 +401,16 @@ void TemplateInterpreterGenerator::generate_all() {
     method_entry(java_util_zip_CRC32_updateByteBuffer)
   }
 
+  if (UseCRC32CIntrinsics) {
+    method_entry(java_util_zip_CRC32C_updateBytes)
+    method_entry(java_util_zip_CRC32C_updateDirectByteBuffer)
+  }
+
+  if (UseAdler32Intrinsics) {
+    method_entry(java_util_zip_Adler32_updateBytes)
+    method_entry(java_util_zip_Adler32_updateByteBuffer)
+  }
+
   initialize_method_handle_entries();
 
   // all native method kinds (must be one contiguous block)
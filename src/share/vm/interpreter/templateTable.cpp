@@ -68,6 +68,18 @@ void Template::generate(InterpreterMacroAssembler* masm) {
 //----------------------------------------------------------------------------------------------------
 // Implementation of TemplateTable: Platform-independent helper routines
 
+// The template of a superinstruction executes the templates of its two
+// bytecodes back to back.  A bytecode that rewrites itself at runtime is
+// represented by the quickened form it is rewritten to.
+static Bytecodes::Code quickened(Bytecodes::Code code) {
+  switch (code) {
+    case Bytecodes::_aload_0: return Bytecodes::_fast_aload_0;
+    case Bytecodes::_iload  : return Bytecodes::_fast_iload;
+    default                 : return code;
+  }
+}
+
+
 void TemplateTable::call_VM(Register oop_result, address entry_point) {
   assert(_desc->calls_vm(), "inconsistent calls_vm information");
   _masm->call_VM(oop_result, entry_point);
@@ -156,6 +168,23 @@ void TemplateTable::jsr() {
 
 
 
+void TemplateTable::superinstruction() {
+  Template* desc = _desc;
+  Template* t1 = template_for(quickened(Bytecodes::java_code(bytecode())));
+  Template* t2 = template_for(quickened(Bytecodes::superinstruction_second(bytecode())));
+  // generate both templates as if they were dispatched separately, with
+  // the tos cached by the first one spilled if the second one expects vtos
+  _desc = t1;
+  t1->_gen(t1->_arg);
+  if (t1->tos_out() != t2->tos_in()) {
+    _masm->push(t1->tos_out());
+  }
+  _desc = t2;
+  t2->_gen(t2->_arg);
+  _desc = desc;
+}
+
+
 //----------------------------------------------------------------------------------------------------
 // Implementation of TemplateTable: Debugging
 
@@ -222,6 +251,17 @@ void TemplateTable::def(Bytecodes::Code code, int flags, TosState in, TosState o
   def(code, flags, in, out, (Template::generator)gen, (int)cc);
 }
 
+
+void TemplateTable::def_superinstruction(Bytecodes::Code code, Bytecodes::Code first, Bytecodes::Code second) {
+  Template* t1 = template_for(quickened(first));
+  Template* t2 = template_for(quickened(second));
+  assert(t1->is_valid() && t2->is_valid(), "templates of the pair must be defined first");
+  assert(!t1->does_dispatch() && !t1->calls_vm(), "first bytecode must fall through");
+  assert(t2->_flags == 0, "second bytecode must not use the bcp, dispatch or call the VM");
+  assert(t2->tos_in() == vtos || t2->tos_in() == t1->tos_out(), "tos states must match");
+  def(code, t1->_flags, t1->tos_in(), t2->tos_out(), superinstruction, ' ');
+}
+
 #if defined(TEMPLATE_TABLE_BUG)
 //
 // It appears that gcc (version 2.91) generates bad code for the template
@@ -518,6 +558,13 @@ void TemplateTable::initialize() {
   def(Bytecodes::_invokehandle        , ubcp|disp|clvm|____, vtos, vtos, invokehandle        , f1_byte      );
 
   def(Bytecodes::_shouldnotreachhere   , ____|____|____|____, vtos, vtos, shouldnotreachhere ,  _           );
+
+  // superinstructions
+#define SUPERINSTRUCTION_DEF(code, name, format, first, second) \
+  def_superinstruction(Bytecodes::code, Bytecodes::first, Bytecodes::second);
+  SUPERINSTRUCTIONS_DO(SUPERINSTRUCTION_DEF)
+#undef SUPERINSTRUCTION_DEF
+
   // platform specific bytecodes
   pd_initialize();
 
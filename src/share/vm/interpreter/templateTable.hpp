@@ -320,6 +320,8 @@ class TemplateTable: AllStatic {
 
   static void shouldnotreachhere();
 
+  static void superinstruction();
+
   // jvmti support
   static void jvmti_post_field_access(Register cache, Register index, bool is_static, bool has_tos);
   static void jvmti_post_field_mod(Register cache, Register index, bool is_static);
@@ -335,6 +337,7 @@ class TemplateTable: AllStatic {
   static void def(Bytecodes::Code code, int flags, TosState in, TosState out, void (*gen)(TosState tos), TosState tos);
   static void def(Bytecodes::Code code, int flags, TosState in, TosState out, void (*gen)(Operation op), Operation op);
   static void def(Bytecodes::Code code, int flags, TosState in, TosState out, void (*gen)(Condition cc), Condition cc);
+  static void def_superinstruction(Bytecodes::Code code, Bytecodes::Code first, Bytecodes::Code second);
 
   friend class Template;
 
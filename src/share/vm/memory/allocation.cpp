@@ -32,6 +32,7 @@
 #include "runtime/atomic.hpp"
 #include "runtime/os.hpp"
 #include "runtime/task.hpp"
+#include "runtime/thread.inline.hpp"
 #include "runtime/threadCritical.hpp"
 #include "services/memTracker.hpp"
 #include "utilities/ostream.hpp"
@@ -236,6 +237,7 @@ class ChunkPool: public CHeapObj<mtInternal> {
   size_t       _num_chunks;   // number of unused chunks in pool
   size_t       _num_used;     // number of chunks currently checked out
   const size_t _size;         // size of each chunk (must be uniform)
+  const int    _cache_index;  // index of this size in a ChunkCache
 
   // Our four static pools
   static ChunkPool* _large_pool;
@@ -255,12 +257,19 @@ class ChunkPool: public CHeapObj<mtInternal> {
 
  public:
   // All chunks in a ChunkPool has the same size
-   ChunkPool(size_t size) : _size(size) { _first = NULL; _num_chunks = _num_used = 0; }
+   ChunkPool(size_t size, int cache_index) : _size(size), _cache_index(cache_index) {
+     _first = NULL; _num_chunks = _num_used = 0;
+   }
 
   // Allocate a new chunk from the pool (might expand the pool)
   _NOINLINE_ void* allocate(size_t bytes, AllocFailType alloc_failmode) {
     assert(bytes == _size, "bad size");
     void* p = NULL;
+    ChunkCache* cache = ChunkCache::current();
+    if (cache != NULL) {
+      p = cache->take(_cache_index);
+      if (p != NULL) return p;
+    }
     // No VM lock can be taken inside ThreadCritical lock, so os::malloc
     // should be done outside ThreadCritical lock due to NMT
     { ThreadCritical tc;
@@ -277,6 +286,10 @@ class ChunkPool: public CHeapObj<mtInternal> {
   // Return a chunk to the pool
   void free(Chunk* chunk) {
     assert(chunk->length() + Chunk::aligned_overhead_size() == _size, "bad size");
+    ChunkCache* cache = ChunkCache::current();
+    if (cache != NULL && cache->put(_cache_index, chunk)) {
+      return;
+    }
     ThreadCritical tc;
     _num_used--;
 
@@ -324,10 +337,10 @@ class ChunkPool: public CHeapObj<mtInternal> {
   static ChunkPool* tiny_pool()   { assert(_tiny_pool   != NULL, "must be initialized"); return _tiny_pool;   }
 
   static void initialize() {
-    _large_pool  = new ChunkPool(Chunk::size        + Chunk::aligned_overhead_size());
-    _medium_pool = new ChunkPool(Chunk::medium_size + Chunk::aligned_overhead_size());
-    _small_pool  = new ChunkPool(Chunk::init_size   + Chunk::aligned_overhead_size());
-    _tiny_pool   = new ChunkPool(Chunk::tiny_size   + Chunk::aligned_overhead_size());
+    _large_pool  = new ChunkPool(Chunk::size        + Chunk::aligned_overhead_size(), 0);
+    _medium_pool = new ChunkPool(Chunk::medium_size + Chunk::aligned_overhead_size(), 1);
+    _small_pool  = new ChunkPool(Chunk::init_size   + Chunk::aligned_overhead_size(), 2);
+    _tiny_pool   = new ChunkPool(Chunk::tiny_size   + Chunk::aligned_overhead_size(), 3);
   }
 
   static void clean() {
@@ -368,6 +381,54 @@ class ChunkPoolCleaner : public PeriodicTask {
    }
 };
 
+//--------------------------------------------------------------------------------------
+// ChunkCache implementation
+
+static CompilerThread* current_compiler_thread() {
+  if (!ThreadLocalStorage::is_initialized()) {
+    return NULL;
+  }
+  Thread* thread = ThreadLocalStorage::thread();
+  if (thread == NULL || !thread->is_Compiler_thread()) {
+    return NULL;
+  }
+  return ((JavaThread*)thread)->as_CompilerThread();
+}
+
+ChunkCache::ChunkCache() {
+  for (int i = 0; i < number_of_sizes; i++) {
+    _first[i] = NULL;
+    _count[i] = 0;
+  }
+}
+
+ChunkCache* ChunkCache::current() {
+  if (CompilerThreadChunkCacheSize == 0) {
+    return NULL;
+  }
+  CompilerThread* thread = current_compiler_thread();
+  return thread != NULL ? thread->chunk_cache() : NULL;
+}
+
+Chunk* ChunkCache::take(int index) {
+  Chunk* c = _first[index];
+  if (c != NULL) {
+    _first[index] = c->next();
+    _count[index]--;
+  }
+  return c;
+}
+
+bool ChunkCache::put(int index, Chunk* chunk) {
+  if (_count[index] >= CompilerThreadChunkCacheSize) {
+    return false;
+  }
+  chunk->set_next(_first[index]);
+  _first[index] = chunk;
+  _count[index]++;
+  return true;
+}
+
 //--------------------------------------------------------------------------------------
 // Chunk implementation
 
@@ -532,6 +593,11 @@ void Arena::set_size_in_bytes(size_t size) {
     long delta = (long)(size - size_in_bytes());
     _size_in_bytes = size;
     MemTracker::record_arena_size_change(delta, _flags);
+    // Account the change to the compilation running on this thread, if any
+    CompilerThread* thread = current_compiler_thread();
+    if (thread != NULL) {
+      thread->arena_size_changed(delta);
+    }
   }
 }
 
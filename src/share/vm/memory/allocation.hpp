@@ -362,6 +362,30 @@ class Chunk: CHeapObj<mtChunk> {
   static void clean_chunk_pool();
 };
 
+//------------------------------ChunkCache-------------------------------------
+// A few chunks of each pooled size owned by a compiler thread. The arenas
+// of one compilation are freed before the next one starts, so keeping their
+// chunks with the thread lets it reuse them without going through
+// ThreadCritical and the global ChunkPools.
+class ChunkCache VALUE_OBJ_CLASS_SPEC {
+  friend class ChunkPool;
+ public:
+  enum { number_of_sizes = 4 };  // one per ChunkPool
+
+ private:
+  Chunk* _first[number_of_sizes];
+  uint   _count[number_of_sizes];
+
+  Chunk* take(int index);
+  bool   put(int index, Chunk* chunk);
+
+  // The cache of the current thread, NULL if it is not a compiler thread
+  static ChunkCache* current();
+
+ public:
+  ChunkCache();
+};
+
 //------------------------------Arena------------------------------------------
 // Fast allocation of memory
 class Arena : public CHeapObj<mtNone> {
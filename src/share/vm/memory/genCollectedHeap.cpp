@@ -66,7 +66,6 @@ NOT_PRODUCT(size_t GenCollectedHeap::_skip_header_HeapWords = 0;)
 // The set of potentially parallel tasks in root scanning.
 enum GCH_strong_roots_tasks {
   GCH_PS_Universe_oops_do,
-  GCH_PS_JNIHandles_oops_do,
   GCH_PS_ObjectSynchronizer_oops_do,
   GCH_PS_FlatProfiler_oops_do,
   GCH_PS_Management_oops_do,
@@ -645,8 +644,11 @@ void GenCollectedHeap::process_roots(bool activate_scope,
   if (!_process_strong_tasks->is_task_claimed(GCH_PS_Universe_oops_do)) {
     Universe::oops_do(strong_roots);
   }
-  // Global (strong) JNI handles
-  if (!_process_strong_tasks->is_task_claimed(GCH_PS_JNIHandles_oops_do)) {
+  // Global (strong) JNI handles. Each stripe of handle blocks is an
+  // individual task.
+  if (CollectedHeap::use_parallel_gc_threads()) {
+    JNIHandles::possibly_parallel_oops_do(strong_roots);
+  } else {
     JNIHandles::oops_do(strong_roots);
   }
 
@@ -181,10 +181,19 @@ void CodeHeap::clear() {
 }
 
 
-void* CodeHeap::allocate(size_t instance_size, bool is_critical) {
+void* CodeHeap::allocate(size_t instance_size, bool is_critical, bool prefer_unused) {
   size_t number_of_segments = size_to_segments(instance_size + sizeof(HeapBlock));
   assert(segments_to_size(number_of_segments) >= sizeof(FreeBlock), "not enough room for FreeList");
 
+  // Hot code is packed into the unused part of the heap so it is not
+  // scattered over the holes left behind by flushed code
+  if (prefer_unused) {
+    void* p = allocate_unused(instance_size, number_of_segments, is_critical);
+    if (p != NULL) {
+      return p;
+    }
+  }
+
   // First check if we can satify request from freelist
   debug_only(verify());
   HeapBlock* block = search_freelist(number_of_segments, is_critical);
@@ -198,6 +207,13 @@ void* CodeHeap::allocate(size_t instance_size, bool is_critical) {
     return block->allocated_space();
   }
 
+  if (prefer_unused) {
+    return NULL;
+  }
+  return allocate_unused(instance_size, number_of_segments, is_critical);
+}
+
+void* CodeHeap::allocate_unused(size_t instance_size, size_t number_of_segments, bool is_critical) {
   // Ensure minimum size for allocation to the heap.
   if (number_of_segments < CodeCacheMinBlockLength) {
     number_of_segments = CodeCacheMinBlockLength;
@@ -111,6 +111,7 @@ class CodeHeap : public CHeapObj<mtCode> {
   // Toplevel freelist management
   void add_to_freelist(HeapBlock *b);
   FreeBlock* search_freelist(size_t length, bool is_critical);
+  void*      allocate_unused(size_t instance_size, size_t number_of_segments, bool is_critical);
 
   // Iteration helpers
   void*      next_free(HeapBlock* b) const;
@@ -132,7 +133,7 @@ class CodeHeap : public CHeapObj<mtCode> {
   void  clear();                                 // clears all heap contents
 
   // Memory allocation
-  void* allocate  (size_t size, bool is_critical);  // allocates a block of size or returns NULL
+  void* allocate  (size_t size, bool is_critical, bool prefer_unused = false);  // allocates a block of size or returns NULL
   void  deallocate(void* p);                     // deallocates a block
 
   // Attributes
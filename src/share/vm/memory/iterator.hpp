@@ -358,6 +358,9 @@ class VoidClosure : public StackObj {
 class YieldClosure : public StackObj {
   public:
    virtual bool should_return() = 0;
+   // Checked more often than should_return(), at points where yielding
+   // itself is not possible.
+   virtual bool should_return_fine_grain() { return false; }
 };
 
 // Abstract closure for serializing data (read or write).
@@ -34,6 +34,7 @@
 #include "oops/oop.inline.hpp"
 #include "runtime/java.hpp"
 #include "runtime/jniHandles.hpp"
+#include "utilities/log.hpp"
 
 PRAGMA_FORMAT_MUTE_WARNINGS_FOR_GCC
 
@@ -211,6 +212,24 @@ ReferenceProcessorStats ReferenceProcessor::process_discovered_references(
 
   bool trace_time = PrintGCDetails && PrintReferenceGC;
 
+  // Starting the worker threads costs more than processing a handful of
+  // references, so small discovered sets are processed by the calling
+  // thread with the serial closures, as the JNI weak references are below.
+  if (task_executor != NULL && _processing_is_mt) {
+    size_t total = 0;
+    for (uint i = 0; i < _max_num_q * number_of_subclasses_of_ref(); i++) {
+      total += _discovered_refs[i].length();
+    }
+    if (ReferencesPerThread > 0 && ergo_proc_thread_count(total) <= 1) {
+      if (Log::is_enabled(LogTag::ref, LogLevel::debug)) {
+        Log::print(LogTag::ref, LogLevel::debug,
+                   "Processing " SIZE_FORMAT " discovered references serially", total);
+      }
+      task_executor->set_single_threaded_mode();
+      task_executor = NULL;
+    }
+  }
+
   // Soft references
   size_t soft_count = 0;
   {
@@ -888,6 +907,47 @@ void ReferenceProcessor::balance_all_queues() {
   balance_queues(_discoveredCleanerRefs);
 }
 
+// Times of the steps of processing one kind of reference, for logging.
+class RefProcPhaseTimes : public StackObj {
+ public:
+  enum Phase {
+    Balance,
+    Phase1,
+    Phase2,
+    Phase3,
+    PhaseCount
+  };
+
+ private:
+  jlong _ns[PhaseCount];
+
+ public:
+  RefProcPhaseTimes() {
+    for (int i = 0; i < PhaseCount; i++) {
+      _ns[i] = 0;
+    }
+  }
+
+  // Records the time since start, and makes now the start of the next phase.
+  void record_phase(Phase phase, jlong& start) {
+    jlong now = os::javaTimeNanos();
+    _ns[phase] = now - start;
+    start = now;
+  }
+
+  double ms(Phase phase) const { return (double)_ns[phase] / NANOSECS_PER_MILLISEC; }
+};
+
+// The number of queues worth processing in parallel for ref_count
+// references, at most the number of active queues.
+uint ReferenceProcessor::ergo_proc_thread_count(size_t ref_count) const {
+  if (ReferencesPerThread == 0) {
+    return _num_q;
+  }
+  size_t wanted = (ref_count + ReferencesPerThread - 1) / ReferencesPerThread;
+  return (uint)MAX2((size_t)1, MIN2((size_t)_num_q, wanted));
+}
+
 size_t
 ReferenceProcessor::process_discovered_reflist(
   DiscoveredList               refs_lists[],
@@ -899,24 +959,41 @@ ReferenceProcessor::process_discovered_reflist(
   AbstractRefProcTaskExecutor* task_executor)
 {
   bool mt_processing = task_executor != NULL && _processing_is_mt;
+  size_t total_list_count = total_count(refs_lists);
+
+  if (PrintReferenceGC && PrintGCDetails) {
+    gclog_or_tty->print(", %u refs", total_list_count);
+  }
+
+  if (total_list_count == 0) {
+    // Nothing was discovered, don't bother the worker threads.
+    return 0;
+  }
+
+  // Use no more queues, and hence busy workers, than the number of
+  // references warrants. The remaining workers find empty queues.
+  uint saved_num_q = _num_q;
+  if (mt_processing) {
+    _num_q = ergo_proc_thread_count(total_list_count);
+  }
+
+  RefProcPhaseTimes times;
+  jlong start = os::javaTimeNanos();
+
   // If discovery used MT and a dynamic number of GC threads, then
   // the queues must be balanced for correctness if fewer than the
   // maximum number of queues were used.  The number of queue used
   // during discovery may be different than the number to be used
   // for processing so don't depend of _num_q < _max_num_q as part
-  // of the test.
-  bool must_balance = _discovery_is_mt;
+  // of the test. The same holds if fewer queues are used than were
+  // set up by the collector.
+  bool must_balance = _discovery_is_mt || _num_q < saved_num_q;
 
   if ((mt_processing && ParallelRefProcBalancingEnabled) ||
       must_balance) {
     balance_queues(refs_lists);
   }
-
-  size_t total_list_count = total_count(refs_lists);
-
-  if (PrintReferenceGC && PrintGCDetails) {
-    gclog_or_tty->print(", %u refs", total_list_count);
-  }
+  times.record_phase(RefProcPhaseTimes::Balance, start);
 
   // Phase 1 (soft refs only):
   // . Traverse the list and remove any SoftReferences whose
@@ -937,6 +1014,7 @@ ReferenceProcessor::process_discovered_reflist(
     assert(refs_lists != _discoveredSoftRefs,
            "Policy must be specified for soft references.");
   }
+  times.record_phase(RefProcPhaseTimes::Phase1, start);
 
   // Phase 2:
   // . Traverse the list and remove any refs whose referents are alive.
@@ -948,6 +1026,7 @@ ReferenceProcessor::process_discovered_reflist(
       process_phase2(refs_lists[i], is_alive, keep_alive, complete_gc);
     }
   }
+  times.record_phase(RefProcPhaseTimes::Phase2, start);
 
   // Phase 3:
   // . Traverse the list and process referents as appropriate.
@@ -960,7 +1039,19 @@ ReferenceProcessor::process_discovered_reflist(
                      is_alive, keep_alive, complete_gc);
     }
   }
+  times.record_phase(RefProcPhaseTimes::Phase3, start);
+
+  if (Log::is_enabled(LogTag::ref, LogLevel::debug)) {
+    Log::print(LogTag::ref, LogLevel::debug,
+               "%s: " SIZE_FORMAT " refs, %u of %u queues, balance %.3fms, "
+               "phase1 %.3fms, phase2 %.3fms, phase3 %.3fms",
+               list_name((uint)(refs_lists - _discovered_refs)), total_list_count,
+               mt_processing ? _num_q : 1, saved_num_q,
+               times.ms(RefProcPhaseTimes::Balance), times.ms(RefProcPhaseTimes::Phase1),
+               times.ms(RefProcPhaseTimes::Phase2), times.ms(RefProcPhaseTimes::Phase3));
+  }
 
+  _num_q = saved_num_q;
   return total_list_count;
 }
 
@@ -1343,6 +1434,10 @@ ReferenceProcessor::preclean_discovered_reflist(DiscoveredList&    refs_list,
                                                 YieldClosure*      yield) {
   DiscoveredListIterator iter(refs_list, keep_alive, is_alive);
   while (iter.has_next()) {
+    if (yield->should_return_fine_grain()) {
+      // Leave the rest of the list to reference processing
+      break;
+    }
     iter.load_ptrs(DEBUG_ONLY(true /* allow_null_referent */));
     oop obj = iter.obj();
     oop next = java_lang_ref_Reference::next(obj);
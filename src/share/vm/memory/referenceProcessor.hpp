@@ -345,8 +345,8 @@ class ReferenceProcessor : public CHeapObj<mtGC> {
   // may be used to incrementalize or abort the precleaning process.
   // The caller is responsible for taking care of potential
   // interference with concurrent operations on these lists
-  // (or predicates involved) by other threads. Currently
-  // only used by the CMS collector.
+  // (or predicates involved) by other threads. Used by the
+  // CMS and G1 collectors.
   void preclean_discovered_references(BoolObjectClosure* is_alive,
                                       OopClosure*        keep_alive,
                                       VoidClosure*       complete_gc,
@@ -376,7 +376,7 @@ class ReferenceProcessor : public CHeapObj<mtGC> {
  protected:
   // "Preclean" the given discovered reference list
   // by removing references with strongly reachable referents.
-  // Currently used in support of CMS only.
+  // Currently used in support of CMS and G1.
   void preclean_discovered_reflist(DiscoveredList&    refs_list,
                                    BoolObjectClosure* is_alive,
                                    OopClosure*        keep_alive,
@@ -405,6 +405,10 @@ class ReferenceProcessor : public CHeapObj<mtGC> {
   // Balances reference queues.
   void balance_queues(DiscoveredList ref_lists[]);
 
+  // The number of workers to use for the given number of references,
+  // see ReferencesPerThread.
+  uint ergo_proc_thread_count(size_t ref_count) const;
+
   // Update (advance) the soft ref master clock field.
   void update_soft_ref_master_clock();
 
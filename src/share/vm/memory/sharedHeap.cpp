@@ -23,6 +23,7 @@
  */
 
 #include "precompiled.hpp"
+#include "classfile/classLoaderData.hpp"
 #include "classfile/symbolTable.hpp"
 #include "classfile/systemDictionary.hpp"
 #include "code/codeCache.hpp"
@@ -32,6 +33,7 @@
 #include "runtime/atomic.inline.hpp"
 #include "runtime/fprofiler.hpp"
 #include "runtime/java.hpp"
+#include "runtime/jniHandles.hpp"
 #include "utilities/copy.hpp"
 #include "utilities/workgroup.hpp"
 
@@ -92,6 +94,11 @@ SharedHeap::StrongRootsScope::StrongRootsScope(SharedHeap* heap, bool activate)
     _sh->change_strong_roots_parity();
     // Zero the claimed high water mark in the StringTable
     StringTable::clear_parallel_claimed_index();
+    // Zero the claimed stripe index of the global JNI handles
+    JNIHandles::clear_parallel_claimed_index();
+    // Restart the chunk claiming of the CLDG and the CodeCache
+    ClassLoaderDataGraph::clear_parallel_claimed_index();
+    CodeCache::clear_parallel_claimed_index();
   }
 }
 
@@ -24,11 +24,26 @@
 
 #include "precompiled.hpp"
 #include "oops/compiledICHolder.hpp"
+#include "oops/klass.inline.hpp"
 #include "oops/oop.inline2.hpp"
 
 volatile int CompiledICHolder::_live_count;
 volatile int CompiledICHolder::_live_not_claimed_count;
 
+void CompiledICHolder::clean_itable_cache(BoolObjectClosure* is_alive) {
+#ifdef _LP64
+  for (int i = 0; i < ItableStubCacheMaxSize; i++) {
+    jlong cache = _itable_cache[i];
+    if (cache != 0) {
+      Klass* k = Klass::decode_klass_not_null((narrowKlass)(cache & max_juint));
+      if (!k->is_loader_alive(is_alive)) {
+        _itable_cache[i] = 0;
+      }
+    }
+  }
+#endif // _LP64
+}
+
 
 // Printing
 
@@ -36,6 +51,9 @@ void CompiledICHolder::print_on(outputStream* st) const {
   st->print("%s", internal_name());
   st->print(" - metadata: "); holder_metadata()->print_value_on(st); st->cr();
   st->print(" - klass:    "); holder_klass()->print_value_on(st); st->cr();
+  if (!_is_metadata_method) {
+    st->print_cr(" - itable stub misses: %u", itable_misses());
+  }
 }
 
 void CompiledICHolder::print_value_on(outputStream* st) const {
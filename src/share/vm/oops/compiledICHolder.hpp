@@ -42,6 +42,9 @@
 
 class CompiledICHolder : public CHeapObj<mtCompiler> {
   friend class VMStructs;
+ public:
+  enum { ItableStubCacheMaxSize = 8 };
+
  private:
   static volatile int _live_count; // allocated
   static volatile int _live_not_claimed_count; // allocated but not yet in use so not
@@ -51,11 +54,22 @@ class CompiledICHolder : public CHeapObj<mtCompiler> {
   Klass*    _holder_klass;    // to avoid name conflict with oopDesc::_klass
   CompiledICHolder* _next;
   bool _is_metadata_method;
+  // Receivers dispatched by the itable stub of a megamorphic interface
+  // call site: each entry has the narrow klass in the low half and the
+  // offset of the selected itable method entry from the klass in the high
+  // half, so an entry is updated by one store.  The stub fills the entries
+  // round robin, counting the misses, until ItableStubCacheMissLimit.
+  volatile jlong _itable_cache[ItableStubCacheMaxSize];
+  volatile juint _itable_misses;
 
  public:
   // Constructor
   CompiledICHolder(Metadata* metadata, Klass* klass, bool is_method = true)
-      : _holder_metadata(metadata), _holder_klass(klass), _is_metadata_method(is_method) {
+      : _holder_metadata(metadata), _holder_klass(klass), _is_metadata_method(is_method),
+        _itable_misses(0) {
+    for (int i = 0; i < ItableStubCacheMaxSize; i++) {
+      _itable_cache[i] = 0;
+    }
 #ifdef ASSERT
     Atomic::inc(&_live_count);
     Atomic::inc(&_live_not_claimed_count);
@@ -81,6 +95,10 @@ class CompiledICHolder : public CHeapObj<mtCompiler> {
 
   static int holder_metadata_offset() { return offset_of(CompiledICHolder, _holder_metadata); }
   static int holder_klass_offset()    { return offset_of(CompiledICHolder, _holder_klass); }
+  static int itable_cache_offset()    { return offset_of(CompiledICHolder, _itable_cache); }
+  static int itable_misses_offset()   { return offset_of(CompiledICHolder, _itable_misses); }
+
+  juint itable_misses() const         { return _itable_misses; }
 
   CompiledICHolder* next()     { return _next; }
   void set_next(CompiledICHolder* n) { _next = n; }
@@ -96,6 +114,9 @@ class CompiledICHolder : public CHeapObj<mtCompiler> {
     return true;
   }
 
+  // Forget the cached receivers whose classes are being unloaded
+  void clean_itable_cache(BoolObjectClosure* is_alive);
+
   // Verify
   void verify_on(outputStream* st);
 
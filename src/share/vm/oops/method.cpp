@@ -26,6 +26,7 @@
 #include "classfile/metadataOnStackMark.hpp"
 #include "classfile/systemDictionary.hpp"
 #include "code/debugInfoRec.hpp"
+#include "compiler/lambdaFormSharing.hpp"
 #include "gc_interface/collectedHeap.inline.hpp"
 #include "interpreter/bytecodeStream.hpp"
 #include "interpreter/bytecodeTracer.hpp"
@@ -112,6 +113,9 @@ Method::Method(ConstMethod* xconst, AccessFlags access_flags, int size) {
 // Release Method*.  The nmethod will be gone when we get here because
 // we've walked the code cache.
 void Method::deallocate_contents(ClassLoaderData* loader_data) {
+  if (ShareLambdaFormCode && is_compiled_lambda_form()) {
+    LambdaFormSharing::remove(this);
+  }
   clear_jmethod_id(loader_data);
   MetadataFactory::free_metadata(loader_data, constMethod());
   set_constMethod(NULL);
@@ -1006,6 +1010,33 @@ void Method::set_code(methodHandle mh, nmethod *code) {
 #endif //!SHARK
 }
 
+// Unlike set_code(), only the entry points are redirected: the nmethod
+// belongs to another method, and clear_shared_code() must be called when
+// it stops being entrant.
+bool Method::set_shared_code(methodHandle mh, nmethod* code) {
+  MutexLockerEx pl(Patching_lock, Mutex::_no_safepoint_check_flag);
+  assert(code->method() != mh(), "use set_code");
+
+  // The state of the nmethod only changes under the Patching_lock
+  if (mh->code() != NULL || !code->is_in_use()) {
+    return false;
+  }
+  guarantee(mh->adapter() != NULL, "Adapter blob must already exist!");
+
+  mh->_from_compiled_entry = code->verified_entry_point();
+  OrderAccess::storestore();
+  mh->_from_interpreted_entry = mh->get_i2c_entry();
+  return true;
+}
+
+void Method::clear_shared_code(nmethod* code, bool acquire_lock /* = true */) {
+  MutexLockerEx pl(acquire_lock ? Patching_lock : NULL, Mutex::_no_safepoint_check_flag);
+  // The method may have been compiled on its own in the meantime
+  if (_code == NULL && from_compiled_entry() == code->verified_entry_point()) {
+    clear_code(false /* already owns Patching_lock */);
+  }
+}
+
 
 bool Method::is_overridden_in(Klass* k) const {
   InstanceKlass* ik = InstanceKlass::cast(k);
@@ -448,6 +448,9 @@ class Method : public Metadata {
   nmethod* volatile code() const                 { assert( check_code(), "" ); return (nmethod *)OrderAccess::load_ptr_acquire(&_code); }
   void clear_code(bool acquire_lock = true);            // Clear out any compiled code
   static void set_code(methodHandle mh, nmethod* code);
+  // Run the code of an equivalent method without owning it (see lambdaFormSharing.hpp)
+  static bool set_shared_code(methodHandle mh, nmethod* code);
+  void clear_shared_code(nmethod* code, bool acquire_lock = true);
   void set_adapter_entry(AdapterHandlerEntry* adapter) {  _adapter = adapter; }
   address get_i2c_entry();
   address get_c2i_entry();
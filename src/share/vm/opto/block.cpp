@@ -1488,6 +1488,12 @@ void PhaseBlockLayout::union_traces(Trace* updated_trace, Trace* old_trace) {
   traces[hi_id] = NULL;
 }
 
+// Hot and cold blocks are kept in separate traces so that the cold
+// traces can be laid out after all the hot ones.
+bool PhaseBlockLayout::crosses_cold_boundary(CFGEdge *e) const {
+  return BlockLayoutSplitColdBlocks && is_cold(e->from()) != is_cold(e->to());
+}
+
 // Append traces together via the most frequently executed edges
 void PhaseBlockLayout::grow_traces() {
   // Order the edges, and drive the growth of Traces via the most
@@ -1515,6 +1521,9 @@ void PhaseBlockLayout::grow_traces() {
     // If the edge in question can join two traces at their ends,
     // append one trace to the other.
    if (src_trace->last_block() == src_block) {
+      if (src_trace != targ_trace && crosses_cold_boundary(e)) {
+        continue;
+      }
       if (src_trace == targ_trace) {
         e->set_state(CFGEdge::interior);
         if (targ_trace->backedge(e)) {
@@ -1558,6 +1567,10 @@ void PhaseBlockLayout::merge_traces(bool fall_thru_only) {
       continue;
     }
 
+    if (crosses_cold_boundary(e)) {
+      continue;
+    }
+
     if (fall_thru_only) {
       // If the edge links the middle of two traces, we can't do anything.
       // Mark the edge and continue.
@@ -1628,6 +1641,24 @@ void PhaseBlockLayout::reorder_traces(int count) {
   // Sort the new trace list by frequency
   qsort(new_traces + 1, new_count - 1, sizeof(new_traces[0]), trace_frequency_order);
 
+  if (BlockLayoutSplitColdBlocks) {
+    // Move the cold traces after all the hot ones, keeping the
+    // frequency order within each group and the connector blocks last.
+    Trace ** sorted = NEW_ARENA_ARRAY(area, Trace *, new_count);
+    int sorted_count = 0;
+    for (int pass = 0; pass < 3; pass++) {
+      for (int i = 0; i < new_count; i++) {
+        Block *b = new_traces[i]->first_block();
+        int group = b->is_connector() ? 2 : (is_cold(b) ? 1 : 0);
+        if (group == pass) {
+          sorted[sorted_count++] = new_traces[i];
+        }
+      }
+    }
+    assert(sorted_count == new_count && sorted[0] == new_traces[0], "entry trace misplaced");
+    new_traces = sorted;
+  }
+
   // Patch up the successor blocks
   _cfg.clear_blocks();
   for (int i = 0; i < new_count; i++) {
@@ -1653,6 +1684,14 @@ PhaseBlockLayout::PhaseBlockLayout(PhaseCFG &cfg)
   memset(next,   0, size*sizeof(Block *));
   prev = NEW_ARENA_ARRAY(area, Block *, size);
   memset(prev  , 0, size*sizeof(Block *));
+  cold = NEW_ARENA_ARRAY(area, bool, size);
+  memset(cold  , 0, size*sizeof(bool));
+  if (BlockLayoutSplitColdBlocks) {
+    for (uint i = 0; i < _cfg.number_of_blocks(); i++) {
+      Block *b = _cfg.get_block(i);
+      cold[b->_pre_order] = !b->is_connector() && _cfg.is_uncommon(b);
+    }
+  }
 
   // List of edges
   edges = new GrowableArray<CFGEdge*>;
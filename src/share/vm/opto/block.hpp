@@ -862,12 +862,21 @@ class PhaseBlockLayout : public Phase {
   Trace **traces;
   Block **next;
   Block **prev;
+  bool *cold;
   UnionFind *uf;
 
   // Given a block, find its encompassing Trace
   Trace * trace(Block *b) {
     return traces[uf->Find_compress(b->_pre_order)];
   }
+
+  // Is the block laid out with the rarely executed code of the method?
+  bool is_cold(Block *b) const {
+    return cold[b->_pre_order];
+  }
+
+  // Does the edge go between frequently and rarely executed code?
+  bool crosses_cold_boundary(CFGEdge *e) const;
  public:
   PhaseBlockLayout(PhaseCFG &cfg);
 
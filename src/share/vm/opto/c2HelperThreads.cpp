@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2016, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "opto/c2HelperThreads.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/orderAccess.inline.hpp"
+#include "runtime/os.hpp"
+#include "utilities/log.hpp"
+
+WorkGang*     C2HelperThreads::_gang = NULL;
+volatile jint C2HelperThreads::_busy = 0;
+
+C2ParallelTask::C2ParallelTask(const char* name, uint size) :
+  AbstractGangTask(name),
+  _phase(name),
+  _size(size),
+  // A few chunks per thread, so that the threads finish close together
+  _chunk_size(MAX2(size / (uint)(4 * (C2HelperThreadCount + 1)), (uint)64)),
+  _next_chunk(0) {
+}
+
+void C2ParallelTask::work(uint worker_id) {
+  for (;;) {
+    uint begin = (uint)(Atomic::add(1, &_next_chunk) - 1) * _chunk_size;
+    if (begin >= _size) {
+      return;
+    }
+    do_range(begin, MIN2(begin + _chunk_size, _size));
+  }
+}
+
+void C2HelperThreads::initialize() {
+  // Leave at least one CPU to the compiler thread itself
+  uint count = MIN2((uint)C2HelperThreadCount, (uint)MAX2(os::active_processor_count() - 1, 0));
+  if (count == 0) {
+    return;
+  }
+  WorkGang* gang = new WorkGang("C2 Helper Thread", count, false, false);
+  if (gang->initialize_workers()) {
+    _gang = gang;
+  }
+}
+
+bool C2HelperThreads::run(C2ParallelTask* task) {
+  if (_gang == NULL || Atomic::cmpxchg(1, &_busy, 0) != 0) {
+    return false;
+  }
+  _gang->run_task(task);
+  OrderAccess::release_store(&_busy, 0);
+  if (Log::is_enabled(LogTag::compilation, LogLevel::debug)) {
+    Log::print(LogTag::compilation, LogLevel::debug, "%s split %u items across %u C2 helper threads",
+               task->phase(), task->size(), _gang->total_workers());
+  }
+  return true;
+}
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2016, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_VM_OPTO_C2HELPERTHREADS_HPP
+#define SHARE_VM_OPTO_C2HELPERTHREADS_HPP
+
+#include "memory/allocation.hpp"
+#include "utilities/workgroup.hpp"
+
+// Helper threads for a single C2 compilation
+//
+// Some loops of C2 only read shared compiler data and write the entry they
+// are working on, e.g. one live range.  For a large method such a loop can
+// be wrapped in a C2ParallelTask and split into chunks that run on a small
+// gang of helper threads, shared by all C2 compiler threads.  The helper
+// threads have no ciEnv and no Compile::current(), so the work must neither
+// allocate from the compilation's arenas nor modify shared structures such
+// as IndexSets.
+
+class C2ParallelTask : public AbstractGangTask {
+ private:
+  const char*   _phase;       // name of the phase, also in product builds
+  const uint    _size;        // number of work items
+  const uint    _chunk_size;  // items claimed at a time
+  volatile jint _next_chunk;
+
+ protected:
+  // Processes the items [begin, end)
+  virtual void do_range(uint begin, uint end) = 0;
+
+ public:
+  C2ParallelTask(const char* name, uint size);
+
+  const char* phase() const { return _phase; }
+  uint size() const         { return _size; }
+
+  void work(uint worker_id);
+};
+
+class C2HelperThreads : AllStatic {
+ private:
+  static WorkGang*     _gang;
+  static volatile jint _busy;   // a compiler thread is running a task on the gang
+
+ public:
+  // Starts the helper threads; called once when C2 is initialized
+  static void initialize();
+
+  // Is a phase over this many items worth splitting?
+  static bool should_split(uint size) {
+    return _gang != NULL && size >= C2ParallelPhaseThreshold;
+  }
+
+  // Runs the task on the helper threads and returns true, or returns false
+  // without running it if another compilation is using them.  The caller
+  // then does the work itself.  Each run is logged at compilation=debug.
+  static bool run(C2ParallelTask* task);
+};
+
+#endif // SHARE_VM_OPTO_C2HELPERTHREADS_HPP
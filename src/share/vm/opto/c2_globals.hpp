@@ -315,12 +315,23 @@
   product(bool, LoopUnswitching, true,                                      \
           "Enable loop unswitching (a form of invariant test hoisting)")    \
                                                                             \
+  product(intx, LoopUnswitchingNodeBudget, 4000,                            \
+          "Maximum estimated number of nodes in all the versions of a "     \
+          "loop created by unswitching it")                                 \
+                                                                            \
   notproduct(bool, TraceLoopUnswitching, false,                             \
           "Trace loop unswitching")                                         \
                                                                             \
   product(bool, UseSuperWord, true,                                         \
           "Transform scalar operations into superword operations")          \
                                                                             \
+  product(bool, SuperWordReductions, true,                                  \
+          "Transform reduction cycles into vector reductions in superword") \
+                                                                            \
+  product(bool, VectorizePostLoops, true,                                   \
+          "Insert a vectorized post loop before the scalar post loop of "   \
+          "superword main loops")                                           \
+                                                                            \
   develop(bool, SuperWordRTDepCheck, false,                                 \
           "Enable runtime dependency checks.")                              \
                                                                             \
@@ -369,6 +380,10 @@
   product(bool, UseOnlyInlinedBimorphic, true,                              \
           "Don't use BimorphicInlining if can't inline a second method")    \
                                                                             \
+  product(bool, UsePolymorphicInlining, true,                               \
+          "Profiling based inlining for more than one receiver at "         \
+          "polymorphic call sites")                                         \
+                                                                            \
   product(bool, InsertMemBarAfterArraycopy, true,                           \
           "Insert memory barrier after arraycopy call")                     \
                                                                             \
@@ -488,12 +503,20 @@
   product(bool, EliminateAllocations, true,                                 \
           "Use escape analysis to eliminate allocations")                   \
                                                                             \
+  product(bool, ReduceAllocationMerges, true,                               \
+          "Split field loads through phis which merge only non-escaping "   \
+          "allocations so that the allocations can be scalar replaced")     \
+                                                                            \
   notproduct(bool, PrintEliminateAllocations, false,                        \
           "Print out when allocations are eliminated")                      \
                                                                             \
   product(intx, EliminateAllocationArraySizeLimit, 64,                      \
           "Array size (number of elements) limit for scalar replacement")   \
                                                                             \
+  product(bool, EliminateBoundedLengthArrays, true,                         \
+          "Scalar replace arrays whose length is not constant but is "      \
+          "bounded by dominating compares")                                 \
+                                                                            \
   product(bool, OptimizePtrCompare, true,                                   \
           "Use escape analysis to optimize pointers compare")               \
                                                                             \
@@ -531,6 +554,10 @@
   product(bool, BlockLayoutRotateLoops, true,                               \
           "Allow back branches to be fall throughs in the block layour")    \
                                                                             \
+  product(bool, BlockLayoutSplitColdBlocks, true,                           \
+          "Lay out uncommon blocks after all the frequently executed "      \
+          "code of a method")                                               \
+                                                                            \
   develop(bool, InlineReflectionGetCallerClass, true,                       \
           "inline sun.reflect.Reflection.getCallerClass(), known to be part "\
           "of base library DLL")                                            \
@@ -599,6 +626,10 @@
   product(intx, TypeProfileMajorReceiverPercent, 90,                        \
           "% of major receiver type to all profiled receivers")             \
                                                                             \
+  product(intx, TypeProfilePolymorphicPercent, 90,                          \
+          "% of all profiled receivers the receiver types inlined at a "    \
+          "polymorphic call site must cover")                               \
+                                                                            \
   notproduct(bool, TimeCompiler2, false,                                    \
           "detailed time the compiler (requires +TimeCompiler)")            \
                                                                             \
@@ -674,9 +705,26 @@
   product(bool, UseMontgomerySquareIntrinsic, false,                        \
           "Enables intrinsification of BigInteger.montgomerySquare()")      \
                                                                             \
+  product(bool, UseVectorizedMismatchIntrinsic, false,                      \
+          "Enables intrinsification of Arrays.equals() for primitive "      \
+          "arrays other than char[] using a vectorized mismatch stub")      \
+                                                                            \
   product(bool, UseTypeSpeculation, true,                                   \
           "Speculatively propagate types from profiles")                    \
                                                                             \
+  product(uintx, C2HelperThreadCount, 2,                                    \
+          "Maximum number of helper threads that split phases of a C2 "     \
+          "compilation of a large method; at most one less than the "       \
+          "number of CPUs is used (0 means none)")                          \
+                                                                            \
+  product(uintx, C2ParallelPhaseThreshold, 20000,                           \
+          "Minimum number of work items, e.g. live ranges, for which a "    \
+          "C2 phase is split across the helper threads")                    \
+                                                                            \
+  product(bool, UseParameterProfileAtOSR, true,                             \
+          "Propagate the parameter type profile at an OSR entry for "       \
+          "parameters the method never stores to")                          \
+                                                                            \
   diagnostic(bool, UseInlineDepthForSpeculativeTypes, true,                 \
           "Carry inline depth of profile point with speculative type "      \
           "and give priority to profiling from lower inline depth")         \
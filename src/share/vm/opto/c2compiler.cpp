@@ -23,6 +23,7 @@
  */
 
 #include "precompiled.hpp"
+#include "opto/c2HelperThreads.hpp"
 #include "opto/c2compiler.hpp"
 #include "opto/runtime.hpp"
 #if defined AD_MD_HPP
@@ -83,6 +84,8 @@ bool C2Compiler::init_c2_runtime() {
 
   Compile::pd_compiler2_init();
 
+  C2HelperThreads::initialize();
+
   CompilerThread* thread = CompilerThread::current();
 
   HandleMark handle_mark(thread);
@@ -1187,13 +1187,15 @@ SafePointScalarObjectNode::SafePointScalarObjectNode(const TypeOopPtr* tp,
                                                      AllocateNode* alloc,
 #endif
                                                      uint first_index,
-                                                     uint n_fields) :
+                                                     uint n_fields,
+                                                     bool has_length) :
   TypeNode(tp, 1), // 1 control input -- seems required.  Get from root.
 #ifdef ASSERT
   _alloc(alloc),
 #endif
   _first_index(first_index),
-  _n_fields(n_fields)
+  _n_fields(n_fields),
+  _has_length(has_length)
 {
   init_class_id(Class_SafePointScalarObject);
 }
@@ -1349,6 +1351,72 @@ Node *AllocateArrayNode::make_ideal_length(const TypeOopPtr* oop_type, PhaseTran
   return length;
 }
 
+int AllocateArrayNode::length_bound(PhaseTransform* phase) {
+  Node* length = Ideal_length();
+  const TypeInt* t = phase->type(length)->isa_int();
+  if (t == NULL) {
+    return -1;
+  }
+  jint lo = t->_lo;
+  jint hi = t->_hi;
+  if (EliminateBoundedLengthArrays) {
+    // Walk up the straight-line control above the allocation and narrow the
+    // range with the compares of the length against constants which guard it.
+    Node* ctrl = in(TypeFunc::Control);
+    for (int steps = 0; steps < 100 && ctrl != NULL &&
+                        (lo < 0 || hi > EliminateAllocationArraySizeLimit); steps++) {
+      if (ctrl->is_Region() || ctrl->is_Start() || ctrl->is_top()) {
+        break;
+      }
+      if ((ctrl->Opcode() == Op_IfTrue || ctrl->Opcode() == Op_IfFalse) &&
+          ctrl->in(0)->in(1)->is_Bool()) {
+        BoolNode* bol = ctrl->in(0)->in(1)->as_Bool();
+        Node* cmp = bol->in(1);
+        BoolTest::mask btest = bol->_test._test;
+        if (ctrl->Opcode() == Op_IfFalse) {
+          btest = BoolTest(btest).negate();
+        }
+        if (cmp->Opcode() == Op_CmpI || cmp->Opcode() == Op_CmpU) {
+          Node* val = cmp->in(1);
+          const TypeInt* tcon = phase->type(cmp->in(2))->isa_int();
+          if (val->uncast() != length->uncast()) {
+            val  = cmp->in(2);
+            tcon = phase->type(cmp->in(1))->isa_int();
+            btest = BoolTest(btest).commute();
+          }
+          if (val->uncast() == length->uncast() && tcon != NULL && tcon->is_con()) {
+            jint con = tcon->get_con();
+            if (cmp->Opcode() == Op_CmpU) {
+              // An unsigned compare against a non-negative constant bounds
+              // the value from both sides ("range check").
+              if (con >= 0 && (btest == BoolTest::lt || btest == BoolTest::le)) {
+                lo = MAX2(lo, 0);
+              } else {
+                btest = BoolTest::illegal;
+              }
+            }
+            switch (btest) {
+            case BoolTest::eq: lo = MAX2(lo, con); hi = MIN2(hi, con); break;
+            case BoolTest::le: hi = MIN2(hi, con); break;
+            case BoolTest::ge: lo = MAX2(lo, con); break;
+            case BoolTest::lt: if (con > min_jint) hi = MIN2(hi, con - 1); break;
+            case BoolTest::gt: if (con < max_jint) lo = MAX2(lo, con + 1); break;
+            default: break;
+            }
+          }
+        }
+      }
+      ctrl = ctrl->in(0);
+    }
+  } else if (!t->is_con()) {
+    return -1;
+  }
+  if (lo < 0 || lo > hi) {
+    return -1;
+  }
+  return hi;
+}
+
 //=============================================================================
 uint LockNode::size_of() const { return sizeof(*this); }
 
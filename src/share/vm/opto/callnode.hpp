@@ -488,6 +488,8 @@ class SafePointScalarObjectNode: public TypeNode {
                      // states of the scalarized object fields are collected.
                      // It is relative to the last (youngest) jvms->_scloff.
   uint _n_fields;    // Number of non-static fields of the scalarized object.
+  bool _has_length;  // The first field input is the length of a scalarized
+                     // array whose length is not constant.
   DEBUG_ONLY(AllocateNode* _alloc;)
 
   virtual uint hash() const ; // { return NO_HASH; }
@@ -500,7 +502,8 @@ public:
 #ifdef ASSERT
                             AllocateNode* alloc,
 #endif
-                            uint first_index, uint n_fields);
+                            uint first_index, uint n_fields,
+                            bool has_length = false);
   virtual int Opcode() const;
   virtual uint           ideal_reg() const;
   virtual const RegMask &in_RegMask(uint) const;
@@ -512,6 +515,7 @@ public:
     return jvms->scloff() + _first_index;
   }
   uint n_fields()    const { return _n_fields; }
+  bool has_length()  const { return _has_length; }
 
 #ifdef ASSERT
   AllocateNode* alloc() const { return _alloc; }
@@ -924,6 +928,11 @@ public:
   // type with a CastII, if necesssary
   Node* make_ideal_length(const TypeOopPtr* ary_type, PhaseTransform *phase, bool can_create = true);
 
+  // Upper bound of the array length: the length itself if it is constant,
+  // otherwise the bound implied by its type and by compares of the length
+  // which dominate the allocation. Return -1 if the length may be negative.
+  int length_bound(PhaseTransform* phase);
+
   // Pattern-match a possible usage of AllocateArrayNode.
   // Return null if no allocation is recognized.
   static AllocateArrayNode* Ideal_array_allocation(Node* ptr, PhaseTransform* phase) {
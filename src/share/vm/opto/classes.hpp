@@ -300,6 +300,19 @@ macro(URShiftVL)
 macro(AndV)
 macro(OrV)
 macro(XorV)
+macro(AddReductionVI)
+macro(AddReductionVL)
+macro(AddReductionVF)
+macro(AddReductionVD)
+macro(MulReductionVI)
+macro(MulReductionVF)
+macro(MulReductionVD)
+macro(AndReductionVI)
+macro(AndReductionVL)
+macro(OrReductionVI)
+macro(OrReductionVL)
+macro(XorReductionVI)
+macro(XorReductionVL)
 macro(LoadVector)
 macro(StoreVector)
 macro(Pack)
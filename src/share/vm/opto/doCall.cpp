@@ -223,6 +223,14 @@ CallGenerator* Compile::call_generator(ciMethod* callee, int vtable_index, bool
           speculative_receiver_type = NULL;
         }
       }
+      if (receiver_method == NULL && UsePolymorphicInlining &&
+          !have_major_receiver && morphism != 1 && morphism != 2 &&
+          profile.has_receiver(1)) {
+        // No single receiver dominates: try a type switch over the
+        // hottest ones.  Bimorphic sites are left to UseBimorphicInlining.
+        CallGenerator* cg = polymorphic_call_generator(callee, vtable_index, jvms, profile, prof_factor);
+        if (cg != NULL)  return cg;
+      }
       if (receiver_method == NULL &&
           (have_major_receiver || morphism == 1 ||
            (morphism == 2 && UseBimorphicInlining))) {
@@ -308,6 +316,72 @@ CallGenerator* Compile::call_generator(ciMethod* callee, int vtable_index, bool
   }
 }
 
+// Build a chain of type checks over the most frequent receivers of a
+// call site which has no major receiver.  The receivers are tested in
+// profile order and taken until they cover TypeProfilePolymorphicPercent
+// of the site count; each of them must be inlinable.  The remaining
+// receivers go through a virtual call, or an uncommon trap if the
+// profile saw no other receiver type.  Returns NULL if the receivers
+// that can be handled this way do not cover enough of the profile.
+CallGenerator* Compile::polymorphic_call_generator(ciMethod* callee, int vtable_index, JVMState* jvms,
+                                                   ciCallProfile& profile, float prof_factor) {
+  ciMethod* caller = jvms->method();
+  int       bci    = jvms->bci();
+  int site_count   = profile.count();
+
+  CallGenerator* hit_cg[ciCallProfile::MorphismLimit];
+  ciMethod*      hit_method[ciCallProfile::MorphismLimit];
+  int n = 0;
+  int covered = 0;
+  while (n < ciCallProfile::MorphismLimit && profile.has_receiver(n) &&
+         100.0 * covered < (double)TypeProfilePolymorphicPercent * site_count) {
+    ciMethod* receiver_method = callee->resolve_invoke(caller->holder(), profile.receiver(n));
+    if (receiver_method == NULL) {
+      break;
+    }
+    CallGenerator* cg = call_generator(receiver_method, vtable_index, false, jvms, true, prof_factor);
+    if (cg == NULL || !(cg->is_inline() || cg->is_late_inline())) {
+      // A type check in front of a call does not pay off
+      break;
+    }
+    hit_cg[n] = cg;
+    hit_method[n] = receiver_method;
+    covered += profile.receiver_count(n);
+    n++;
+  }
+  if (n < 2 || 100.0 * covered < (double)TypeProfilePolymorphicPercent * site_count) {
+    return NULL;
+  }
+
+  CallGenerator* miss_cg;
+  if (profile.morphism() == n && !too_many_traps(caller, bci, Deoptimization::Reason_class_check)) {
+    // Every receiver type seen so far is handled by the type switch
+    miss_cg = CallGenerator::for_uncommon_trap(callee, Deoptimization::Reason_class_check,
+                                               Deoptimization::Action_maybe_recompile);
+  } else {
+    miss_cg = CallGenerator::for_virtual_call(callee, vtable_index);
+  }
+  if (miss_cg == NULL) {
+    return NULL;
+  }
+
+  // The probability of each check is conditional on the previous ones failing
+  int remaining = site_count - covered;
+  CallGenerator* cg = miss_cg;
+  for (int i = n - 1; i >= 0; i--) {
+    int receiver_count = profile.receiver_count(i);
+    remaining += receiver_count;
+    float hit_prob = (remaining > 0) ? (float)receiver_count / remaining : PROB_FAIR;
+    hit_prob = MIN2(MAX2(hit_prob, PROB_MIN), PROB_MAX);
+    trace_type_profile(this, caller, jvms->depth() - 1, bci, hit_method[i], profile.receiver(i), site_count, receiver_count);
+    cg = CallGenerator::for_predicted_call(profile.receiver(i), cg, hit_cg[i], hit_prob);
+    if (cg == NULL) {
+      return NULL;
+    }
+  }
+  return cg;
+}
+
 // Return true for methods that shouldn't be inlined early so that
 // they are easier to analyze and optimize as intrinsics.
 bool Compile::should_delay_string_inlining(ciMethod* call_method, JVMState* jvms) {
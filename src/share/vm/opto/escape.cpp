@@ -90,6 +90,9 @@ void ConnectionGraph::do_analysis(Compile *C, PhaseIterGVN *igvn) {
   // to create space for them in ConnectionGraph::_nodes[].
   Node* oop_null = igvn->zerocon(T_OBJECT);
   Node* noop_null = igvn->zerocon(T_NARROWOOP);
+  if (ReduceAllocationMerges && EliminateAllocations) {
+    reduce_allocation_merges(C, igvn);
+  }
   ConnectionGraph* congraph = new(C->comp_arena()) ConnectionGraph(C, igvn);
   // Perform escape analysis
   if (congraph->compute_escape()) {
@@ -103,6 +106,125 @@ void ConnectionGraph::do_analysis(Compile *C, PhaseIterGVN *igvn) {
     igvn->hash_delete(noop_null);
 }
 
+// The flow-insensitive analysis below marks objects which are merged
+// by a Phi as not scalar replaceable (see adjust_scalar_replaceable_state()),
+// even when the objects never escape on any path:
+//
+//    Point p = flag ? new Point(x, 0) : new Point(0, y);
+//    return p.x + p.y;
+//
+// When every input of such a Phi is a fresh instance allocation and the
+// Phi is used only as the base of field loads, clone each load into the
+// predecessor paths of the merge and replace it by a Phi of the cloned
+// loads. The allocations are then no longer merged and may be scalar
+// replaced separately. Phis which are referenced by safepoints, stores,
+// pointer compares or calls are left alone.
+bool ConnectionGraph::can_reduce_phi(PhiNode* phi, PhaseIterGVN* igvn) {
+  Node* region = phi->in(0);
+  if (region == NULL || !region->is_Region() || region->is_Loop() ||
+      phi->req() < 3 || !phi->bottom_type()->isa_instptr()) {
+    return false;
+  }
+  for (uint i = 1; i < phi->req(); i++) {
+    Node* in = phi->in(i);
+    if (in == NULL || in->is_top() || region->in(i) == NULL || region->in(i)->is_top()) {
+      return false;
+    }
+    AllocateNode* alloc = AllocateNode::Ideal_allocation(in, igvn);
+    if (alloc == NULL || alloc->is_AllocateArray() || in != alloc->result_cast()) {
+      return false;
+    }
+  }
+  for (DUIterator_Fast imax, i = phi->fast_outs(imax); i < imax; i++) {
+    Node* addp = phi->fast_out(i);
+    if (!addp->is_AddP() ||
+        addp->in(AddPNode::Base) != phi ||
+        addp->in(AddPNode::Address) != phi ||
+        !addp->in(AddPNode::Offset)->is_Con()) {
+      return false;
+    }
+    for (DUIterator_Fast jmax, j = addp->fast_outs(jmax); j < jmax; j++) {
+      Node* load = addp->fast_out(j);
+      if (!load->is_Load() || load->in(MemNode::Address) != addp) {
+        return false;
+      }
+      // The memory seen by the load must be either merged by the same
+      // region or available on every incoming path.
+      Node* mem = load->in(MemNode::Memory);
+      if (!(mem->is_Phi() && mem->in(0) == region) &&
+          !MemNode::all_controls_dominate(mem, region)) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+void ConnectionGraph::reduce_phi(PhiNode* phi, PhaseIterGVN* igvn) {
+  Compile* C = igvn->C;
+  Node* region = phi->in(0);
+  NOT_PRODUCT(uint phi_idx = phi->_idx;)
+  Unique_Node_List loads;
+  for (DUIterator_Fast imax, i = phi->fast_outs(imax); i < imax; i++) {
+    Node* addp = phi->fast_out(i);
+    for (DUIterator_Fast jmax, j = addp->fast_outs(jmax); j < jmax; j++) {
+      loads.push(addp->fast_out(j));
+    }
+  }
+  for (uint k = 0; k < loads.size(); k++) {
+    Node* load = loads.at(k);
+    Node* mem  = load->in(MemNode::Memory);
+    Node* offset = load->in(MemNode::Address)->in(AddPNode::Offset);
+    PhiNode* value_phi = new (C) PhiNode(region, load->bottom_type());
+    for (uint i = 1; i < region->req(); i++) {
+      Node* base = phi->in(i);
+      Node* x = load->clone();
+      x->set_req(MemNode::Control, (load->in(MemNode::Control) == region) ? region->in(i) : NULL);
+      if (mem->is_Phi() && mem->in(0) == region) {
+        x->set_req(MemNode::Memory, mem->in(i));
+      }
+      Node* adr = new (C) AddPNode(base, base, offset);
+      igvn->register_new_node_with_optimizer(adr);
+      x->set_req(MemNode::Address, adr);
+      igvn->register_new_node_with_optimizer(x);
+      value_phi->init_req(i, x);
+    }
+    igvn->register_new_node_with_optimizer(value_phi);
+    igvn->replace_node(load, value_phi);
+  }
+#ifndef PRODUCT
+  if (PrintEliminateAllocations) {
+    tty->print_cr("=== Split %d field load(s) through allocation merge %d", loads.size(), phi_idx);
+  }
+#endif
+}
+
+void ConnectionGraph::reduce_allocation_merges(Compile* C, PhaseIterGVN* igvn) {
+  Unique_Node_List phis;
+  for (int i = 0; i < C->macro_count(); i++) {
+    Node* n = C->macro_node(i);
+    if (!n->is_Allocate() || n->is_AllocateArray()) {
+      continue;
+    }
+    Node* res = n->as_Allocate()->result_cast();
+    if (res == NULL) {
+      continue;
+    }
+    for (DUIterator_Fast jmax, j = res->fast_outs(jmax); j < jmax; j++) {
+      Node* use = res->fast_out(j);
+      if (use->is_Phi()) {
+        phis.push(use);
+      }
+    }
+  }
+  for (uint i = 0; i < phis.size(); i++) {
+    PhiNode* phi = phis.at(i)->as_Phi();
+    if (phi->outcnt() > 0 && can_reduce_phi(phi, igvn)) {
+      reduce_phi(phi, igvn);
+    }
+  }
+}
+
 bool ConnectionGraph::compute_escape() {
   Compile* C = _compile;
   PhaseGVN* igvn = _igvn;
@@ -785,9 +907,9 @@ void ConnectionGraph::add_call_node(CallNode* call) {
       if (!cik->is_array_klass()) { // StressReflectiveCode
         es = PointsToNode::GlobalEscape;
       } else {
-        int length = call->in(AllocateNode::ALength)->find_int_con(-1);
+        int length = call->as_AllocateArray()->length_bound(_igvn);
         if (length < 0 || length > EliminateAllocationArraySizeLimit) {
-          // Not scalar replaceable if the length is not constant or too big.
+          // Not scalar replaceable if the length is not bounded or too big.
           scalar_replaceable = false;
         }
       }
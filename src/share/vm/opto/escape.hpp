@@ -582,6 +582,11 @@ private:
   // Compute the escape information
   bool compute_escape();
 
+  // Split field loads through phis of allocations before the graph is built
+  static bool can_reduce_phi(PhiNode* phi, PhaseIterGVN* igvn);
+  static void reduce_phi(PhiNode* phi, PhaseIterGVN* igvn);
+  static void reduce_allocation_merges(Compile* C, PhaseIterGVN* igvn);
+
 public:
   ConnectionGraph(Compile *C, PhaseIterGVN *igvn);
 
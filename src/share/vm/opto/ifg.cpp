@@ -26,6 +26,7 @@
 #include "compiler/oopMap.hpp"
 #include "memory/allocation.inline.hpp"
 #include "opto/addnode.hpp"
+#include "opto/c2HelperThreads.hpp"
 #include "opto/block.hpp"
 #include "opto/callnode.hpp"
 #include "opto/cfgnode.hpp"
@@ -104,10 +105,31 @@ void PhaseIFG::SquareUp() {
   _is_square = true;
 }
 
+// Computes the effective degree of a range of live ranges. Each live range
+// only writes its own degree, so the ranges can run on helper threads.
+class ComputeEffectiveDegreeTask : public C2ParallelTask {
+  PhaseIFG* _ifg;
+ protected:
+  void do_range(uint begin, uint end) {
+    for (uint i = begin; i < end; i++) {
+      _ifg->lrgs(i).set_degree(_ifg->effective_degree(i));
+    }
+  }
+ public:
+  ComputeEffectiveDegreeTask(PhaseIFG* ifg) :
+    C2ParallelTask("Compute_Effective_Degree", ifg->_maxlrg), _ifg(ifg) { }
+};
+
 // Compute effective degree in bulk
 void PhaseIFG::Compute_Effective_Degree() {
   assert( _is_square, "only on square" );
 
+  if (C2HelperThreads::should_split(_maxlrg)) {
+    ComputeEffectiveDegreeTask task(this);
+    if (C2HelperThreads::run(&task)) {
+      return;
+    }
+  }
   for( uint i = 0; i < _maxlrg; i++ )
     lrgs(i).set_degree(effective_degree(i));
 }
@@ -192,7 +214,9 @@ int PhaseIFG::effective_degree( uint lidx ) const {
   int eff = 0;
   int num_regs = lrgs(lidx).num_regs();
   int fat_proj = lrgs(lidx)._fat_proj;
-  IndexSet *s = neighbors(lidx);
+  // Iterate the set as const: a plain iterator frees the empty blocks
+  // it passes, which helper threads must not do
+  const IndexSet *s = neighbors(lidx);
   IndexSetIterator elements(s);
   uint nidx;
   while((nidx = elements.next()) != 0) {
@@ -195,6 +195,7 @@ class LibraryCallKit : public GraphKit {
     return generate_method_call(method_id, true, false);
   }
   Node * load_field_from_object(Node * fromObj, const char * fieldName, const char * fieldTypeString, bool is_exact, bool is_static);
+  Node * field_address_from_object(Node * fromObj, const char * fieldName, const char * fieldTypeString, bool is_exact, bool is_static);
 
   Node* make_string_method_node(int opcode, Node* str1_start, Node* cnt1, Node* str2_start, Node* cnt2);
   Node* make_string_method_node(int opcode, Node* str1, Node* str2);
@@ -249,6 +250,7 @@ class LibraryCallKit : public GraphKit {
   bool inline_native_getLength();
   bool inline_array_copyOf(bool is_copyOfRange);
   bool inline_array_equals();
+  bool inline_array_equals_mismatch(BasicType elem_type);
   void copy_to_clone(Node* obj, Node* alloc_obj, Node* obj_size, bool is_array, bool card_mark);
   bool inline_native_clone(bool is_virtual);
   bool inline_native_Reflection_getCallerClass();
@@ -309,8 +311,11 @@ class LibraryCallKit : public GraphKit {
   bool inline_aescrypt_Block(vmIntrinsics::ID id);
   bool inline_cipherBlockChaining_AESCrypt(vmIntrinsics::ID id);
   Node* inline_cipherBlockChaining_AESCrypt_predicate(bool decrypting);
+  bool inline_counterMode_AESCrypt(vmIntrinsics::ID id);
+  Node* inline_counterMode_AESCrypt_predicate();
   Node* get_key_start_from_aescrypt_object(Node* aescrypt_object);
   Node* get_original_key_start_from_aescrypt_object(Node* aescrypt_object);
+  bool inline_ghash_processBlocks();
   bool inline_sha_implCompress(vmIntrinsics::ID id);
   bool inline_digestBase_implCompressMB(int predicate);
   bool inline_sha_implCompressMB(Node* digestBaseObj, ciInstanceKlass* instklass_SHA,
@@ -323,6 +328,10 @@ class LibraryCallKit : public GraphKit {
   bool inline_updateCRC32();
   bool inline_updateBytesCRC32();
   bool inline_updateByteBufferCRC32();
+  bool inline_updateBytesCRC32C();
+  bool inline_updateDirectByteBufferCRC32C();
+  bool inline_updateBytesAdler32();
+  bool inline_updateByteBufferAdler32();
   bool inline_multiplyToLen();
   bool inline_squareToLen();
   bool inline_mulAdd();
@@ -374,6 +383,11 @@ CallGenerator* Compile::make_vm_intrinsic(ciMethod* m, bool is_virtual) {
     case vmIntrinsics::_compareTo:
     case vmIntrinsics::_equals:
     case vmIntrinsics::_equalsC:
+    case vmIntrinsics::_equalsZ:
+    case vmIntrinsics::_equalsB:
+    case vmIntrinsics::_equalsS:
+    case vmIntrinsics::_equalsI:
+    case vmIntrinsics::_equalsJ:
     case vmIntrinsics::_getAndAddInt:
     case vmIntrinsics::_getAndAddLong:
     case vmIntrinsics::_getAndSetInt:
@@ -409,6 +423,14 @@ CallGenerator* Compile::make_vm_intrinsic(ciMethod* m, bool is_virtual) {
     if (!SpecialArraysEquals)  return NULL;
     if (!Matcher::match_rule_supported(Op_AryEq))  return NULL;
     break;
+  case vmIntrinsics::_equalsZ:
+  case vmIntrinsics::_equalsB:
+  case vmIntrinsics::_equalsS:
+  case vmIntrinsics::_equalsI:
+  case vmIntrinsics::_equalsJ:
+    if (!SpecialArraysEquals)  return NULL;
+    if (!UseVectorizedMismatchIntrinsic)  return NULL;
+    break;
   case vmIntrinsics::_arraycopy:
     if (!InlineArrayCopy)  return NULL;
     break;
@@ -553,6 +575,15 @@ CallGenerator* Compile::make_vm_intrinsic(ciMethod* m, bool is_virtual) {
     predicates = 1;
     break;
 
+  case vmIntrinsics::_counterMode_AESCrypt:
+    if (!UseAESCTRIntrinsics) return NULL;
+    predicates = 1;
+    break;
+
+  case vmIntrinsics::_ghash_processBlocks:
+    if (!UseGHASHIntrinsics) return NULL;
+    break;
+
   case vmIntrinsics::_sha_implCompress:
     if (!UseSHA1Intrinsics) return NULL;
     break;
@@ -576,6 +607,16 @@ CallGenerator* Compile::make_vm_intrinsic(ciMethod* m, bool is_virtual) {
     if (!UseCRC32Intrinsics) return NULL;
     break;
 
+  case vmIntrinsics::_updateBytesCRC32C:
+  case vmIntrinsics::_updateDirectByteBufferCRC32C:
+    if (!UseCRC32CIntrinsics) return NULL;
+    break;
+
+  case vmIntrinsics::_updateBytesAdler32:
+  case vmIntrinsics::_updateByteBufferAdler32:
+    if (!UseAdler32Intrinsics) return NULL;
+    break;
+
   case vmIntrinsics::_incrementExactI:
   case vmIntrinsics::_addExactI:
     if (!Matcher::match_rule_supported(Op_OverflowAddI) || !UseMathExactIntrinsics) return NULL;
@@ -893,6 +934,11 @@ bool LibraryCallKit::try_to_inline(int predicate) {
   case vmIntrinsics::_copyOf:                   return inline_array_copyOf(false);
   case vmIntrinsics::_copyOfRange:              return inline_array_copyOf(true);
   case vmIntrinsics::_equalsC:                  return inline_array_equals();
+  case vmIntrinsics::_equalsZ:                  return inline_array_equals_mismatch(T_BOOLEAN);
+  case vmIntrinsics::_equalsB:                  return inline_array_equals_mismatch(T_BYTE);
+  case vmIntrinsics::_equalsS:                  return inline_array_equals_mismatch(T_SHORT);
+  case vmIntrinsics::_equalsI:                  return inline_array_equals_mismatch(T_INT);
+  case vmIntrinsics::_equalsJ:                  return inline_array_equals_mismatch(T_LONG);
   case vmIntrinsics::_clone:                    return inline_native_clone(intrinsic()->is_virtual());
 
   case vmIntrinsics::_isAssignableFrom:         return inline_native_subtype_check();
@@ -935,6 +981,12 @@ bool LibraryCallKit::try_to_inline(int predicate) {
   case vmIntrinsics::_cipherBlockChaining_decryptAESCrypt:
     return inline_cipherBlockChaining_AESCrypt(intrinsic_id());
 
+  case vmIntrinsics::_counterMode_AESCrypt:
+    return inline_counterMode_AESCrypt(intrinsic_id());
+
+  case vmIntrinsics::_ghash_processBlocks:
+    return inline_ghash_processBlocks();
+
   case vmIntrinsics::_sha_implCompress:
   case vmIntrinsics::_sha2_implCompress:
   case vmIntrinsics::_sha5_implCompress:
@@ -966,6 +1018,14 @@ bool LibraryCallKit::try_to_inline(int predicate) {
     return inline_updateBytesCRC32();
   case vmIntrinsics::_updateByteBufferCRC32:
     return inline_updateByteBufferCRC32();
+  case vmIntrinsics::_updateBytesCRC32C:
+    return inline_updateBytesCRC32C();
+  case vmIntrinsics::_updateDirectByteBufferCRC32C:
+    return inline_updateDirectByteBufferCRC32C();
+  case vmIntrinsics::_updateBytesAdler32:
+    return inline_updateBytesAdler32();
+  case vmIntrinsics::_updateByteBufferAdler32:
+    return inline_updateByteBufferAdler32();
 
   case vmIntrinsics::_profileBoolean:
     return inline_profileBoolean();
@@ -997,6 +1057,8 @@ Node* LibraryCallKit::try_to_predicate(int predicate) {
     return inline_cipherBlockChaining_AESCrypt_predicate(false);
   case vmIntrinsics::_cipherBlockChaining_decryptAESCrypt:
     return inline_cipherBlockChaining_AESCrypt_predicate(true);
+  case vmIntrinsics::_counterMode_AESCrypt:
+    return inline_counterMode_AESCrypt_predicate();
   case vmIntrinsics::_digestBase_implCompressMB:
     return inline_digestBase_implCompressMB_predicate(predicate);
 
@@ -2042,6 +2104,31 @@ bool LibraryCallKit::runtime_math(const TypeFunc* call_type, address funcAddr, c
 //------------------------------inline_math_native-----------------------------
 bool LibraryCallKit::inline_math_native(vmIntrinsics::ID id) {
 #define FN_PTR(f) CAST_FROM_FN_PTR(address, f)
+  // Prefer the platform's libm stubs: they are faster than the x87
+  // instructions and give the same results in every execution mode.
+  switch (id) {
+  case vmIntrinsics::_dexp:
+    if (StubRoutines::dexp() != NULL) return runtime_math(OptoRuntime::Math_D_D_Type(),  StubRoutines::dexp(), "dexp");
+    break;
+  case vmIntrinsics::_dlog:
+    if (StubRoutines::dlog() != NULL) return runtime_math(OptoRuntime::Math_D_D_Type(),  StubRoutines::dlog(), "dlog");
+    break;
+  case vmIntrinsics::_dpow:
+    if (StubRoutines::dpow() != NULL) return runtime_math(OptoRuntime::Math_DD_D_Type(), StubRoutines::dpow(), "dpow");
+    break;
+  case vmIntrinsics::_dsin:
+    if (StubRoutines::dsin() != NULL) return runtime_math(OptoRuntime::Math_D_D_Type(),  StubRoutines::dsin(), "dsin");
+    break;
+  case vmIntrinsics::_dcos:
+    if (StubRoutines::dcos() != NULL) return runtime_math(OptoRuntime::Math_D_D_Type(),  StubRoutines::dcos(), "dcos");
+    break;
+  case vmIntrinsics::_dtan:
+    if (StubRoutines::dtan() != NULL) return runtime_math(OptoRuntime::Math_D_D_Type(),  StubRoutines::dtan(), "dtan");
+    break;
+  default:
+    break;
+  }
+
   switch (id) {
     // These intrinsics are not properly supported on all hardware
   case vmIntrinsics::_dcos:   return Matcher::has_match_rule(Op_CosD)   ? inline_trig(id) :
@@ -6132,6 +6219,96 @@ bool LibraryCallKit::inline_montgomerySquare() {
   return true;
 }
 
+//------------------------inline_array_equals_mismatch------------------------
+// Arrays.equals() for boolean[], byte[], short[], int[] and long[] arrays.
+// The element compare is done by the vectorizedMismatch stub which returns
+// the index of the first mismatching element or -1 if there is none.
+bool LibraryCallKit::inline_array_equals_mismatch(BasicType elem_type) {
+  address stubAddr = StubRoutines::vectorizedMismatch();
+  if (stubAddr == NULL) {
+    return false; // Intrinsic's stub is not implemented on this platform
+  }
+  const char* stubName = "vectorizedMismatch";
+
+  Node* a = argument(0);
+  Node* b = argument(1);
+
+  // paths (plus control) merge
+  RegionNode* region = new (C) RegionNode(6);
+  Node* phi = new (C) PhiNode(region, TypeInt::BOOL);
+
+  // does a == b (including both null)?
+  Node* cmp = _gvn.transform(new (C) CmpPNode(a, b));
+  Node* bol = _gvn.transform(new (C) BoolNode(cmp, BoolTest::eq));
+  Node* if_eq = generate_slow_guard(bol, NULL);
+  if (if_eq != NULL) {
+    phi->init_req(2, intcon(1));
+    region->init_req(2, if_eq);
+  }
+
+  // is either array null?
+  if (!stopped()) {
+    Node* a_null = generate_guard(_gvn.transform(new (C) BoolNode(_gvn.transform(new (C) CmpPNode(a, null())), BoolTest::eq)),
+                                  NULL, PROB_MIN);
+    if (a_null != NULL) {
+      phi->init_req(3, intcon(0));
+      region->init_req(3, a_null);
+    }
+  }
+  if (!stopped()) {
+    Node* b_null = generate_guard(_gvn.transform(new (C) BoolNode(_gvn.transform(new (C) CmpPNode(b, null())), BoolTest::eq)),
+                                  NULL, PROB_MIN);
+    if (b_null != NULL) {
+      phi->init_req(4, intcon(0));
+      region->init_req(4, b_null);
+    }
+  }
+
+  if (!stopped()) {
+    a = cast_not_null(a, false);
+    b = cast_not_null(b, false);
+
+    // do the lengths differ?
+    Node* a_len = load_array_length(a);
+    Node* b_len = load_array_length(b);
+    Node* cmp = _gvn.transform(new (C) CmpINode(a_len, b_len));
+    Node* bol = _gvn.transform(new (C) BoolNode(cmp, BoolTest::ne));
+    Node* if_ne = generate_slow_guard(bol, NULL);
+    if (if_ne != NULL) {
+      phi->init_req(5, intcon(0));
+      region->init_req(5, if_ne);
+    }
+
+    if (!stopped()) {
+      Node* a_start = array_element_address(a, intcon(0), elem_type);
+      Node* b_start = array_element_address(b, intcon(0), elem_type);
+      Node* log2_scale = intcon(exact_log2(type2aelembytes(elem_type)));
+      const TypePtr* adr_type = TypeAryPtr::get_array_body_type(elem_type);
+      Node* call;
+      if (CCallingConventionRequiresIntsAsLongs) {
+        call = make_runtime_call(RC_LEAF|RC_NO_FP, OptoRuntime::vectorizedMismatch_Type(),
+                                 stubAddr, stubName, adr_type,
+                                 a_start, b_start, a_len XTOP, log2_scale XTOP);
+      } else {
+        call = make_runtime_call(RC_LEAF|RC_NO_FP, OptoRuntime::vectorizedMismatch_Type(),
+                                 stubAddr, stubName, adr_type,
+                                 a_start, b_start, a_len, log2_scale);
+      }
+      Node* index = _gvn.transform(new (C) ProjNode(call, TypeFunc::Parms));
+      // equal if the index is -1
+      phi->init_req(1, _gvn.transform(new (C) URShiftINode(index, intcon(31))));
+      region->init_req(1, control());
+    }
+  }
+
+  // post merge
+  set_control(_gvn.transform(region));
+  record_for_igvn(region);
+
+  set_result(_gvn.transform(phi));
+  return true;
+}
+
 
 /**
  * Calculate CRC32 for byte.
@@ -6256,6 +6433,184 @@ bool LibraryCallKit::inline_updateByteBufferCRC32() {
   return true;
 }
 
+/**
+ * Calculate CRC32C for byte[] array.
+ * int java.util.zip.CRC32C.updateBytes(int crc, byte[] buf, int off, int end)
+ */
+bool LibraryCallKit::inline_updateBytesCRC32C() {
+  assert(UseCRC32CIntrinsics, "need SSE4.2 crc32 instruction support");
+  assert(callee()->signature()->size() == 4, "updateBytes has 4 parameters");
+  // no receiver since it is static method
+  Node* crc     = argument(0); // type: int
+  Node* src     = argument(1); // type: oop
+  Node* offset  = argument(2); // type: int
+  Node* end     = argument(3); // type: int
+
+  Node* length = _gvn.transform(new (C) SubINode(end, offset));
+
+  const Type* src_type = src->Value(&_gvn);
+  const TypeAryPtr* top_src = src_type->isa_aryptr();
+  if (top_src  == NULL || top_src->klass()  == NULL) {
+    // failed array check
+    return false;
+  }
+
+  // Figure out the size and type of the elements we will be copying.
+  BasicType src_elem = src_type->isa_aryptr()->klass()->as_array_klass()->element_type()->basic_type();
+  if (src_elem != T_BYTE) {
+    return false;
+  }
+
+  // 'src_start' points to src array + scaled offset
+  Node* src_start = array_element_address(src, offset, src_elem);
+
+  // We assume that range check is done by caller.
+
+  // Call the stub, it has the same signature as the CRC32 one.
+  address stubAddr = StubRoutines::updateBytesCRC32C();
+  const char *stubName = "updateBytesCRC32C";
+  Node* call;
+  if (CCallingConventionRequiresIntsAsLongs) {
+    call = make_runtime_call(RC_LEAF|RC_NO_FP, OptoRuntime::updateBytesCRC32_Type(),
+                             stubAddr, stubName, TypePtr::BOTTOM,
+                             crc XTOP, src_start, length XTOP);
+  } else {
+    call = make_runtime_call(RC_LEAF|RC_NO_FP, OptoRuntime::updateBytesCRC32_Type(),
+                             stubAddr, stubName, TypePtr::BOTTOM,
+                             crc, src_start, length);
+  }
+  Node* result = _gvn.transform(new (C) ProjNode(call, TypeFunc::Parms));
+  set_result(result);
+  return true;
+}
+
+/**
+ * Calculate CRC32C for DirectByteBuffer.
+ * int java.util.zip.CRC32C.updateDirectByteBuffer(int crc, long buf, int off, int end)
+ */
+bool LibraryCallKit::inline_updateDirectByteBufferCRC32C() {
+  assert(UseCRC32CIntrinsics, "need SSE4.2 crc32 instruction support");
+  assert(callee()->signature()->size() == 5, "updateDirectByteBuffer has 4 parameters and one is long");
+  // no receiver since it is static method
+  Node* crc     = argument(0); // type: int
+  Node* src     = argument(1); // type: long
+  Node* offset  = argument(3); // type: int
+  Node* end     = argument(4); // type: int
+
+  Node* length = _gvn.transform(new (C) SubINode(end, offset));
+
+  src = ConvL2X(src);  // adjust Java long to machine word
+  Node* base = _gvn.transform(new (C) CastX2PNode(src));
+  offset = ConvI2X(offset);
+
+  // 'src_start' points to src array + scaled offset
+  Node* src_start = basic_plus_adr(top(), base, offset);
+
+  // Call the stub.
+  address stubAddr = StubRoutines::updateBytesCRC32C();
+  const char *stubName = "updateBytesCRC32C";
+  Node* call;
+  if (CCallingConventionRequiresIntsAsLongs) {
+    call = make_runtime_call(RC_LEAF|RC_NO_FP, OptoRuntime::updateBytesCRC32_Type(),
+                             stubAddr, stubName, TypePtr::BOTTOM,
+                             crc XTOP, src_start, length XTOP);
+  } else {
+    call = make_runtime_call(RC_LEAF|RC_NO_FP, OptoRuntime::updateBytesCRC32_Type(),
+                             stubAddr, stubName, TypePtr::BOTTOM,
+                             crc, src_start, length);
+  }
+  Node* result = _gvn.transform(new (C) ProjNode(call, TypeFunc::Parms));
+  set_result(result);
+  return true;
+}
+
+/**
+ * Calculate Adler32 checksum for byte[] array.
+ * int java.util.zip.Adler32.updateBytes(int adler, byte[] buf, int off, int len)
+ */
+bool LibraryCallKit::inline_updateBytesAdler32() {
+  assert(UseAdler32Intrinsics, "need SSSE3 instructions support");
+  assert(callee()->signature()->size() == 4, "updateBytes has 4 parameters");
+  // no receiver since it is static method
+  Node* adler   = argument(0); // type: int
+  Node* src     = argument(1); // type: oop
+  Node* offset  = argument(2); // type: int
+  Node* length  = argument(3); // type: int
+
+  const Type* src_type = src->Value(&_gvn);
+  const TypeAryPtr* top_src = src_type->isa_aryptr();
+  if (top_src  == NULL || top_src->klass()  == NULL) {
+    // failed array check
+    return false;
+  }
+
+  // Figure out the size and type of the elements we will be copying.
+  BasicType src_elem = src_type->isa_aryptr()->klass()->as_array_klass()->element_type()->basic_type();
+  if (src_elem != T_BYTE) {
+    return false;
+  }
+
+  // 'src_start' points to src array + scaled offset
+  Node* src_start = array_element_address(src, offset, src_elem);
+
+  // We assume that range check is done by caller.
+
+  // Call the stub, it has the same signature as the CRC32 one.
+  address stubAddr = StubRoutines::updateBytesAdler32();
+  const char *stubName = "updateBytesAdler32";
+  Node* call;
+  if (CCallingConventionRequiresIntsAsLongs) {
+    call = make_runtime_call(RC_LEAF|RC_NO_FP, OptoRuntime::updateBytesCRC32_Type(),
+                             stubAddr, stubName, TypePtr::BOTTOM,
+                             adler XTOP, src_start, length XTOP);
+  } else {
+    call = make_runtime_call(RC_LEAF|RC_NO_FP, OptoRuntime::updateBytesCRC32_Type(),
+                             stubAddr, stubName, TypePtr::BOTTOM,
+                             adler, src_start, length);
+  }
+  Node* result = _gvn.transform(new (C) ProjNode(call, TypeFunc::Parms));
+  set_result(result);
+  return true;
+}
+
+/**
+ * Calculate Adler32 checksum for ByteBuffer.
+ * int java.util.zip.Adler32.updateByteBuffer(int adler, long buf, int off, int len)
+ */
+bool LibraryCallKit::inline_updateByteBufferAdler32() {
+  assert(UseAdler32Intrinsics, "need SSSE3 instructions support");
+  assert(callee()->signature()->size() == 5, "updateByteBuffer has 4 parameters and one is long");
+  // no receiver since it is static method
+  Node* adler   = argument(0); // type: int
+  Node* src     = argument(1); // type: long
+  Node* offset  = argument(3); // type: int
+  Node* length  = argument(4); // type: int
+
+  src = ConvL2X(src);  // adjust Java long to machine word
+  Node* base = _gvn.transform(new (C) CastX2PNode(src));
+  offset = ConvI2X(offset);
+
+  // 'src_start' points to src array + scaled offset
+  Node* src_start = basic_plus_adr(top(), base, offset);
+
+  // Call the stub.
+  address stubAddr = StubRoutines::updateBytesAdler32();
+  const char *stubName = "updateBytesAdler32";
+  Node* call;
+  if (CCallingConventionRequiresIntsAsLongs) {
+    call = make_runtime_call(RC_LEAF|RC_NO_FP, OptoRuntime::updateBytesCRC32_Type(),
+                             stubAddr, stubName, TypePtr::BOTTOM,
+                             adler XTOP, src_start, length XTOP);
+  } else {
+    call = make_runtime_call(RC_LEAF|RC_NO_FP, OptoRuntime::updateBytesCRC32_Type(),
+                             stubAddr, stubName, TypePtr::BOTTOM,
+                             adler, src_start, length);
+  }
+  Node* result = _gvn.transform(new (C) ProjNode(call, TypeFunc::Parms));
+  set_result(result);
+  return true;
+}
+
 //----------------------------inline_reference_get----------------------------
 // public T java.lang.ref.Reference.get();
 bool LibraryCallKit::inline_reference_get() {
@@ -6339,6 +6694,23 @@ Node * LibraryCallKit::load_field_from_object(Node * fromObj, const char * field
   return loadedField;
 }
 
+// Return the address of a field of an object, for stubs which update it in place.
+Node * LibraryCallKit::field_address_from_object(Node * fromObj, const char * fieldName, const char * fieldTypeString,
+                                                 bool is_exact=true, bool is_static=false) {
+  const TypeInstPtr* tinst = _gvn.type(fromObj)->isa_instptr();
+  assert(tinst != NULL, "obj is null");
+  assert(tinst->klass()->is_loaded(), "obj is not loaded");
+  assert(!is_exact || tinst->klass_is_exact(), "klass not exact");
+
+  ciField* field = tinst->klass()->as_instance_klass()->get_field_by_name(ciSymbol::make(fieldName),
+                                                                          ciSymbol::make(fieldTypeString),
+                                                                          is_static);
+  if (field == NULL) return (Node *) NULL;
+  assert(!field->is_volatile(), "stubs update the field without barriers");
+
+  return basic_plus_adr(fromObj, fromObj, field->offset_in_bytes());
+}
+
 
 //------------------------------inline_aescrypt_Block-----------------------
 bool LibraryCallKit::inline_aescrypt_Block(vmIntrinsics::ID id) {
@@ -6599,6 +6971,150 @@ Node* LibraryCallKit::inline_cipherBlockChaining_AESCrypt_predicate(bool decrypt
   return _gvn.transform(region);
 }
 
+//------------------------------inline_counterMode_AESCrypt-----------------------
+bool LibraryCallKit::inline_counterMode_AESCrypt(vmIntrinsics::ID id) {
+  assert(UseAES, "need AES instruction support");
+  assert(!Matcher::pass_original_key_for_aes(), "no counter mode stub for this platform");
+
+  address stubAddr = StubRoutines::counterMode_AESCrypt();
+  const char *stubName = "counterMode_AESCrypt";
+  if (stubAddr == NULL) return false;
+
+  Node* counterMode_object = argument(0);
+  Node* src                = argument(1);
+  Node* src_offset         = argument(2);
+  Node* len                = argument(3);
+  Node* dest               = argument(4);
+  Node* dest_offset        = argument(5);
+
+  // (1) src and dest are arrays.
+  const Type* src_type = src->Value(&_gvn);
+  const Type* dest_type = dest->Value(&_gvn);
+  const TypeAryPtr* top_src = src_type->isa_aryptr();
+  const TypeAryPtr* top_dest = dest_type->isa_aryptr();
+  assert (top_src  != NULL && top_src->klass()  != NULL
+          &&  top_dest != NULL && top_dest->klass() != NULL, "args are strange");
+
+  // checks are the responsibility of the caller
+  Node* src_start  = array_element_address(src,  src_offset,  T_BYTE);
+  Node* dest_start = array_element_address(dest, dest_offset, T_BYTE);
+
+  // if we are in this set of code, we "know" the embeddedCipher is an AESCrypt object
+  // (because of the predicated logic executed earlier).
+  // so we cast it here safely.
+  Node* embeddedCipherObj = load_field_from_object(counterMode_object, "embeddedCipher", "Lcom/sun/crypto/provider/SymmetricCipher;", /*is_exact*/ false);
+  if (embeddedCipherObj == NULL) return false;
+
+  // cast it to what we know it will be at runtime
+  const TypeInstPtr* tinst = _gvn.type(counterMode_object)->isa_instptr();
+  assert(tinst != NULL, "CTR obj is null");
+  assert(tinst->klass()->is_loaded(), "CTR obj is not loaded");
+  ciKlass* klass_AESCrypt = tinst->klass()->as_instance_klass()->find_klass(ciSymbol::make("com/sun/crypto/provider/AESCrypt"));
+  assert(klass_AESCrypt->is_loaded(), "predicate checks that this class is loaded");
+
+  ciInstanceKlass* instklass_AESCrypt = klass_AESCrypt->as_instance_klass();
+  const TypeKlassPtr* aklass = TypeKlassPtr::make(instklass_AESCrypt);
+  const TypeOopPtr* xtype = aklass->as_instance_type();
+  Node* aescrypt_object = new(C) CheckCastPPNode(control(), embeddedCipherObj, xtype);
+  aescrypt_object = _gvn.transform(aescrypt_object);
+
+  // we need to get the start of the aescrypt_object's expanded key array
+  Node* k_start = get_key_start_from_aescrypt_object(aescrypt_object);
+  if (k_start == NULL) return false;
+
+  // similarly, get the start addresses of the counter and the saved encrypted counter,
+  // and the address of the count of bytes of it already used
+  Node* obj_counter = load_field_from_object(counterMode_object, "counter", "[B", /*is_exact*/ false);
+  if (obj_counter == NULL) return false;
+  Node* cnt_start = array_element_address(obj_counter, intcon(0), T_BYTE);
+
+  Node* saved_encCounter = load_field_from_object(counterMode_object, "encryptedCounter", "[B", /*is_exact*/ false);
+  if (saved_encCounter == NULL) return false;
+  Node* saved_encCounter_start = array_element_address(saved_encCounter, intcon(0), T_BYTE);
+
+  Node* used = field_address_from_object(counterMode_object, "used", "I", /*is_exact*/ false);
+  if (used == NULL) return false;
+
+  // Call the stub, passing src_start, dest_start, k_start, cnt_start, src_len,
+  // saved_encCounter_start and used
+  Node* ctrCrypt = make_runtime_call(RC_LEAF|RC_NO_FP,
+                                     OptoRuntime::counterMode_aescrypt_Type(),
+                                     stubAddr, stubName, TypePtr::BOTTOM,
+                                     src_start, dest_start, k_start, cnt_start, len, saved_encCounter_start, used);
+
+  // return cipher length (int)
+  Node* retvalue = _gvn.transform(new (C) ProjNode(ctrCrypt, TypeFunc::Parms));
+  set_result(retvalue);
+  return true;
+}
+
+//----------------------------inline_counterMode_AESCrypt_predicate----------------------------
+// Return node representing slow path of predicate check.
+// the pseudo code we want to emulate with this predicate is:
+//    if (embeddedCipherObj instanceof AESCrypt) do_intrinsic, else do_javapath
+//
+Node* LibraryCallKit::inline_counterMode_AESCrypt_predicate() {
+  // The receiver was checked for NULL already.
+  Node* objCTR = argument(0);
+
+  // Load embeddedCipher field of CounterMode object.
+  Node* embeddedCipherObj = load_field_from_object(objCTR, "embeddedCipher", "Lcom/sun/crypto/provider/SymmetricCipher;", /*is_exact*/ false);
+
+  // get AESCrypt klass for instanceOf check
+  // AESCrypt might not be loaded yet if some other SymmetricCipher got us to this compile point
+  // will have same classloader as CounterMode object
+  const TypeInstPtr* tinst = _gvn.type(objCTR)->isa_instptr();
+  assert(tinst != NULL, "CTRobj is null");
+  assert(tinst->klass()->is_loaded(), "CTRobj is not loaded");
+
+  // we want to do an instanceof comparison against the AESCrypt class
+  ciKlass* klass_AESCrypt = tinst->klass()->as_instance_klass()->find_klass(ciSymbol::make("com/sun/crypto/provider/AESCrypt"));
+  if (!klass_AESCrypt->is_loaded()) {
+    // if AESCrypt is not even loaded, we never take the intrinsic fast path
+    Node* ctrl = control();
+    set_control(top()); // no regular fast path
+    return ctrl;
+  }
+  ciInstanceKlass* instklass_AESCrypt = klass_AESCrypt->as_instance_klass();
+
+  Node* instof = gen_instanceof(embeddedCipherObj, makecon(TypeKlassPtr::make(instklass_AESCrypt)));
+  Node* cmp_instof  = _gvn.transform(new (C) CmpINode(instof, intcon(1)));
+  Node* bool_instof  = _gvn.transform(new (C) BoolNode(cmp_instof, BoolTest::ne));
+  Node* instof_false = generate_guard(bool_instof, NULL, PROB_MIN);
+
+  return instof_false; // even if it is NULL
+}
+
+//------------------------------inline_ghash_processBlocks-----------------------
+//
+// Multiply the GHASH state by the hash subkey H for each 16-byte block of data.
+// static void com.sun.crypto.provider.GHASH.processBlocks(byte[] data, int inOfs, int blocks, long[] st, long[] subH)
+//
+bool LibraryCallKit::inline_ghash_processBlocks() {
+  address stubAddr = StubRoutines::ghash_processBlocks();
+  const char *stubName = "ghash_processBlocks";
+  if (stubAddr == NULL) return false;
+
+  Node* data    = argument(0);
+  Node* offset  = argument(1);
+  Node* len     = argument(2);
+  Node* state   = argument(3);
+  Node* subkeyH = argument(4);
+
+  Node* state_start   = array_element_address(state,   intcon(0), T_LONG);
+  assert(state_start, "state is NULL");
+  Node* subkeyH_start = array_element_address(subkeyH, intcon(0), T_LONG);
+  assert(subkeyH_start, "subkeyH is NULL");
+  Node* data_start    = array_element_address(data,    offset,    T_BYTE);
+  assert(data_start, "data is NULL");
+
+  make_runtime_call(RC_LEAF|RC_NO_FP,
+                    OptoRuntime::ghash_processBlocks_Type(),
+                    stubAddr, stubName, TypePtr::BOTTOM,
+                    state_start, subkeyH_start, data_start, len);
+  return true;
+}
+
 //------------------------------inline_sha_implCompress-----------------------
 //
 // Calculate SHA (i.e., SHA-1) for single-block byte[] array.
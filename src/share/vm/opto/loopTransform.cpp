@@ -895,58 +895,13 @@ bool PhaseIdealLoop::cast_incr_before_loop(Node* incr, Node* ctrl, Node* loop) {
   return false;
 }
 
-//------------------------------insert_pre_post_loops--------------------------
-// Insert pre and post loops.  If peel_only is set, the pre-loop can not have
-// more iterations added.  It acts as a 'peel' only, no lower-bound RCE, no
-// alignment.  Useful to unroll loops that do no array accesses.
-void PhaseIdealLoop::insert_pre_post_loops( IdealLoopTree *loop, Node_List &old_new, bool peel_only ) {
-
-#ifndef PRODUCT
-  if (TraceLoopOpts) {
-    if (peel_only)
-      tty->print("PeelMainPost ");
-    else
-      tty->print("PreMainPost  ");
-    loop->dump_head();
-  }
-#endif
-  C->set_major_progress();
-
-  // Find common pieces of the loop being guarded with pre & post loops
-  CountedLoopNode *main_head = loop->_head->as_CountedLoop();
-  assert( main_head->is_normal_loop(), "" );
-  CountedLoopEndNode *main_end = main_head->loopexit();
-  guarantee(main_end != NULL, "no loop exit node");
-  assert( main_end->outcnt() == 2, "1 true, 1 false path only" );
-  uint dd_main_head = dom_depth(main_head);
-  uint max = main_head->outcnt();
-
-  Node *pre_header= main_head->in(LoopNode::EntryControl);
-  Node *init      = main_head->init_trip();
-  Node *incr      = main_end ->incr();
-  Node *limit     = main_end ->limit();
-  Node *stride    = main_end ->stride();
-  Node *cmp       = main_end ->cmp_node();
-  BoolTest::mask b_test = main_end->test_trip();
-
-  // Need only 1 user of 'bol' because I will be hacking the loop bounds.
-  Node *bol = main_end->in(CountedLoopEndNode::TestValue);
-  if( bol->outcnt() != 1 ) {
-    bol = bol->clone();
-    register_new_node(bol,main_end->in(CountedLoopEndNode::TestControl));
-    _igvn.hash_delete(main_end);
-    main_end->set_req(CountedLoopEndNode::TestValue, bol);
-  }
-  // Need only 1 user of 'cmp' because I will be hacking the loop bounds.
-  if( cmp->outcnt() != 1 ) {
-    cmp = cmp->clone();
-    register_new_node(cmp,main_end->in(CountedLoopEndNode::TestControl));
-    _igvn.hash_delete(bol);
-    bol->set_req(1, cmp);
-  }
-
-  //------------------------------
-  // Step A: Create Post-Loop.
+//------------------------------insert_post_loop-------------------------------
+// Insert a post loop after the main loop.  The post loop is a clone of the
+// main loop, entered through a zero-trip guard on the main loop's exit value
+// of the trip counter.  Returns the new main loop exit.
+Node *PhaseIdealLoop::insert_post_loop( IdealLoopTree *loop, Node_List &old_new,
+                                        CountedLoopNode *main_head, CountedLoopEndNode *main_end,
+                                        Node *incr, Node *limit, CountedLoopNode *&post_head ) {
   Node* main_exit = main_end->proj_out(false);
   assert( main_exit->Opcode() == Op_IfFalse, "" );
   int dd_main_exit = dom_depth(main_exit);
@@ -955,7 +910,8 @@ void PhaseIdealLoop::insert_pre_post_loops( IdealLoopTree *loop, Node_List &old_
   // loop pre-header illegally has 2 control users (old & new loops).
   clone_loop( loop, old_new, dd_main_exit );
   assert( old_new[main_end ->_idx]->Opcode() == Op_CountedLoopEnd, "" );
-  CountedLoopNode *post_head = old_new[main_head->_idx]->as_CountedLoop();
+  post_head = old_new[main_head->_idx]->as_CountedLoop();
+  post_head->set_normal_loop();
   post_head->set_post_loop(main_head);
 
   // Reduce the post-loop trip count.
@@ -975,7 +931,7 @@ void PhaseIdealLoop::insert_pre_post_loops( IdealLoopTree *loop, Node_List &old_
   // trip guard until all unrolling is done.
   Node *zer_opaq = new (C) Opaque1Node(C, incr);
   Node *zer_cmp  = new (C) CmpINode( zer_opaq, limit );
-  Node *zer_bol  = new (C) BoolNode( zer_cmp, b_test );
+  Node *zer_bol  = new (C) BoolNode( zer_cmp, main_end->test_trip() );
   register_new_node( zer_opaq, new_main_exit );
   register_new_node( zer_cmp , new_main_exit );
   register_new_node( zer_bol , new_main_exit );
@@ -1018,9 +974,158 @@ void PhaseIdealLoop::insert_pre_post_loops( IdealLoopTree *loop, Node_List &old_
     }
   }
 
-  // Update local caches for next stanza
-  main_exit = new_main_exit;
+  // CastII for the post loop:
+  bool inserted = cast_incr_before_loop(zer_opaq->in(1), zer_taken, post_head);
+  assert(inserted, "no castII inserted");
+
+  return new_main_exit;
+}
+
+//------------------------------insert_vector_post_loop------------------------
+// The main loop is about to be unrolled beyond the number of iterations that
+// fill one vector of its narrowest memory element type.  Insert a copy of it,
+// as it is now, as a vector post loop between the main and the post loop.
+// SuperWord vectorizes it like the main loop, so that after leaving the main
+// loop whole vectors of the remaining iterations are still run as vectors
+// and the scalar post loop runs less than one vector's worth of iterations.
+void PhaseIdealLoop::insert_vector_post_loop( IdealLoopTree *loop, Node_List &old_new ) {
+  if (!UseSuperWord || !VectorizePostLoops || !Matcher::misaligned_vectors_ok()) return;
+
+  CountedLoopNode *main_head = loop->_head->as_CountedLoop();
+  if (!main_head->is_main_loop() || main_head->has_vector_post_loop()) return;
+  if (!main_head->stride_is_con()) return;
+  CountedLoopEndNode *main_end = main_head->loopexit();
+  // SuperWord only handles loops without control flow in the body.
+  if (main_end == NULL || main_end->in(0) != main_head) return;
+
+  // Only unit stride loops, where the unroll count is the number of
+  // iterations in the body.
+  int cur_unroll = main_head->unrolled_count();
+  if (ABS(main_head->stride_con()) != cur_unroll) return;
+
+  // Find the narrowest primitive memory access in the body.
+  int min_size = 0;
+  BasicType min_bt = T_ILLEGAL;
+  for (uint i = 0; i < loop->_body.size(); i++) {
+    Node* n = loop->_body.at(i);
+    if (n->is_Load() || n->is_Store()) {
+      BasicType bt = n->as_Mem()->memory_type();
+      if (!is_java_primitive(bt)) continue;
+      int size = type2aelembytes(bt);
+      if (min_size == 0 || size < min_size) {
+        min_size = size;
+        min_bt = bt;
+      }
+    }
+  }
+  if (min_size == 0) return;
+  int vlen = Matcher::max_vector_size(min_bt);
+  if (vlen < 2 || cur_unroll != vlen) return;
+
+#ifndef PRODUCT
+  if (TraceLoopOpts) {
+    tty->print("PostVector   ");
+    loop->dump_head();
+  }
+#endif
+  C->set_major_progress();
+
+  CountedLoopNode *post_head = NULL;
+  insert_post_loop(loop, old_new, main_head, main_end, main_end->incr(), main_end->limit(), post_head);
+  post_head->set_vector_post_loop();
+  main_head->mark_has_vector_post_loop();
+
+  // The vector post loop runs fewer trips than the main loop will be
+  // unrolled by from here on, so guess a single trip.
+  post_head->set_profile_trip_cnt(1.0);
+
+  // Now force out all loop-invariant dominating tests.  The optimizer
+  // finds some, but we _know_ they are all useless.
+  peeled_dom_test_elim(loop, old_new);
+  loop->record_for_igvn();
+}
+
+//------------------------------remove_vector_post_loop------------------------
+// A vector post loop that SuperWord left scalar only repeats what the post
+// loop does, with a larger body.  Make its zero-trip guard always fail; the
+// loop is then unreachable and goes away during IGVN.
+void PhaseIdealLoop::remove_vector_post_loop( IdealLoopTree *loop ) {
+  CountedLoopNode *post_head = loop->_head->as_CountedLoop();
+  assert(post_head->is_vector_post_loop(), "must be a vector post loop");
+  Node *entry = post_head->in(LoopNode::EntryControl);
+  if (!entry->is_IfTrue() || !entry->in(0)->is_If()) return;
+  // The trip counter enters through the CastII pinned on the guard's
+  // taken path (see insert_post_loop).  Anything else, e.g. a peeled
+  // iteration, means the entry is not the guard any more.
+  Node *init = post_head->init_trip();
+  if (init == NULL || init->Opcode() != Op_CastII || init->in(0) != entry) return;
+  IfNode *zer_iff = entry->in(0)->as_If();
+
+#ifndef PRODUCT
+  if (TraceLoopOpts) {
+    tty->print("PostVectorOff ");
+    loop->dump_head();
+  }
+#endif
+  Node *con = _igvn.intcon(0);
+  set_ctrl(con, C->root());
+  _igvn.replace_input_of(zer_iff, 1, con);
+}
+
+//------------------------------insert_pre_post_loops--------------------------
+// Insert pre and post loops.  If peel_only is set, the pre-loop can not have
+// more iterations added.  It acts as a 'peel' only, no lower-bound RCE, no
+// alignment.  Useful to unroll loops that do no array accesses.
+void PhaseIdealLoop::insert_pre_post_loops( IdealLoopTree *loop, Node_List &old_new, bool peel_only ) {
 
+#ifndef PRODUCT
+  if (TraceLoopOpts) {
+    if (peel_only)
+      tty->print("PeelMainPost ");
+    else
+      tty->print("PreMainPost  ");
+    loop->dump_head();
+  }
+#endif
+  C->set_major_progress();
+
+  // Find common pieces of the loop being guarded with pre & post loops
+  CountedLoopNode *main_head = loop->_head->as_CountedLoop();
+  assert( main_head->is_normal_loop(), "" );
+  CountedLoopEndNode *main_end = main_head->loopexit();
+  guarantee(main_end != NULL, "no loop exit node");
+  assert( main_end->outcnt() == 2, "1 true, 1 false path only" );
+  uint dd_main_head = dom_depth(main_head);
+  uint max = main_head->outcnt();
+
+  Node *pre_header= main_head->in(LoopNode::EntryControl);
+  Node *init      = main_head->init_trip();
+  Node *incr      = main_end ->incr();
+  Node *limit     = main_end ->limit();
+  Node *stride    = main_end ->stride();
+  Node *cmp       = main_end ->cmp_node();
+  BoolTest::mask b_test = main_end->test_trip();
+
+  // Need only 1 user of 'bol' because I will be hacking the loop bounds.
+  Node *bol = main_end->in(CountedLoopEndNode::TestValue);
+  if( bol->outcnt() != 1 ) {
+    bol = bol->clone();
+    register_new_node(bol,main_end->in(CountedLoopEndNode::TestControl));
+    _igvn.hash_delete(main_end);
+    main_end->set_req(CountedLoopEndNode::TestValue, bol);
+  }
+  // Need only 1 user of 'cmp' because I will be hacking the loop bounds.
+  if( cmp->outcnt() != 1 ) {
+    cmp = cmp->clone();
+    register_new_node(cmp,main_end->in(CountedLoopEndNode::TestControl));
+    _igvn.hash_delete(bol);
+    bol->set_req(1, cmp);
+  }
+
+  //------------------------------
+  // Step A: Create Post-Loop.
+  CountedLoopNode *post_head = NULL;
+  insert_post_loop(loop, old_new, main_head, main_end, incr, limit, post_head);
 
   //------------------------------
   // Step B: Create Pre-Loop.
@@ -1076,8 +1181,9 @@ void PhaseIdealLoop::insert_pre_post_loops( IdealLoopTree *loop, Node_List &old_
   main_head->set_req(LoopNode::EntryControl, min_taken);
   set_idom(main_head, min_taken, dd_main_head);
 
-  visited.Clear();
-  clones.clear();
+  Arena *a = Thread::current()->resource_area();
+  VectorSet visited(a);
+  Node_Stack clones(a, main_head->back_control()->outcnt());
   // Step B3: Make the fall-in values to the main-loop come from the
   // fall-out values of the pre-loop.
   for (DUIterator_Fast i2max, i2 = main_head->fast_outs(i2max); i2 < i2max; i2++) {
@@ -1103,12 +1209,8 @@ void PhaseIdealLoop::insert_pre_post_loops( IdealLoopTree *loop, Node_List &old_
   // variable value and the induction variable Phi to preserve correct
   // dependencies.
 
-  // CastII for the post loop:
-  bool inserted = cast_incr_before_loop(zer_opaq->in(1), zer_taken, post_head);
-  assert(inserted, "no castII inserted");
-
   // CastII for the main loop:
-  inserted = cast_incr_before_loop(pre_incr, min_taken, main_head);
+  bool inserted = cast_incr_before_loop(pre_incr, min_taken, main_head);
   assert(inserted, "no castII inserted");
 
   // Step B4: Shorten the pre-loop to run only 1 iteration (for now).
@@ -2393,8 +2495,10 @@ bool IdealLoopTree::iteration_split_impl( PhaseIdealLoop *phase, Node_List &old_
     // an even number of trips).  If we are peeling, we might enable some RCE
     // and we'd rather unroll the post-RCE'd loop SO... do not unroll if
     // peeling.
-    if (should_unroll && !should_peel)
+    if (should_unroll && !should_peel) {
+      phase->insert_vector_post_loop(this, old_new);
       phase->do_unroll(this,old_new, true);
+    }
 
     // Adjust the pre-loop limits to align the main body
     // iterations.
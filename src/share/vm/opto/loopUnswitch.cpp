@@ -67,9 +67,23 @@ bool IdealLoopTree::policy_unswitching( PhaseIdealLoop *phase ) const {
   if (head->unswitch_count() + 1 > head->unswitch_max()) {
     return false;
   }
+  // Each level of unswitching doubles the number of versions of the loop
+  if (((intx)_body.size() << (head->unswitch_count() + 1)) > LoopUnswitchingNodeBudget) {
+    return false;
+  }
   return phase->find_unswitching_candidate(this) != NULL;
 }
 
+//------------------------------is_unswitching_candidate-----------------------------
+// An invariant test that doesn't exit the loop
+static bool is_unswitching_candidate(const IdealLoopTree* loop, Node* n) {
+  if (n->Opcode() != Op_If || !n->in(1)->is_Bool()) {
+    return false;
+  }
+  BoolNode* bol = n->in(1)->as_Bool();
+  return bol->in(1)->is_Cmp() && loop->is_invariant(bol) && !loop->is_loop_exit(n);
+}
+
 //------------------------------find_unswitching_candidate-----------------------------
 // Find candidate "if" for unswitching
 IfNode* PhaseIdealLoop::find_unswitching_candidate(const IdealLoopTree *loop) const {
@@ -83,20 +97,25 @@ IfNode* PhaseIdealLoop::find_unswitching_candidate(const IdealLoopTree *loop) co
     if (n->is_Region()) {
       if (n_dom->is_If()) {
         IfNode* iff = n_dom->as_If();
-        if (iff->in(1)->is_Bool()) {
-          BoolNode* bol = iff->in(1)->as_Bool();
-          if (bol->in(1)->is_Cmp()) {
-            // If condition is invariant and not a loop exit,
-            // then found reason to unswitch.
-            if (loop->is_invariant(bol) && !loop->is_loop_exit(iff)) {
-              unswitch_iff = iff;
-            }
-          }
+        // If condition is invariant and not a loop exit,
+        // then found reason to unswitch.
+        if (is_unswitching_candidate(loop, iff)) {
+          unswitch_iff = iff;
         }
       }
     }
     n = n_dom;
   }
+  if (unswitch_iff == NULL) {
+    // Then look for one that is only executed on some paths
+    // through the loop body.
+    for (uint i = 0; i < loop->_body.size(); i++) {
+      Node* n = loop->_body.at(i);
+      if (is_unswitching_candidate(loop, n)) {
+        return n->as_If();
+      }
+    }
+  }
   return unswitch_iff;
 }
 
@@ -190,6 +209,30 @@ void PhaseIdealLoop::do_unswitching (IdealLoopTree *loop, Node_List &old_new) {
   _igvn.rehash_node_delayed(unswitch_iff_clone);
   short_circuit_if(unswitch_iff_clone, proj_false);
 
+  // Other tests of the same condition, or of its negation, are
+  // decided by the new "if" as well.
+  for (uint i = 0; i < loop->_body.size(); i++) {
+    Node* n = loop->_body.at(i);
+    if (n == unswitch_iff || n->Opcode() != Op_If || !n->in(1)->is_Bool()) {
+      continue;
+    }
+    BoolNode* n_bol = n->in(1)->as_Bool();
+    bool negated;
+    if (n_bol == bol) {
+      negated = false;
+    } else if (n_bol->in(1) == bol->in(1) && n_bol->_test._test == bol->_test.negate()) {
+      negated = true;
+    } else {
+      continue;
+    }
+    IfNode* iff = n->as_If();
+    _igvn.rehash_node_delayed(iff);
+    short_circuit_if(iff, negated ? proj_false : proj_true);
+    IfNode* iff_clone = old_new[iff->_idx]->as_If();
+    _igvn.rehash_node_delayed(iff_clone);
+    short_circuit_if(iff_clone, negated ? proj_true : proj_false);
+  }
+
   // Reoptimize loops
   loop->record_for_igvn();
   for(int i = loop->_body.size() - 1; i >= 0 ; i--) {
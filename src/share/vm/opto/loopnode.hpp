@@ -62,7 +62,9 @@ protected:
          HasExactTripCount=8,
          InnerLoop=16,
          PartialPeelLoop=32,
-         PartialPeelFailed=64 };
+         PartialPeelFailed=64,
+         VectorPostLoop=128,
+         HasVectorPostLoop=256 };
   char _unswitch_count;
   enum { _unswitch_max=3 };
 
@@ -206,6 +208,16 @@ public:
   int is_main_no_pre_loop() const { return _loop_flags & MainHasNoPreLoop; }
   void set_main_no_pre_loop() { _loop_flags |= MainHasNoPreLoop; }
 
+  // A 'vector post' loop is a copy of the main loop taken when its body
+  // held one vector's worth of iterations, placed between the main loop
+  // and the post loop.  Once the main loop is unrolled further, it drains
+  // the remaining whole vectors so the scalar post loop only runs the
+  // last few iterations.
+  int is_vector_post_loop() const { return _loop_flags & VectorPostLoop; }
+  void set_vector_post_loop() { _loop_flags |= VectorPostLoop; }
+  int has_vector_post_loop() const { return _loop_flags & HasVectorPostLoop; }
+  void mark_has_vector_post_loop() { _loop_flags |= HasVectorPostLoop; }
+
   int main_idx() const { return _main_idx; }
 
 
@@ -871,6 +883,17 @@ public:
   // Add pre and post loops around the given loop.  These loops are used
   // during RCE, unrolling and aligning loops.
   void insert_pre_post_loops( IdealLoopTree *loop, Node_List &old_new, bool peel_only );
+  // Add a post loop after the main loop, guarded by a zero-trip test on
+  // the main loop's exit value.  Returns the new main loop exit.
+  Node *insert_post_loop( IdealLoopTree *loop, Node_List &old_new,
+                          CountedLoopNode *main_head, CountedLoopEndNode *main_end,
+                          Node *incr, Node *limit, CountedLoopNode *&post_head );
+  // Add a vector post loop after a main loop that is about to be unrolled
+  // beyond one vector's worth of iterations.
+  void insert_vector_post_loop( IdealLoopTree *loop, Node_List &old_new );
+  // SuperWord did not vectorize the vector post loop: fold its zero-trip
+  // guard so that the scalar post loop runs the remaining iterations.
+  void remove_vector_post_loop( IdealLoopTree *loop );
   // If Node n lives in the back_ctrl block, we clone a private version of n
   // in preheader_ctrl block and return that, otherwise return n.
   Node *clone_up_backedge_goo( Node *back_ctrl, Node *preheader_ctrl, Node *n, VectorSet &visited, Node_Stack &clones );
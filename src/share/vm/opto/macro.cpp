@@ -588,9 +588,9 @@ bool PhaseMacroExpand::can_eliminate_allocation(AllocateNode *alloc, GrowableArr
       NOT_PRODUCT(fail_eliminate = "Neither instance or array allocation";)
       can_eliminate = false;
     } else if (res_type->isa_aryptr()) {
-      int length = alloc->in(AllocateNode::ALength)->find_int_con(-1);
-      if (length < 0) {
-        NOT_PRODUCT(fail_eliminate = "Array's size is not constant";)
+      int length = alloc->as_AllocateArray()->length_bound(&_igvn);
+      if (length < 0 || length > EliminateAllocationArraySizeLimit) {
+        NOT_PRODUCT(fail_eliminate = "Array's size is not bounded";)
         can_eliminate = false;
       }
     }
@@ -693,6 +693,7 @@ bool PhaseMacroExpand::scalar_replacement(AllocateNode *alloc, GrowableArray <Sa
   ciKlass* klass = NULL;
   ciInstanceKlass* iklass = NULL;
   int nfields = 0;
+  Node* length = NULL;   // Array length recorded for deoptimization
   int array_base = 0;
   int element_size = 0;
   BasicType basic_elem_type = T_ILLEGAL;
@@ -714,14 +715,21 @@ bool PhaseMacroExpand::scalar_replacement(AllocateNode *alloc, GrowableArray <Sa
       nfields = iklass->nof_nonstatic_fields();
     } else {
       // find the array's elements which will be needed for safepoint debug information
-      nfields = alloc->in(AllocateNode::ALength)->find_int_con(-1);
+      nfields = alloc->as_AllocateArray()->length_bound(&_igvn);
       assert(klass->is_array_klass() && nfields >= 0, "must be an array klass.");
+      if (!_igvn.type(alloc->in(AllocateNode::ALength))->singleton()) {
+        // The length is only bounded: describe the elements up to the bound
+        // and record the actual length in front of them.
+        length = alloc->in(AllocateNode::ALength);
+      }
       elem_type = klass->as_array_klass()->element_type();
       basic_elem_type = elem_type->basic_type();
       array_base = arrayOopDesc::base_offset_in_bytes(basic_elem_type);
       element_size = type2aelembytes(basic_elem_type);
     }
   }
+  // Number of debug inputs added to each safepoint
+  int n_inputs = nfields + (length != NULL ? 1 : 0);
   //
   // Process the safepoint uses
   //
@@ -737,9 +745,13 @@ bool PhaseMacroExpand::scalar_replacement(AllocateNode *alloc, GrowableArray <Sa
 #ifdef ASSERT
                                                  alloc,
 #endif
-                                                 first_ind, nfields);
+                                                 first_ind, n_inputs,
+                                                 length != NULL);
     sobj->init_req(0, C->root());
     transform_later(sobj);
+    if (length != NULL) {
+      sfpt->add_req(length);
+    }
 
     // Scan object's fields adding an input to the safepoint for each field.
     for (int j = 0; j < nfields; j++) {
@@ -786,7 +798,7 @@ bool PhaseMacroExpand::scalar_replacement(AllocateNode *alloc, GrowableArray <Sa
 
         // Remove any extra entries we added to the safepoint.
         uint last = sfpt->req() - 1;
-        for (int k = 0;  k < j; k++) {
+        for (int k = 0;  k < j + (n_inputs - nfields); k++) {
           sfpt->del_req(last--);
         }
         // rollback processed safepoints
@@ -794,7 +806,7 @@ bool PhaseMacroExpand::scalar_replacement(AllocateNode *alloc, GrowableArray <Sa
           SafePointNode* sfpt_done = safepoints_done.pop();
           // remove any extra entries we added to the safepoint
           last = sfpt_done->req() - 1;
-          for (int k = 0;  k < nfields; k++) {
+          for (int k = 0;  k < n_inputs; k++) {
             sfpt_done->del_req(last--);
           }
           JVMState *jvms = sfpt_done->jvms();
@@ -807,7 +819,7 @@ bool PhaseMacroExpand::scalar_replacement(AllocateNode *alloc, GrowableArray <Sa
             if (sfpt_done->in(i)->is_SafePointScalarObject()) {
               SafePointScalarObjectNode* scobj = sfpt_done->in(i)->as_SafePointScalarObject();
               if (scobj->first_index(jvms) == sfpt_done->req() &&
-                  scobj->n_fields() == (uint)nfields) {
+                  scobj->n_fields() == (uint)n_inputs) {
                 assert(scobj->alloc() == alloc, "sanity");
                 sfpt_done->set_req(i, res);
               }
@@ -657,7 +657,14 @@ void Compile::FillLocArray( int idx, MachSafePointNode* sfpt, Node *local,
       Compile::set_sv_for_object_node(objs, sv);
 
       uint first_ind = spobj->first_index(sfpt->jvms());
-      for (uint i = 0; i < spobj->n_fields(); i++) {
+      uint i = 0;
+      if (spobj->has_length()) {
+        GrowableArray<ScopeValue*> length(1);
+        (void)FillLocArray(0, sfpt, sfpt->in(first_ind), &length, objs);
+        sv->set_length(length.at(0));
+        i++;
+      }
+      for (; i < spobj->n_fields(); i++) {
         Node* fld_node = sfpt->in(first_ind+i);
         (void)FillLocArray(sv->field_values()->length(), sfpt, fld_node, sv->field_values(), objs);
       }
@@ -933,7 +940,14 @@ void Compile::Process_OopMap_Node(MachNode *mach, int current_offset) {
           Compile::set_sv_for_object_node(objs, sv);
 
           uint first_ind = spobj->first_index(youngest_jvms);
-          for (uint i = 0; i < spobj->n_fields(); i++) {
+          uint i = 0;
+          if (spobj->has_length()) {
+            GrowableArray<ScopeValue*> length(1);
+            (void)FillLocArray(0, sfn, sfn->in(first_ind), &length, objs);
+            sv->set_length(length.at(0));
+            i++;
+          }
+          for (; i < spobj->n_fields(); i++) {
             Node* fld_node = sfn->in(first_ind+i);
             (void)FillLocArray(sv->field_values()->length(), sfn, fld_node, sv->field_values(), objs);
           }
@@ -428,6 +428,7 @@ class Parse : public GraphKit {
   Node *fetch_interpreter_state(int index, BasicType bt, Node *local_addrs, Node *local_addrs_base);
   Node* check_interpreter_type(Node* l, const Type* type, SafePointNode* &bad_type_exit);
   void  load_interpreter_state(Node* osr_buf);
+  void  record_profiled_osr_parameters_for_speculation();
 
   // Functions for managing basic blocks:
   void init_blocks();
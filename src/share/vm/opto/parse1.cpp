@@ -38,6 +38,7 @@
 #include "runtime/handles.inline.hpp"
 #include "runtime/sharedRuntime.hpp"
 #include "utilities/copy.hpp"
+#include "utilities/log.hpp"
 
 // Static array so we can figure out which bytecodes stop us from compiling
 // the most. Some of the non-static variables are needed in bytecodeInfo.cpp
@@ -378,6 +379,78 @@ void Parse::load_interpreter_state(Node* osr_buf) {
                   Deoptimization::Action_reinterpret);
     set_map(types_are_good);
   }
+
+  // Feed profiling data for the parameters that are still live to the
+  // type system, as a normal method entry does
+  record_profiled_osr_parameters_for_speculation();
+}
+
+//--------------------record_profiled_osr_parameters_for_speculation-----------
+// The OSR buffer only gives us the types ciTypeFlow can prove. A parameter
+// that the method never stores to still holds the value that was profiled
+// when the method was entered, so its parameter profile is as good at the
+// OSR entry as at the normal entry.
+void Parse::record_profiled_osr_parameters_for_speculation() {
+  if (!UseTypeSpeculation || !UseParameterProfileAtOSR || stopped()) {
+    return;
+  }
+  ciMethodData* md = method()->method_data();
+  if (md == NULL || md->parameters_type_data() == NULL) {
+    return;
+  }
+
+  BitMap stored(method()->max_locals());
+  stored.clear();
+  ciBytecodeStream iter(method());
+  for (Bytecodes::Code bc = iter.next(); bc != ciBytecodeStream::EOBC(); bc = iter.next()) {
+    switch (bc) {
+    case Bytecodes::_lstore:   case Bytecodes::_dstore:
+      stored.set_bit(iter.get_index() + 1);
+      // fall through
+    case Bytecodes::_istore:   case Bytecodes::_fstore:
+    case Bytecodes::_astore:   case Bytecodes::_iinc:
+      stored.set_bit(iter.get_index());
+      break;
+    case Bytecodes::_lstore_0: case Bytecodes::_dstore_0: stored.set_bit(1); // fall through
+    case Bytecodes::_istore_0: case Bytecodes::_fstore_0:
+    case Bytecodes::_astore_0: stored.set_bit(0); break;
+    case Bytecodes::_lstore_1: case Bytecodes::_dstore_1: stored.set_bit(2); // fall through
+    case Bytecodes::_istore_1: case Bytecodes::_fstore_1:
+    case Bytecodes::_astore_1: stored.set_bit(1); break;
+    case Bytecodes::_lstore_2: case Bytecodes::_dstore_2: stored.set_bit(3); // fall through
+    case Bytecodes::_istore_2: case Bytecodes::_fstore_2:
+    case Bytecodes::_astore_2: stored.set_bit(2); break;
+    case Bytecodes::_lstore_3: case Bytecodes::_dstore_3: stored.set_bit(4); // fall through
+    case Bytecodes::_istore_3: case Bytecodes::_fstore_3:
+    case Bytecodes::_astore_3: stored.set_bit(3); break;
+    default: break;
+    }
+  }
+
+  // Walk the object parameters in the order of the parameter profile
+  ciSignature* sig = method()->signature();
+  int slot = 0;
+  int j = 0;
+  for (int k = method()->is_static() ? 0 : -1; k < sig->count(); k++) {
+    ciType* t = (k < 0) ? (ciType*)method()->holder() : sig->type_at(k);
+    if (t->basic_type() == T_OBJECT || t->basic_type() == T_ARRAY) {
+      Node* l = local(slot);
+      if (!stored.at(slot) && !l->is_top() && _gvn.type(l)->isa_oopptr()) {
+        ciKlass* better_type = method()->parameter_profiled_type(j);
+        if (better_type != NULL) {
+          record_profile_for_speculation(l, better_type);
+          if (Log::is_enabled(LogTag::compilation, LogLevel::debug)) {
+            Log::print(LogTag::compilation, LogLevel::debug,
+                       "OSR compilation of %s::%s speculates that parameter %d is %s",
+                       method()->holder()->name()->as_utf8(), method()->name()->as_utf8(),
+                       j, better_type->name()->as_utf8());
+          }
+        }
+      }
+      j++;
+    }
+    slot += t->size();
+  }
 }
 
 //------------------------------Parse------------------------------------------
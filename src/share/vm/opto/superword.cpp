@@ -54,6 +54,7 @@ SuperWord::SuperWord(PhaseIdealLoop* phase) :
   _align_to_ref(NULL),                    // memory reference to align vectors to
   _disjoint_ptrs(arena(), 8,  0, OrderedPair::initial), // runtime disambiguated pointer pairs
   _dg(_arena),                            // dependence graph
+  _loop_reductions(arena()),              // reduction nodes in the current loop
   _visited(arena()),                      // visited node set
   _post_visited(arena()),                 // post visited node set
   _n_idx_list(arena(), 8),                // scratch list of (node,index) pairs
@@ -66,32 +67,38 @@ SuperWord::SuperWord(PhaseIdealLoop* phase) :
 {}
 
 //------------------------------transform_loop---------------------------
-void SuperWord::transform_loop(IdealLoopTree* lpt) {
+bool SuperWord::transform_loop(IdealLoopTree* lpt) {
   assert(UseSuperWord, "should be");
   // Do vectors exist on this architecture?
-  if (Matcher::vector_width_in_bytes(T_BYTE) < 2) return;
+  if (Matcher::vector_width_in_bytes(T_BYTE) < 2) return false;
 
   assert(lpt->_head->is_CountedLoop(), "must be");
   CountedLoopNode *cl = lpt->_head->as_CountedLoop();
 
-  if (!cl->is_valid_counted_loop()) return; // skip malformed counted loop
+  if (!cl->is_valid_counted_loop()) return false; // skip malformed counted loop
 
-  if (!cl->is_main_loop() ) return; // skip normal, pre, and post loops
+  // A vector post loop has no pre-loop to align its memory references,
+  // so it is only vectorized if misaligned vectors are allowed.
+  bool vector_post_loop = cl->is_vector_post_loop() && Matcher::misaligned_vectors_ok();
+
+  if (!cl->is_main_loop() && !vector_post_loop) return false; // skip normal, pre, and post loops
 
   // Check for no control flow in body (other than exit)
   Node *cl_exit = cl->loopexit();
-  if (cl_exit->in(0) != lpt->_head) return;
+  if (cl_exit->in(0) != lpt->_head) return false;
 
   // Make sure the are no extra control users of the loop backedge
   if (cl->back_control()->outcnt() != 1) {
-    return;
+    return false;
   }
 
-  // Check for pre-loop ending with CountedLoopEnd(Bool(Cmp(x,Opaque1(limit))))
-  CountedLoopEndNode* pre_end = get_pre_loop_end(cl);
-  if (pre_end == NULL) return;
-  Node *pre_opaq1 = pre_end->limit();
-  if (pre_opaq1->Opcode() != Op_Opaque1) return;
+  if (!vector_post_loop) {
+    // Check for pre-loop ending with CountedLoopEnd(Bool(Cmp(x,Opaque1(limit))))
+    CountedLoopEndNode* pre_end = get_pre_loop_end(cl);
+    if (pre_end == NULL) return false;
+    Node *pre_opaq1 = pre_end->limit();
+    if (pre_opaq1->Opcode() != Op_Opaque1) return false;
+  }
 
   init(); // initialize data structures
 
@@ -103,6 +110,7 @@ void SuperWord::transform_loop(IdealLoopTree* lpt) {
 
   assert(_packset.length() == 0, "packset must be empty");
   SLP_extract();
+  return _packset.length() > 0;
 }
 
 //------------------------------SLP_extract---------------------------
@@ -118,24 +126,27 @@ void SuperWord::transform_loop(IdealLoopTree* lpt) {
 //    to each node is computed.  This is used to prune the graph search
 //    in the independence checker.
 //
-// 4) For integer types, the necessary bit width is propagated backwards
+// 4) Reduction cycles carried around the loop by a phi are marked, so that
+//    their nodes may be packed although each depends on the previous one.
+//
+// 5) For integer types, the necessary bit width is propagated backwards
 //    from stores to allow packed operations on byte, char, and short
 //    integers.  This reverses the promotion to type "int" that javac
 //    did for operations like: char c1,c2,c3;  c1 = c2 + c3.
 //
-// 5) One of the memory references is picked to be an aligned vector reference.
+// 6) One of the memory references is picked to be an aligned vector reference.
 //    The pre-loop trip count is adjusted to align this reference in the
 //    unrolled body.
 //
-// 6) The initial set of pack pairs is seeded with memory references.
+// 7) The initial set of pack pairs is seeded with memory references.
 //
-// 7) The set of pack pairs is extended by following use->def and def->use links.
+// 8) The set of pack pairs is extended by following use->def and def->use links.
 //
-// 8) The pairs are combined into vector sized packs.
+// 9) The pairs are combined into vector sized packs.
 //
-// 9) Reorder the memory slices to co-locate members of the memory packs.
+// 10) Reorder the memory slices to co-locate members of the memory packs.
 //
-// 10) Generate ideal vector nodes for the final set of packs and where necessary,
+// 11) Generate ideal vector nodes for the final set of packs and where necessary,
 //    inserting scalar promotion, vector creation from multiple scalars, and
 //    extraction of scalar values from vectors.
 //
@@ -150,6 +161,8 @@ void SuperWord::SLP_extract() {
 
   compute_max_depth();
 
+  mark_reductions();
+
   compute_vector_element_type();
 
   // Attempt vectorization
@@ -169,6 +182,76 @@ void SuperWord::SLP_extract() {
   output();
 }
 
+//------------------------------mark_reductions---------------------------
+// Mark the nodes of reduction cycles carried around the loop by a phi,
+// e.g. the unrolled adds in:  for (...) { sum += a[i]; }
+// Each node of the cycle combines the value from the previous one with
+// a value computed in the iteration, using the same associative
+// operation, and has no other use in the block, so that all of the
+// values combined in one pack can be reduced into the first one's input.
+void SuperWord::mark_reductions() {
+  _loop_reductions.Clear();
+  if (!SuperWordReductions) return;
+
+  for (DUIterator_Fast imax, i = lp()->fast_outs(imax); i < imax; i++) {
+    Node* phi = lp()->fast_out(i);
+    if (!phi->is_Phi() || phi == iv() || phi->outcnt() == 0) continue;
+    Node* last = phi->in(LoopNode::LoopBackControl);
+    if (last == NULL || !in_bb(last) || last->req() != 3) continue;
+    BasicType bt = last->bottom_type()->basic_type();
+    if (bt != T_INT && bt != T_LONG && bt != T_FLOAT && bt != T_DOUBLE) continue;
+    int opc = last->Opcode();
+    if (ReductionNode::opcode(opc, bt) == 0) continue;
+
+    // The value leaving the iteration may not be used within it.
+    bool single_use = true;
+    for (DUIterator_Fast jmax, j = last->fast_outs(jmax); j < jmax; j++) {
+      Node* use = last->fast_out(j);
+      if (use != phi && in_bb(use)) {
+        single_use = false;
+        break;
+      }
+    }
+    if (!single_use) continue;
+
+    _nlist.clear();
+    if (reduction_cycle(phi, last, opc, 0) && _nlist.length() > 1) {
+      for (int j = 0; j < _nlist.length(); j++) {
+        _loop_reductions.set(_nlist.at(j)->_idx);
+      }
+#ifndef PRODUCT
+      if (TraceSuperWord && Verbose) {
+        tty->print_cr("Reduction cycle of %d nodes", _nlist.length());
+        phi->dump();
+      }
+#endif
+    }
+  }
+  _nlist.clear();
+}
+
+//------------------------------reduction_cycle---------------------------
+// Helper for mark_reductions.  Is there a path of opc nodes from n back
+// to phi along which each node is only used by its successor?  The path
+// is collected in _nlist.
+bool SuperWord::reduction_cycle(Node* phi, Node* n, int opc, uint depth) {
+  if (depth > (uint)LoopMaxUnroll) return false; // stop deep recursion
+  if (n->in(1) == n->in(2)) return false;
+  _nlist.push(n);
+  for (uint j = 1; j <= 2; j++) {
+    Node* in = n->in(j);
+    if (in == phi) {
+      return true;
+    }
+    if (in_bb(in) && in->Opcode() == opc && in->outcnt() == 1 &&
+        reduction_cycle(phi, in, opc, depth + 1)) {
+      return true;
+    }
+  }
+  _nlist.pop();
+  return false;
+}
+
 //------------------------------find_adjacent_refs---------------------------
 // Find the adjacent memory references and create pack pairs for them.
 // This is the initial set of packs that will then be extended by
@@ -447,6 +530,9 @@ bool SuperWord::ref_is_alignable(SWPointer& p) {
   if (!p.has_iv()) {
     return true;   // no induction variable
   }
+  if (lp()->as_CountedLoop()->is_vector_post_loop()) {
+    return true;   // no pre-loop, vectors need not be aligned
+  }
   CountedLoopEndNode* pre_end = get_pre_loop_end(lp()->as_CountedLoop());
   assert(pre_end != NULL, "we must have a correct pre-loop");
   assert(pre_end->stride_is_con(), "pre loop stride is constant");
@@ -680,7 +766,7 @@ bool SuperWord::stmts_can_pack(Node* s1, Node* s2, int align) {
   }
 
   if (isomorphic(s1, s2)) {
-    if (independent(s1, s2)) {
+    if (independent(s1, s2) || reduction(s1, s2)) {
       if (!exists_at(s1, 0) && !exists_at(s2, 1)) {
         if (!s1->is_Mem() || are_adjacent_refs(s1, s2)) {
           int s1_align = alignment(s1);
@@ -758,6 +844,27 @@ bool SuperWord::independent(Node* s1, Node* s2) {
   return independent_path(shallow, deep);
 }
 
+//------------------------------reduction---------------------------
+// Is s2 the next node after s1 in a reduction cycle?
+bool SuperWord::reduction(Node* s1, Node* s2) {
+  if (!is_marked_reduction(s1) || !is_marked_reduction(s2)) return false;
+  return s2->in(1) == s1 || s2->in(2) == s1;
+}
+
+//------------------------------reduction_input---------------------------
+// Index of the input that carries the reduction cycle into the nodes of
+// pack p, or 0 if the nodes of p do not form a contiguous part of a cycle.
+int SuperWord::reduction_input(Node_List* p) {
+  Node* p0 = p->at(0);
+  assert(is_marked_reduction(p0) && p->size() > 1, "sanity");
+  int idx = (p->at(1)->in(1) == p0) ? 1 : 2;
+  for (uint i = 1; i < p->size(); i++) {
+    Node* pi = p->at(i);
+    if (!is_marked_reduction(pi) || pi->in(idx) != p->at(i-1)) return 0;
+  }
+  return idx;
+}
+
 //------------------------------independent_path------------------------------
 // Helper for independent
 bool SuperWord::independent_path(Node* shallow, Node* deep, uint dp) {
@@ -1108,6 +1215,9 @@ void SuperWord::filter_packs() {
 // Can code be generated for pack p?
 bool SuperWord::implemented(Node_List* p) {
   Node* p0 = p->at(0);
+  if (is_marked_reduction(p0)) {
+    return ReductionNode::implemented(p0->Opcode(), p->size(), velt_basic_type(p0));
+  }
   return VectorNode::implemented(p0->Opcode(), p->size(), velt_basic_type(p0));
 }
 
@@ -1130,6 +1240,13 @@ static bool same_inputs(Node_List* p, int idx) {
 // For pack p, are all operands and all uses (with in the block) vector?
 bool SuperWord::profitable(Node_List* p) {
   Node* p0 = p->at(0);
+  if (is_marked_reduction(p0)) {
+    // The cycle input of each node is the previous node in the pack and
+    // the other input must be a vector.  The uses are all scalar: only the
+    // last node is used outside of the cycle.
+    int idx = reduction_input(p);
+    return idx != 0 && is_vector_use(p0, 3 - idx);
+  }
   uint start, end;
   VectorNode::vector_operands(p0, &start, &end);
 
@@ -1396,7 +1513,9 @@ void SuperWord::output() {
   // MUST ENSURE main loop's initial value is properly aligned:
   //  (iv_initial_value + min_iv_offset) % vector_width_in_bytes() == 0
 
-  align_initial_loop_index(align_to_ref());
+  if (lp()->as_CountedLoop()->is_main_loop()) {
+    align_initial_loop_index(align_to_ref());
+  }
 
   // Insert extract (unpack) operations for scalar uses
   for (int i = 0; i < _packset.length(); i++) {
@@ -1445,6 +1564,15 @@ void SuperWord::output() {
         const TypePtr* atyp = n->adr_type();
         vn = StoreVectorNode::make(C, opc, ctl, mem, adr, atyp, val, vlen);
         vlen_in_bytes = vn->as_StoreVector()->memory_size();
+      } else if (is_marked_reduction(n)) {
+        // Reduce the vector of the other operands into the value
+        // entering the first node of the pack.
+        int idx = reduction_input(p);
+        assert(idx != 0, "checked in profitable");
+        Node* in1 = low_adr->in(idx);
+        Node* in2 = vector_opd(p, 3 - idx);
+        vn = ReductionNode::make(C, opc, NULL, in1, in2, velt_basic_type(n));
+        vlen_in_bytes = in2->bottom_type()->is_vect()->length_in_bytes();
       } else if (n->req() == 3) {
         // Promote operands to vector
         Node* in1 = vector_opd(p, 1);
@@ -1570,6 +1698,7 @@ Node* SuperWord::vector_opd(Node_List* p, int opd_idx) {
 // use with an extract operation.
 void SuperWord::insert_extracts(Node_List* p) {
   if (p->at(0)->is_Store()) return;
+  if (is_marked_reduction(p->at(0))) return; // the reduction is a scalar
   assert(_n_idx_list.is_empty(), "empty (node,index) list");
 
   // Inspect each use of each pack member.  For each use that is
@@ -2243,6 +2372,7 @@ void SuperWord::init() {
   _mem_slice_head.clear();
   _mem_slice_tail.clear();
   _node_info.clear();
+  _loop_reductions.Clear();
   _align_to_ref = NULL;
   _lpt = NULL;
   _lp = NULL;
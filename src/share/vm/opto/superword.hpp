@@ -228,6 +228,8 @@ class SuperWord : public ResourceObj {
 
   DepGraph _dg; // Dependence graph
 
+  VectorSet _loop_reductions; // Reduction nodes in the current loop (by node _idx)
+
   // Scratch pads
   VectorSet    _visited;       // Visited set
   VectorSet    _post_visited;  // Post-visited set
@@ -238,7 +240,8 @@ class SuperWord : public ResourceObj {
  public:
   SuperWord(PhaseIdealLoop* phase);
 
-  void transform_loop(IdealLoopTree* lpt);
+  // Returns true if vector operations were emitted for the loop
+  bool transform_loop(IdealLoopTree* lpt);
 
   // Accessors for SWPointer
   PhaseIdealLoop* phase()          { return _phase; }
@@ -312,12 +315,19 @@ class SuperWord : public ResourceObj {
   Node_List* my_pack(Node* n)                { return !in_bb(n) ? NULL : _node_info.adr_at(bb_idx(n))->_my_pack; }
   void set_my_pack(Node* n, Node_List* p)    { int i = bb_idx(n); grow_node_info(i); _node_info.adr_at(i)->_my_pack = p; }
 
+  // reductions
+  bool is_marked_reduction(Node* n)          { return _loop_reductions.test(n->_idx) != 0; }
+
   // methods
 
   // Extract the superword level parallelism
   void SLP_extract();
   // Find the adjacent memory references and create pack pairs for them.
   void find_adjacent_refs();
+  // Mark the nodes of reduction cycles carried around the loop by a phi.
+  void mark_reductions();
+  // Helper for mark_reductions, collects the cycle from n back to phi in _nlist
+  bool reduction_cycle(Node* phi, Node* n, int opc, uint depth);
   // Find a memory reference to align the loop induction variable to.
   MemNode* find_align_to_ref(Node_List &memops);
   // Calculate loop's iv adjustment for this memory ops.
@@ -338,6 +348,10 @@ class SuperWord : public ResourceObj {
   bool isomorphic(Node* s1, Node* s2);
   // Is there no data path from s1 to s2 or s2 to s1?
   bool independent(Node* s1, Node* s2);
+  // Is s2 the next node after s1 in a reduction cycle?
+  bool reduction(Node* s1, Node* s2);
+  // Index of the input that carries the reduction cycle into the nodes of pack p
+  int reduction_input(Node_List* p);
   // Helper for independent
   bool independent_path(Node* shallow, Node* deep, uint dp=0);
   void set_alignment(Node* s1, Node* s2, int align);
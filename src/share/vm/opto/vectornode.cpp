@@ -442,3 +442,90 @@ Node* ExtractNode::make(Compile* C, Node* v, uint position, BasicType bt) {
   return NULL;
 }
 
+
+//------------------------------ReductionNode-----------------------------------
+
+// Return the reduction operator for the specified scalar operation.
+int ReductionNode::opcode(int opc, BasicType bt) {
+  switch (opc) {
+  case Op_AddI:
+    assert(bt == T_INT, "must be");
+    return Op_AddReductionVI;
+  case Op_AddL:
+    assert(bt == T_LONG, "must be");
+    return Op_AddReductionVL;
+  case Op_AddF:
+    assert(bt == T_FLOAT, "must be");
+    return Op_AddReductionVF;
+  case Op_AddD:
+    assert(bt == T_DOUBLE, "must be");
+    return Op_AddReductionVD;
+  case Op_MulI:
+    assert(bt == T_INT, "must be");
+    return Op_MulReductionVI;
+  case Op_MulF:
+    assert(bt == T_FLOAT, "must be");
+    return Op_MulReductionVF;
+  case Op_MulD:
+    assert(bt == T_DOUBLE, "must be");
+    return Op_MulReductionVD;
+  case Op_AndI:
+    assert(bt == T_INT, "must be");
+    return Op_AndReductionVI;
+  case Op_AndL:
+    assert(bt == T_LONG, "must be");
+    return Op_AndReductionVL;
+  case Op_OrI:
+    assert(bt == T_INT, "must be");
+    return Op_OrReductionVI;
+  case Op_OrL:
+    assert(bt == T_LONG, "must be");
+    return Op_OrReductionVL;
+  case Op_XorI:
+    assert(bt == T_INT, "must be");
+    return Op_XorReductionVI;
+  case Op_XorL:
+    assert(bt == T_LONG, "must be");
+    return Op_XorReductionVL;
+  }
+  return 0; // Unimplemented
+}
+
+// Return the appropriate reduction node.
+ReductionNode* ReductionNode::make(Compile* C, int opc, Node *ctrl, Node* n1, Node* n2, BasicType bt) {
+
+  int vopc = opcode(opc, bt);
+
+  // This method should not be called for unimplemented vectors.
+  guarantee(vopc != 0, err_msg_res("Vector for '%s' is not implemented", NodeClassNames[opc]));
+
+  switch (vopc) {
+  case Op_AddReductionVI: return new (C) AddReductionVINode(ctrl, n1, n2);
+  case Op_AddReductionVL: return new (C) AddReductionVLNode(ctrl, n1, n2);
+  case Op_AddReductionVF: return new (C) AddReductionVFNode(ctrl, n1, n2);
+  case Op_AddReductionVD: return new (C) AddReductionVDNode(ctrl, n1, n2);
+  case Op_MulReductionVI: return new (C) MulReductionVINode(ctrl, n1, n2);
+  case Op_MulReductionVF: return new (C) MulReductionVFNode(ctrl, n1, n2);
+  case Op_MulReductionVD: return new (C) MulReductionVDNode(ctrl, n1, n2);
+  case Op_AndReductionVI: return new (C) AndReductionVINode(ctrl, n1, n2);
+  case Op_AndReductionVL: return new (C) AndReductionVLNode(ctrl, n1, n2);
+  case Op_OrReductionVI:  return new (C) OrReductionVINode(ctrl, n1, n2);
+  case Op_OrReductionVL:  return new (C) OrReductionVLNode(ctrl, n1, n2);
+  case Op_XorReductionVI: return new (C) XorReductionVINode(ctrl, n1, n2);
+  case Op_XorReductionVL: return new (C) XorReductionVLNode(ctrl, n1, n2);
+  }
+  fatal(err_msg_res("Missed vector creation for '%s'", NodeClassNames[vopc]));
+  return NULL;
+}
+
+// Also used to check if the code generator
+// supports the reduction operation.
+bool ReductionNode::implemented(int opc, uint vlen, BasicType bt) {
+  if (is_java_primitive(bt) &&
+      (vlen > 1) && is_power_of_2(vlen) &&
+      Matcher::vector_size_supported(bt, vlen)) {
+    int vopc = ReductionNode::opcode(opc, bt);
+    return vopc > 0 && Matcher::match_rule_supported(vopc);
+  }
+  return false;
+}
@@ -349,6 +349,148 @@ class XorVNode : public VectorNode {
   virtual int Opcode() const;
 };
 
+//------------------------------ReductionNode---------------------------------
+// Reduction of all elements of the vector in2 into the scalar in1,
+// e.g. in1 + in2[0] + in2[1] + ... + in2[vlen-1] for an add reduction.
+class ReductionNode : public Node {
+ public:
+  ReductionNode(Node *ctrl, Node* in1, Node* in2) : Node(ctrl, in1, in2) {}
+
+  static ReductionNode* make(Compile* C, int opc, Node *ctrl, Node* n1, Node* n2, BasicType bt);
+  static int  opcode(int opc, BasicType bt);
+  static bool implemented(int opc, uint vlen, BasicType bt);
+};
+
+//------------------------------AddReductionVINode----------------------------
+// Vector add int as a reduction
+class AddReductionVINode : public ReductionNode {
+ public:
+  AddReductionVINode(Node *ctrl, Node* in1, Node* in2) : ReductionNode(ctrl, in1, in2) {}
+  virtual int Opcode() const;
+  virtual const Type* bottom_type() const { return TypeInt::INT; }
+  virtual uint ideal_reg() const { return Op_RegI; }
+};
+
+//------------------------------AddReductionVLNode----------------------------
+// Vector add long as a reduction
+class AddReductionVLNode : public ReductionNode {
+ public:
+  AddReductionVLNode(Node *ctrl, Node* in1, Node* in2) : ReductionNode(ctrl, in1, in2) {}
+  virtual int Opcode() const;
+  virtual const Type* bottom_type() const { return TypeLong::LONG; }
+  virtual uint ideal_reg() const { return Op_RegL; }
+};
+
+//------------------------------AddReductionVFNode----------------------------
+// Vector add float as a reduction
+class AddReductionVFNode : public ReductionNode {
+ public:
+  AddReductionVFNode(Node *ctrl, Node* in1, Node* in2) : ReductionNode(ctrl, in1, in2) {}
+  virtual int Opcode() const;
+  virtual const Type* bottom_type() const { return Type::FLOAT; }
+  virtual uint ideal_reg() const { return Op_RegF; }
+};
+
+//------------------------------AddReductionVDNode----------------------------
+// Vector add double as a reduction
+class AddReductionVDNode : public ReductionNode {
+ public:
+  AddReductionVDNode(Node *ctrl, Node* in1, Node* in2) : ReductionNode(ctrl, in1, in2) {}
+  virtual int Opcode() const;
+  virtual const Type* bottom_type() const { return Type::DOUBLE; }
+  virtual uint ideal_reg() const { return Op_RegD; }
+};
+
+//------------------------------MulReductionVINode----------------------------
+// Vector multiply int as a reduction
+class MulReductionVINode : public ReductionNode {
+ public:
+  MulReductionVINode(Node *ctrl, Node* in1, Node* in2) : ReductionNode(ctrl, in1, in2) {}
+  virtual int Opcode() const;
+  virtual const Type* bottom_type() const { return TypeInt::INT; }
+  virtual uint ideal_reg() const { return Op_RegI; }
+};
+
+//------------------------------MulReductionVFNode----------------------------
+// Vector multiply float as a reduction
+class MulReductionVFNode : public ReductionNode {
+ public:
+  MulReductionVFNode(Node *ctrl, Node* in1, Node* in2) : ReductionNode(ctrl, in1, in2) {}
+  virtual int Opcode() const;
+  virtual const Type* bottom_type() const { return Type::FLOAT; }
+  virtual uint ideal_reg() const { return Op_RegF; }
+};
+
+//------------------------------MulReductionVDNode----------------------------
+// Vector multiply double as a reduction
+class MulReductionVDNode : public ReductionNode {
+ public:
+  MulReductionVDNode(Node *ctrl, Node* in1, Node* in2) : ReductionNode(ctrl, in1, in2) {}
+  virtual int Opcode() const;
+  virtual const Type* bottom_type() const { return Type::DOUBLE; }
+  virtual uint ideal_reg() const { return Op_RegD; }
+};
+
+//------------------------------AndReductionVINode----------------------------
+// Vector and int as a reduction
+class AndReductionVINode : public ReductionNode {
+ public:
+  AndReductionVINode(Node *ctrl, Node* in1, Node* in2) : ReductionNode(ctrl, in1, in2) {}
+  virtual int Opcode() const;
+  virtual const Type* bottom_type() const { return TypeInt::INT; }
+  virtual uint ideal_reg() const { return Op_RegI; }
+};
+
+//------------------------------AndReductionVLNode----------------------------
+// Vector and long as a reduction
+class AndReductionVLNode : public ReductionNode {
+ public:
+  AndReductionVLNode(Node *ctrl, Node* in1, Node* in2) : ReductionNode(ctrl, in1, in2) {}
+  virtual int Opcode() const;
+  virtual const Type* bottom_type() const { return TypeLong::LONG; }
+  virtual uint ideal_reg() const { return Op_RegL; }
+};
+
+//------------------------------OrReductionVINode-----------------------------
+// Vector or int as a reduction
+class OrReductionVINode : public ReductionNode {
+ public:
+  OrReductionVINode(Node *ctrl, Node* in1, Node* in2) : ReductionNode(ctrl, in1, in2) {}
+  virtual int Opcode() const;
+  virtual const Type* bottom_type() const { return TypeInt::INT; }
+  virtual uint ideal_reg() const { return Op_RegI; }
+};
+
+//------------------------------OrReductionVLNode-----------------------------
+// Vector or long as a reduction
+class OrReductionVLNode : public ReductionNode {
+ public:
+  OrReductionVLNode(Node *ctrl, Node* in1, Node* in2) : ReductionNode(ctrl, in1, in2) {}
+  virtual int Opcode() const;
+  virtual const Type* bottom_type() const { return TypeLong::LONG; }
+  virtual uint ideal_reg() const { return Op_RegL; }
+};
+
+//------------------------------XorReductionVINode----------------------------
+// Vector xor int as a reduction
+class XorReductionVINode : public ReductionNode {
+ public:
+  XorReductionVINode(Node *ctrl, Node* in1, Node* in2) : ReductionNode(ctrl, in1, in2) {}
+  virtual int Opcode() const;
+  virtual const Type* bottom_type() const { return TypeInt::INT; }
+  virtual uint ideal_reg() const { return Op_RegI; }
+};
+
+//------------------------------XorReductionVLNode----------------------------
+// Vector xor long as a reduction
+class XorReductionVLNode : public ReductionNode {
+ public:
+  XorReductionVLNode(Node *ctrl, Node* in1, Node* in2) : ReductionNode(ctrl, in1, in2) {}
+  virtual int Opcode() const;
+  virtual const Type* bottom_type() const { return TypeLong::LONG; }
+  virtual uint ideal_reg() const { return Op_RegL; }
+};
+
 //================================= M E M O R Y ===============================
 
 //------------------------------LoadVectorNode---------------------------------
@@ -23,6 +23,7 @@
  */
 
 #include "precompiled.hpp"
+#include "compiler/compilerCPUBudget.hpp"
 #include "runtime/advancedThresholdPolicy.hpp"
 #include "runtime/simpleThresholdPolicy.inline.hpp"
 
@@ -230,24 +231,39 @@ double AdvancedThresholdPolicy::threshold_scale(CompLevel level, int feedback_k)
       k *= exp(current_reverse_free_ratio - _increase_threshold_at_ratio);
     }
   }
+  // Under a compiler CPU budget, queue only hotter methods while the
+  // compiler threads are over it
+  if (CompilerCPUBudget::is_enabled()) {
+    k *= CompilerCPUBudget::threshold_scale();
+  }
   return k;
 }
 
+// Compiled LambdaForms are compiled early: they are small, they are inlined
+// by the time the hot code calling them is compiled, and their profile only
+// feeds the compilation of the LambdaForm itself.
+double AdvancedThresholdPolicy::method_scale(Method* method) {
+  if (method->is_compiled_lambda_form()) {
+    return TierLambdaFormThresholdPercentage / 100.0;
+  }
+  return 1.0;
+}
+
 // Call and loop predicates determine whether a transition to a higher
 // compilation level should be performed (pointers to predicate functions
 // are passed to common()).
 // Tier?LoadFeedback is basically a coefficient that determines of
 // how many methods per compiler thread can be in the queue before
 // the threshold values double.
-bool AdvancedThresholdPolicy::loop_predicate(int i, int b, CompLevel cur_level) {
+bool AdvancedThresholdPolicy::loop_predicate(int i, int b, CompLevel cur_level, Method* method) {
   switch(cur_level) {
   case CompLevel_none:
   case CompLevel_limited_profile: {
-    double k = threshold_scale(CompLevel_full_profile, Tier3LoadFeedback);
+    double k = threshold_scale(CompLevel_full_profile, Tier3LoadFeedback) * method_scale(method);
     return loop_predicate_helper<CompLevel_none>(i, b, k);
   }
   case CompLevel_full_profile: {
-    double k = threshold_scale(CompLevel_full_optimization, Tier4LoadFeedback);
+    double k = threshold_scale(CompLevel_full_optimization, Tier4LoadFeedback) * method_scale(method);
     return loop_predicate_helper<CompLevel_full_profile>(i, b, k);
   }
   default:
@@ -255,15 +271,15 @@ bool AdvancedThresholdPolicy::loop_predicate(int i, int b, CompLevel cur_level)
   }
 }
 
-bool AdvancedThresholdPolicy::call_predicate(int i, int b, CompLevel cur_level) {
+bool AdvancedThresholdPolicy::call_predicate(int i, int b, CompLevel cur_level, Method* method) {
   switch(cur_level) {
   case CompLevel_none:
   case CompLevel_limited_profile: {
-    double k = threshold_scale(CompLevel_full_profile, Tier3LoadFeedback);
+    double k = threshold_scale(CompLevel_full_profile, Tier3LoadFeedback) * method_scale(method);
     return call_predicate_helper<CompLevel_none>(i, b, k);
   }
   case CompLevel_full_profile: {
-    double k = threshold_scale(CompLevel_full_optimization, Tier4LoadFeedback);
+    double k = threshold_scale(CompLevel_full_optimization, Tier4LoadFeedback) * method_scale(method);
     return call_predicate_helper<CompLevel_full_profile>(i, b, k);
   }
   default:
@@ -358,7 +374,7 @@ CompLevel AdvancedThresholdPolicy::common(Predicate p, Method* method, CompLevel
       // If we were at full profile level, would we switch to full opt?
       if (common(p, method, CompLevel_full_profile, disable_feedback) == CompLevel_full_optimization) {
         next_level = CompLevel_full_optimization;
-      } else if ((this->*p)(i, b, cur_level)) {
+      } else if ((this->*p)(i, b, cur_level, method)) {
         // C1-generated fully profiled code is about 30% slower than the limited profile
         // code that has only invocation and backedge counters. The observation is that
         // if C2 queue is large enough we can spend too much time in the fully profiled code
@@ -384,7 +400,7 @@ CompLevel AdvancedThresholdPolicy::common(Predicate p, Method* method, CompLevel
           if (mdo->would_profile()) {
             if (disable_feedback || (CompileBroker::queue_size(CompLevel_full_optimization) <=
                                      Tier3DelayOff * compiler_count(CompLevel_full_optimization) &&
-                                     (this->*p)(i, b, cur_level))) {
+                                     (this->*p)(i, b, cur_level, method))) {
               next_level = CompLevel_full_profile;
             }
           } else {
@@ -400,7 +416,7 @@ CompLevel AdvancedThresholdPolicy::common(Predicate p, Method* method, CompLevel
           if (mdo->would_profile()) {
             int mdo_i = mdo->invocation_count_delta();
             int mdo_b = mdo->backedge_count_delta();
-            if ((this->*p)(mdo_i, mdo_b, cur_level)) {
+            if ((this->*p)(mdo_i, mdo_b, cur_level, method)) {
               next_level = CompLevel_full_optimization;
             }
           } else {
@@ -164,9 +164,9 @@ class AdvancedThresholdPolicy : public SimpleThresholdPolicy {
   // Call and loop predicates determine whether a transition to a higher compilation
   // level should be performed (pointers to predicate functions are passed to common().
   // Predicates also take compiler load into account.
-  typedef bool (AdvancedThresholdPolicy::*Predicate)(int i, int b, CompLevel cur_level);
-  bool call_predicate(int i, int b, CompLevel cur_level);
-  bool loop_predicate(int i, int b, CompLevel cur_level);
+  typedef bool (AdvancedThresholdPolicy::*Predicate)(int i, int b, CompLevel cur_level, Method* method);
+  bool call_predicate(int i, int b, CompLevel cur_level, Method* method);
+  bool loop_predicate(int i, int b, CompLevel cur_level, Method* method);
   // Common transition function. Given a predicate determines if a method should transition to another level.
   CompLevel common(Predicate p, Method* method, CompLevel cur_level, bool disable_feedback = false);
   // Transition functions.
@@ -192,6 +192,8 @@ class AdvancedThresholdPolicy : public SimpleThresholdPolicy {
   inline void update_rate(jlong t, Method* m);
   // Compute threshold scaling coefficient
   inline double threshold_scale(CompLevel level, int feedback_k);
+  // Compute the scaling coefficient for the thresholds of a given method
+  inline double method_scale(Method* method);
   // If a method is old enough and is still in the interpreter we would want to
   // start profiling without waiting for the compiled method to arrive. This function
   // determines whether we should do that.
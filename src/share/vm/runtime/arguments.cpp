@@ -32,6 +32,7 @@
 #include "memory/genCollectedHeap.hpp"
 #include "memory/referenceProcessor.hpp"
 #include "memory/universe.inline.hpp"
+#include "oops/compiledICHolder.hpp"
 #include "oops/oop.inline.hpp"
 #include "prims/jvmtiExport.hpp"
 #include "runtime/arguments.hpp"
@@ -2324,6 +2325,16 @@ bool Arguments::check_vm_args_consistency() {
   status = status && verify_interval(SymbolTableSize, minimumSymbolTableSize,
     (max_uintx / SymbolTable::bucket_size()), "SymbolTable size");
 
+  if (ItableStubCacheSize < 1 || ItableStubCacheSize > CompiledICHolder::ItableStubCacheMaxSize ||
+      !is_power_of_2(ItableStubCacheSize)) {
+    jio_fprintf(defaultStream::error_stream(),
+                "ItableStubCacheSize (" INTX_FORMAT ") must be a power of 2 "
+                "between 1 and %d\n",
+                ItableStubCacheSize, CompiledICHolder::ItableStubCacheMaxSize);
+    status = false;
+  }
+  status = status && verify_min_value(ItableStubCacheMissLimit, 0, "ItableStubCacheMissLimit");
+
   {
     // Using "else if" below to avoid printing two error messages if min > max.
     // This will also prevent us from reporting both min>100 and max>100 at the
@@ -2528,6 +2539,22 @@ bool Arguments::check_vm_args_consistency() {
 
   status = status && verify_min_value(LogEventsBufferEntries, 1, "LogEventsBufferEntries");
 
+  status = status && verify_min_value(SafepointLatecomerThreshold, 0, "SafepointLatecomerThreshold");
+  status = status && verify_interval(SafepointLatecomerCount, 1, 64, "SafepointLatecomerCount");
+
+  if (AsyncLogging) {
+    status = status && verify_interval(AsyncLogBufferSize, 4*K, 64*M, "AsyncLogBufferSize");
+    if (!is_power_of_2(AsyncLogBufferSize)) {
+      jio_fprintf(defaultStream::error_stream(),
+                  "error: AsyncLogBufferSize=" UINTX_FORMAT " must be power of 2\n",
+                  AsyncLogBufferSize);
+      status = false;
+    }
+    status = status && verify_interval(AsyncLogFlushInterval, 1, max_jint, "AsyncLogFlushInterval");
+  }
+
+  status = status && verify_interval(JNIGlobalHandleStripes, 0, 1024, "JNIGlobalHandleStripes");
+
   status = status && verify_min_value(HeapSizePerGCThread, (uintx) os::vm_page_size(), "HeapSizePerGCThread");
 
   status = status && verify_min_value(GCTaskTimeStampEntries, 1, "GCTaskTimeStampEntries");
@@ -2560,8 +2587,12 @@ bool Arguments::check_vm_args_consistency() {
   status = status && verify_percentage(MarkSweepDeadRatio, "MarkSweepDeadRatio");
 
   status = status && verify_min_value(MarkSweepAlwaysCompactCount, 1, "MarkSweepAlwaysCompactCount");
+  status = status && verify_interval(TierLambdaFormThresholdPercentage, 1, 100, "TierLambdaFormThresholdPercentage");
+  status = status && verify_interval(CompilerCPUBudgetPercentage, 0, 100, "CompilerCPUBudgetPercentage");
+  status = status && verify_min_value(CompilerCPUBudgetWindow, 1, "CompilerCPUBudgetWindow");
 #ifdef COMPILER1
   status = status && verify_min_value(ValueMapInitialSize, 1, "ValueMapInitialSize");
+  status = status && verify_interval(C1ProfileBranchSampleLog, 0, 14, "C1ProfileBranchSampleLog");
 #endif
 
   if (PrintNMTStatistics) {
@@ -0,0 +1,327 @@
+/*
+ * Copyright (c) 2016, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "runtime/asyncLogWriter.hpp"
+#include "runtime/globals.hpp"
+#include "runtime/mutexLocker.hpp"
+#include "runtime/orderAccess.inline.hpp"
+#include "runtime/os.hpp"
+#include "runtime/thread.inline.hpp"
+#include "runtime/threadLocalStorage.hpp"
+#include "utilities/log.hpp"
+
+// ======= AsyncLogBuffer ========
+
+AsyncLogBuffer::AsyncLogBuffer(size_t capacity) :
+  _capacity(capacity), _head(0), _committed(0), _tail(0),
+  _open_target(NULL), _open_start(0),
+  _dropped(0), _dropped_reported(0), _dropped_target(NULL),
+  _released(0), _next(NULL) {
+  assert(is_power_of_2(capacity), "capacity must be a power of two");
+  _data = NEW_C_HEAP_ARRAY(char, capacity, mtInternal);
+}
+
+AsyncLogBuffer::~AsyncLogBuffer() {
+  FREE_C_HEAP_ARRAY(char, _data, mtInternal);
+}
+
+size_t AsyncLogBuffer::free_space() const {
+  size_t tail = (size_t)OrderAccess::load_ptr_acquire((volatile intptr_t*)&_tail);
+  return _capacity - (_head - tail);
+}
+
+bool AsyncLogBuffer::is_half_full() const {
+  return free_space() < _capacity / 2;
+}
+
+void AsyncLogBuffer::copy_in(size_t pos, const void* src, size_t len) {
+  size_t index = pos & (_capacity - 1);
+  size_t first = MIN2(len, _capacity - index);
+  memcpy(_data + index, src, first);
+  memcpy(_data, (const char*)src + first, len - first);
+}
+
+void AsyncLogBuffer::copy_out(size_t pos, void* dst, size_t len) const {
+  size_t index = pos & (_capacity - 1);
+  size_t first = MIN2(len, _capacity - index);
+  memcpy(dst, _data + index, first);
+  memcpy((char*)dst + first, _data, len - first);
+}
+
+// Completes the open record and makes it visible to the writer thread.
+void AsyncLogBuffer::commit() {
+  if (_open_target == NULL) {
+    return;
+  }
+  RecordHeader header;
+  header._target = _open_target;
+  header._length = _head - _open_start - sizeof(RecordHeader);
+  copy_in(_open_start, &header, sizeof(RecordHeader));
+  _open_target = NULL;
+  OrderAccess::release_store_ptr((volatile intptr_t*)&_committed, (intptr_t)_head);
+}
+
+void AsyncLogBuffer::write(outputStream* target, const char* s, size_t len) {
+  if (_open_target != target) {
+    commit();
+  }
+  size_t needed = len + (_open_target == NULL ? sizeof(RecordHeader) : 0);
+  if (needed > free_space()) {
+    // Never wait for the writer thread; the logging thread may be one the
+    // writer indirectly depends on, e.g. the VM thread during a safepoint.
+    _dropped_target = target;
+    OrderAccess::release_store_ptr((volatile intptr_t*)&_dropped, (intptr_t)(_dropped + len));
+    AsyncLogWriter::wake_up();
+    return;
+  }
+  if (_open_target == NULL) {
+    _open_target = target;
+    _open_start = _head;
+    _head += sizeof(RecordHeader);
+  }
+  copy_in(_head, s, len);
+  _head += len;
+
+  // Publish complete lines. A record that grows large without a line end
+  // is published as well, so that it can't fill the buffer on its own.
+  if (s[len - 1] == '\n' || _head - _open_start > _capacity / 4) {
+    commit();
+    if (is_half_full()) {
+      AsyncLogWriter::wake_up();
+    }
+  }
+}
+
+// Called when the owning thread exits. The writer thread frees the buffer
+// once everything in it has been written out.
+void AsyncLogBuffer::release() {
+  commit();
+  OrderAccess::release_store(&_released, 1);
+  AsyncLogWriter::wake_up();
+}
+
+void AsyncLogBuffer::drain() {
+  size_t committed = (size_t)OrderAccess::load_ptr_acquire((volatile intptr_t*)&_committed);
+  size_t tail = _tail;
+  while (tail < committed) {
+    RecordHeader header;
+    copy_out(tail, &header, sizeof(RecordHeader));
+    tail += sizeof(RecordHeader);
+    size_t index = tail & (_capacity - 1);
+    size_t first = MIN2(header._length, _capacity - index);
+    header._target->write(_data + index, first);
+    if (first < header._length) {
+      header._target->write(_data, header._length - first);
+    }
+    tail += header._length;
+  }
+  OrderAccess::release_store_ptr((volatile intptr_t*)&_tail, (intptr_t)tail);
+
+  size_t dropped = (size_t)OrderAccess::load_ptr_acquire((volatile intptr_t*)&_dropped);
+  if (dropped != _dropped_reported) {
+    _dropped_target->print_cr("[" SIZE_FORMAT " bytes of log output dropped, consider increasing AsyncLogBufferSize]",
+                              dropped - _dropped_reported);
+    _dropped_reported = dropped;
+  }
+}
+
+// ======= AsyncLogStream ========
+
+AsyncLogStream::AsyncLogStream(outputStream* target) : outputStream(), _target(target) {
+  // Keep the time stamps printed by the GC in sync with the target
+  _stamp.update_to(target->time_stamp().ticks());
+}
+
+void AsyncLogStream::write(const char* s, size_t len) {
+  if (len == 0) {
+    return;
+  }
+  Thread* thread = ThreadLocalStorage::thread();
+  if (thread == NULL || !AsyncLogWriter::is_running()) {
+    // Threads unknown to the VM and logging during startup and shutdown
+    // write directly.
+    _target->write(s, len);
+  } else {
+    AsyncLogBuffer* buffer = thread->async_log_buffer();
+    if (buffer == NULL) {
+      buffer = new AsyncLogBuffer(AsyncLogBufferSize);
+      thread->set_async_log_buffer(buffer);
+      AsyncLogWriter::add_buffer(buffer);
+    }
+    buffer->write(_target, s, len);
+  }
+  update_position(s, len);
+}
+
+void AsyncLogStream::flush() {
+  AsyncLogWriter::wake_up();
+}
+
+void AsyncLogStream::rotate_log(bool force, outputStream* out) {
+  // Size based rotation is done by the writer thread, after it has written
+  // out the buffers. A forced rotation must have happened when the call
+  // returns, so everything buffered so far is written out here.
+  if (force) {
+    MutexLockerEx ml(AsyncLog_lock, Mutex::_no_safepoint_check_flag);
+    AsyncLogWriter::drain_all();
+    _target->rotate_log(force, out);
+  }
+}
+
+// ======= AsyncLogWriter ========
+
+AsyncLogWriter*          AsyncLogWriter::_instance         = NULL;
+AsyncLogBuffer* volatile AsyncLogWriter::_buffers          = NULL;
+AsyncLogStream*          AsyncLogWriter::_gc_log           = NULL;
+AsyncLogStream*          AsyncLogWriter::_tagged_log       = NULL;
+volatile bool            AsyncLogWriter::_should_terminate = false;
+volatile jint            AsyncLogWriter::_running          = 0;
+
+AsyncLogWriter::AsyncLogWriter() : NamedThread() {
+  set_name("Async Log Thread");
+  if (os::create_thread(this, os::os_thread)) {
+    _instance = this;
+    if (!DisableStartThread) {
+      os::start_thread(this);
+    }
+  }
+}
+
+void AsyncLogWriter::add_buffer(AsyncLogBuffer* buffer) {
+  AsyncLogBuffer* head;
+  do {
+    head = _buffers;
+    buffer->_next = head;
+  } while (Atomic::cmpxchg_ptr(buffer, &_buffers, head) != head);
+}
+
+void AsyncLogWriter::drain_all() {
+  assert(AsyncLog_lock->owned_by_self(), "AsyncLog_lock required");
+  // Producers only ever push at the head of the list, so everything but
+  // the head can be unlinked without synchronization.
+  AsyncLogBuffer* prev = NULL;
+  AsyncLogBuffer* cur = (AsyncLogBuffer*)OrderAccess::load_ptr_acquire(&_buffers);
+  while (cur != NULL) {
+    bool released = OrderAccess::load_acquire(&cur->_released) != 0;
+    cur->drain();
+    AsyncLogBuffer* next = cur->_next;
+    if (released && prev != NULL && cur->_tail == cur->_committed) {
+      prev->_next = next;
+      delete cur;
+    } else {
+      prev = cur;
+    }
+    cur = next;
+  }
+}
+
+void AsyncLogWriter::wake_up() {
+  AsyncLogWriter* writer = _instance;
+  if (writer != NULL && is_running()) {
+    writer->_ParkEvent->unpark();
+  }
+}
+
+void AsyncLogWriter::run() {
+  assert(this == writer_thread(), "just checking");
+
+  this->record_stack_base_and_size();
+  this->initialize_thread_local_storage();
+  this->set_native_thread_name(this->name());
+
+  while (!_should_terminate) {
+    {
+      MutexLockerEx ml(AsyncLog_lock, Mutex::_no_safepoint_check_flag);
+      if (!is_running()) {
+        break;
+      }
+      drain_all();
+      if (_gc_log != NULL && UseGCLogFileRotation) {
+        _gc_log->target()->rotate_log(false);
+      }
+    }
+    _ParkEvent->park(AsyncLogFlushInterval);
+  }
+
+  // Thread destructor usually does this..
+  ThreadLocalStorage::set_thread(NULL);
+}
+
+void AsyncLogWriter::initialize() {
+  if (!AsyncLogging) {
+    return;
+  }
+  new AsyncLogWriter();
+  if (_instance == NULL) {
+    warning("Failed to start the asynchronous log writer thread, logging synchronously");
+    return;
+  }
+  _gc_log = new(ResourceObj::C_HEAP, mtInternal) AsyncLogStream(gclog_or_tty);
+  gclog_or_tty = _gc_log;
+  if (Log::output() != NULL) {
+    _tagged_log = new(ResourceObj::C_HEAP, mtInternal) AsyncLogStream(Log::output());
+    Log::set_output(_tagged_log);
+  }
+  OrderAccess::release_store(&_running, 1);
+}
+
+void AsyncLogWriter::stop() {
+  if (_instance == NULL || ThreadLocalStorage::thread() == NULL) {
+    return;
+  }
+  MutexLockerEx ml(AsyncLog_lock, Mutex::_no_safepoint_check_flag);
+  if (!is_running()) {
+    // Already stopped
+    return;
+  }
+  // From now on, threads write directly to the target streams
+  OrderAccess::release_store(&_running, 0);
+  _should_terminate = true;
+  if (_gc_log != NULL) {
+    gclog_or_tty = _gc_log->target();
+  }
+  if (_tagged_log != NULL) {
+    Log::set_output(_tagged_log->target());
+  }
+  OrderAccess::fence();
+  drain_all();
+  _instance->_ParkEvent->unpark();
+}
+
+void AsyncLogWriter::flush_on_abort() {
+  if (_instance == NULL || !is_running() || ThreadLocalStorage::thread() == NULL) {
+    return;
+  }
+  if (AsyncLog_lock->try_lock()) {
+    drain_all();
+    AsyncLog_lock->unlock();
+  }
+}
+
+void AsyncLogWriter::print_on(outputStream* st) const {
+  st->print("\"%s\" ", name());
+  Thread::print_on(st);
+  st->cr();
+}
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2016, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_VM_RUNTIME_ASYNCLOGWRITER_HPP
+#define SHARE_VM_RUNTIME_ASYNCLOGWRITER_HPP
+
+#include "memory/allocation.hpp"
+#include "runtime/thread.hpp"
+#include "utilities/ostream.hpp"
+
+// Asynchronous logging
+//
+// With -XX:+AsyncLogging, the GC log (gclog_or_tty) and the tagged log
+// output (see utilities/log.hpp) are wrapped in AsyncLogStreams. A thread
+// writing to such a stream does not touch the underlying file; it appends
+// the bytes to its own AsyncLogBuffer, and the AsyncLogWriter thread drains
+// all buffers to the real streams in the background. A thread that logs
+// during a pause therefore never waits for the disk, nor for a lock held
+// by another logging thread.
+//
+// Each buffer is a single-producer single-consumer ring: the owning thread
+// is the only producer and the writer thread the only consumer, so neither
+// side needs a lock. Output is published one complete line at a time, so
+// lines from different threads are never interleaved. When a buffer is
+// full, new output is dropped rather than waited for, and the number of
+// dropped bytes is reported in the log.
+
+class AsyncLogStream;
+
+class AsyncLogBuffer : public CHeapObj<mtInternal> {
+  friend class AsyncLogWriter;
+ private:
+  struct RecordHeader {
+    outputStream* _target;
+    size_t        _length;
+  };
+
+  char*             _data;
+  size_t            _capacity;        // power of two
+  // Positions are never wrapped; the index into _data is pos & (_capacity - 1)
+  size_t            _head;            // next byte to write, producer only
+  volatile size_t   _committed;       // end of the last published record
+  volatile size_t   _tail;            // next byte to read, consumer only
+
+  outputStream*     _open_target;     // target of the record being appended, or NULL
+  size_t            _open_start;      // position of the header of the open record
+
+  volatile size_t   _dropped;         // bytes dropped because the buffer was full
+  size_t            _dropped_reported;
+  outputStream*     _dropped_target;
+
+  volatile jint     _released;        // the owning thread has exited
+  AsyncLogBuffer*   _next;            // list of all buffers, see AsyncLogWriter
+
+  size_t free_space() const;
+  void copy_in(size_t pos, const void* src, size_t len);
+  void copy_out(size_t pos, void* dst, size_t len) const;
+  void commit();
+
+  // Consumer side
+  void drain();
+
+ public:
+  AsyncLogBuffer(size_t capacity);
+  ~AsyncLogBuffer();
+
+  // Producer side, only called by the owning thread
+  void write(outputStream* target, const char* s, size_t len);
+  void release();
+
+  bool is_half_full() const;
+};
+
+// An outputStream that forwards everything written to it to the
+// AsyncLogWriter, which writes it to the target stream.
+class AsyncLogStream : public outputStream {
+ private:
+  outputStream* _target;
+
+ public:
+  AsyncLogStream(outputStream* target);
+
+  outputStream* target() const { return _target; }
+
+  virtual void write(const char* s, size_t len);
+  // Asks the writer thread to write out what has been buffered, but does
+  // not wait for it.
+  virtual void flush();
+  virtual void rotate_log(bool force, outputStream* out = NULL);
+};
+
+class AsyncLogWriter : public NamedThread {
+  friend class AsyncLogBuffer;
+  friend class AsyncLogStream;
+ private:
+  static AsyncLogWriter*          _instance;
+  static AsyncLogBuffer* volatile _buffers;         // all buffers, pushed by producers
+  static AsyncLogStream*          _gc_log;          // wrapper of gclog_or_tty
+  static AsyncLogStream*          _tagged_log;      // wrapper of the tagged log output
+  static volatile bool            _should_terminate;
+  static volatile jint            _running;
+
+  AsyncLogWriter();
+
+  static void add_buffer(AsyncLogBuffer* buffer);
+  // Writes out all buffered output. Caller must hold AsyncLog_lock.
+  static void drain_all();
+  static void wake_up();
+
+ public:
+  virtual void run();
+  void print_on(outputStream* st) const;
+
+  static AsyncLogWriter* writer_thread()        { return _instance; }
+  static bool is_running()                      { return _running != 0; }
+
+  // Starts the writer thread and redirects the GC log and the tagged log
+  // output through it. Does nothing unless AsyncLogging is set.
+  static void initialize();
+  // Writes out all buffered output and restores synchronous logging.
+  // Called during VM shutdown, from before_exit() and again from
+  // ostream_exit() for exits that skip before_exit(); later calls do
+  // nothing.
+  static void stop();
+  // Best effort attempt to write out buffered output when the VM is about
+  // to die. Does not wait if the writer thread is busy.
+  static void flush_on_abort();
+};
+
+#endif // SHARE_VM_RUNTIME_ASYNCLOGWRITER_HPP
@@ -37,10 +37,12 @@
 #include "oops/method.hpp"
 #include "oops/oop.inline.hpp"
 #include "prims/jvmtiThreadState.hpp"
+#include "runtime/atomic.inline.hpp"
 #include "runtime/biasedLocking.hpp"
 #include "runtime/compilationPolicy.hpp"
 #include "runtime/deoptimization.hpp"
 #include "runtime/interfaceSupport.hpp"
+#include "runtime/safepoint.hpp"
 #include "runtime/sharedRuntime.hpp"
 #include "runtime/signature.hpp"
 #include "runtime/stubRoutines.hpp"
@@ -239,7 +241,7 @@ Deoptimization::UnrollBlock* Deoptimization::fetch_unroll_info_helper(JavaThread
       }
       if (objects != NULL) {
         JRT_BLOCK
-          realloc_failures = realloc_objects(thread, &deoptee, objects, THREAD);
+          realloc_failures = realloc_objects(thread, &deoptee, &map, objects, THREAD);
         JRT_END
         reassign_fields(&deoptee, &map, objects, realloc_failures);
 #ifndef PRODUCT
@@ -748,7 +750,7 @@ int Deoptimization::deoptimize_dependents() {
 
 
 #ifdef COMPILER2
-bool Deoptimization::realloc_objects(JavaThread* thread, frame* fr, GrowableArray<ScopeValue*>* objects, TRAPS) {
+bool Deoptimization::realloc_objects(JavaThread* thread, frame* fr, RegisterMap* reg_map, GrowableArray<ScopeValue*>* objects, TRAPS) {
   Handle pending_exception(thread->pending_exception());
   const char* exception_file = thread->exception_file();
   int exception_line = thread->exception_line();
@@ -770,10 +772,17 @@ bool Deoptimization::realloc_objects(JavaThread* thread, frame* fr, GrowableArra
       TypeArrayKlass* ak = TypeArrayKlass::cast(k());
       assert(sv->field_size() % type2size[ak->element_type()] == 0, "non-integral array length");
       int len = sv->field_size() / type2size[ak->element_type()];
+      if (sv->has_length()) {
+        len = array_length(fr, reg_map, sv, len);
+      }
       obj = ak->allocate(len, THREAD);
     } else if (k->oop_is_objArray()) {
       ObjArrayKlass* ak = ObjArrayKlass::cast(k());
-      obj = ak->allocate(sv->field_size(), THREAD);
+      int len = sv->field_size();
+      if (sv->has_length()) {
+        len = array_length(fr, reg_map, sv, len);
+      }
+      obj = ak->allocate(len, THREAD);
     }
 
     if (obj == NULL) {
@@ -878,12 +887,23 @@ public:
   }
 };
 
+// length of an eliminated array which was only bounded at compile time;
+// the debug information describes the elements up to the bound
+int Deoptimization::array_length(frame* fr, RegisterMap* reg_map, ObjectValue* sv, int bound) {
+  StackValue* value = StackValue::create_stack_value(fr, reg_map, sv->length());
+  assert(value->type() == T_INT, "Agreement.");
+  int len = (int)value->get_int();
+  assert(0 <= len && len <= bound, "array length out of the compiled bound");
+  return len;
+}
+
 // restore elements of an eliminated type array
 void Deoptimization::reassign_type_array_elements(frame* fr, RegisterMap* reg_map, ObjectValue* sv, typeArrayOop obj, BasicType type) {
   int index = 0;
   intptr_t val;
+  int nfields = MIN2(sv->field_size(), obj->length() * type2size[type]);
 
-  for (int i = 0; i < sv->field_size(); i++) {
+  for (int i = 0; i < nfields; i++) {
     StackValue* value = StackValue::create_stack_value(fr, reg_map, sv->field_at(i));
     switch(type) {
     case T_LONG: case T_DOUBLE: {
@@ -945,7 +965,8 @@ void Deoptimization::reassign_type_array_elements(frame* fr, RegisterMap* reg_ma
 
 // restore fields of an eliminated object array
 void Deoptimization::reassign_object_array_elements(frame* fr, RegisterMap* reg_map, ObjectValue* sv, objArrayOop obj) {
-  for (int i = 0; i < sv->field_size(); i++) {
+  int nfields = MIN2(sv->field_size(), obj->length());
+  for (int i = 0; i < nfields; i++) {
     StackValue* value = StackValue::create_stack_value(fr, reg_map, sv->field_at(i));
     assert(value->type() == T_OBJECT, "object element expected");
     obj->obj_at_put(i, value->get_obj()());
@@ -1311,6 +1332,12 @@ void Deoptimization::load_class_by_index(constantPoolHandle constant_pool, int i
   }
 }
 
+// Uncommon traps are taken by many threads at once, and a plain increment
+// of a PerfCounter may lose updates
+static void inc_perf_counter(PerfCounter* counter) {
+  Atomic::add((jlong)1, (volatile jlong*)counter->get_address());
+}
+
 JRT_ENTRY(void, Deoptimization::uncommon_trap_inner(JavaThread* thread, jint trap_request)) {
   HandleMark hm;
 
@@ -1500,6 +1527,7 @@ JRT_ENTRY(void, Deoptimization::uncommon_trap_inner(JavaThread* thread, jint tra
     bool make_not_entrant = false;
     bool make_not_compilable = false;
     bool reprofile = false;
+    bool backoff = false;
     switch (action) {
     case Action_none:
       // Keep the old code.
@@ -1624,6 +1652,17 @@ JRT_ENTRY(void, Deoptimization::uncommon_trap_inner(JavaThread* thread, jint tra
         reprofile = true;
       }
 
+      // A method which keeps trapping for the same reason after being
+      // recompiled again and again is left to the lower tiers, long
+      // before PerMethodRecompilationCutoff would stop the cycle.
+      if (UseDeoptimizationBackoff && make_not_entrant && maybe_prior_recompile
+          && this_trap_count >= (uint)DeoptimizationBackoffLimit) {
+        MethodData* nm_mdo = nm->method()->method_data();
+        if (nm_mdo != NULL && nm_mdo->decompile_count() >= (uint)DeoptimizationBackoffLimit) {
+          backoff = true;
+          make_not_compilable = true;
+        }
+      }
     }
 
     // Take requested actions on the method:
@@ -1634,6 +1673,15 @@ JRT_ENTRY(void, Deoptimization::uncommon_trap_inner(JavaThread* thread, jint tra
         return; // the call did not change nmethod's state
       }
 
+      Atomic::inc(&_recompile_count);
+      if (_perf_recompile_count != NULL) {
+        inc_perf_counter(_perf_recompile_count);
+      }
+      Events::log_deopt_message(thread, "Recompile: reason=%s method=%s compile_id=%d decompiles=%d",
+                                trap_reason_name(reason), nm->method()->name_and_sig_as_C_string(),
+                                nm->compile_id(),
+                                nm->method()->method_data() == NULL ? 0 : nm->method()->method_data()->decompile_count());
+
       if (pdata != NULL) {
         // Record the recompilation event, if any.
         int tstate0 = pdata->trap_state();
@@ -1676,7 +1724,18 @@ JRT_ENTRY(void, Deoptimization::uncommon_trap_inner(JavaThread* thread, jint tra
     // Give up compiling
     if (make_not_compilable && !nm->method()->is_not_compilable(CompLevel_full_optimization)) {
       assert(make_not_entrant, "consistent");
-      nm->method()->set_not_compilable(CompLevel_full_optimization);
+      if (backoff) {
+        Atomic::inc(&_backoff_count);
+        if (_perf_backoff_count != NULL) {
+          inc_perf_counter(_perf_backoff_count);
+        }
+        Events::log_deopt_message(thread, "Backoff: reason=%s method=%s is no longer compiled at level %d",
+                                  trap_reason_name(reason), nm->method()->name_and_sig_as_C_string(),
+                                  CompLevel_full_optimization);
+        nm->method()->set_not_compilable(CompLevel_full_optimization, true, "repeated deoptimization (UseDeoptimizationBackoff)");
+      } else {
+        nm->method()->set_not_compilable(CompLevel_full_optimization);
+      }
     }
 
   } // Free marked resources
@@ -1959,6 +2018,12 @@ juint Deoptimization::_deoptimization_hist
         [Deoptimization::BC_CASE_LIMIT]
   = {0};
 
+PerfCounter* Deoptimization::_perf_deoptimization_count[Deoptimization::Reason_LIMIT] = {0};
+PerfCounter* Deoptimization::_perf_recompile_count = NULL;
+PerfCounter* Deoptimization::_perf_backoff_count = NULL;
+volatile jint Deoptimization::_recompile_count = 0;
+volatile jint Deoptimization::_backoff_count = 0;
+
 enum {
   LSB_BITS = 8,
   LSB_MASK = right_n_bits(LSB_BITS)
@@ -1970,6 +2035,10 @@ void Deoptimization::gather_statistics(DeoptReason reason, DeoptAction action,
   assert(action >= 0 && action < Action_LIMIT, "oob");
   _deoptimization_hist[Reason_none][0][0] += 1;  // total
   _deoptimization_hist[reason][0][0]      += 1;  // per-reason total
+  if (_perf_deoptimization_count[Reason_none] != NULL) {
+    inc_perf_counter(_perf_deoptimization_count[Reason_none]);
+    inc_perf_counter(_perf_deoptimization_count[reason]);
+  }
   juint* cases = _deoptimization_hist[reason][1+action];
   juint* bc_counter_addr = NULL;
   juint  bc_counter      = 0;
@@ -2043,6 +2112,89 @@ void Deoptimization::print_statistics() {
     if (xtty != NULL)  xtty->tail("statistics");
   }
 }
+
+void Deoptimization::init_counters(TRAPS) {
+  if (UsePerfData) {
+    ResourceMark rm;
+    for (int reason = 0; reason < Reason_LIMIT; reason++) {
+      const char* name = (reason == Reason_none) ? "total" : trap_reason_name(reason);
+      _perf_deoptimization_count[reason] =
+        PerfDataManager::create_counter(SUN_CI, PerfDataManager::counter_name("deopt", name),
+                                        PerfData::U_Events, CHECK);
+    }
+    _perf_recompile_count =
+      PerfDataManager::create_counter(SUN_CI, "deopt.recompiles",
+                                      PerfData::U_Events, CHECK);
+    _perf_backoff_count =
+      PerfDataManager::create_counter(SUN_CI, "deopt.backoffs",
+                                      PerfData::U_Events, CHECK);
+  }
+}
+
+static GrowableArray<Method*>* _deoptimized_methods = NULL;
+
+void Deoptimization::collect_deoptimized_method(Method* m) {
+  MethodData* mdo = m->method_data();
+  if (mdo != NULL && (mdo->decompile_count() != 0 || mdo->overflow_recompile_count() != 0)) {
+    _deoptimized_methods->append(m);
+  }
+}
+
+static int compare_decompile_count(Method** a, Method** b) {
+  uint ca = (*a)->method_data()->decompile_count();
+  uint cb = (*b)->method_data()->decompile_count();
+  if (ca != cb) {
+    return (ca > cb) ? -1 : 1;
+  }
+  uint ra = (*a)->method_data()->overflow_recompile_count();
+  uint rb = (*b)->method_data()->overflow_recompile_count();
+  return (ra > rb) ? -1 : ((ra < rb) ? 1 : 0);
+}
+
+void Deoptimization::print_method_statistics(outputStream* st, int limit) {
+  assert(SafepointSynchronize::is_at_safepoint(), "methods must not go away");
+  ResourceMark rm;
+
+  st->print_cr("Deoptimization traps: %d", total_deoptimization_count());
+  for (int reason = 1; reason < Reason_LIMIT; reason++) {
+    jint count = deoptimization_count((DeoptReason)reason);
+    if (count != 0) {
+      st->print_cr("  %-24s %d", trap_reason_name(reason), count);
+    }
+  }
+  st->print_cr("Recompilations caused by traps: %d", _recompile_count);
+  st->print_cr("Methods backed off from recompilation: %d", _backoff_count);
+
+  _deoptimized_methods = new GrowableArray<Method*>(100);
+  SystemDictionary::methods_do(collect_deoptimized_method);
+  _deoptimized_methods->sort(compare_decompile_count);
+
+  int count = MIN2(limit, _deoptimized_methods->length());
+  st->cr();
+  st->print_cr("Most recompiled methods (%d of %d): decompiles, overflow recompiles, traps per reason",
+               count, _deoptimized_methods->length());
+  for (int i = 0; i < count; i++) {
+    Method* m = _deoptimized_methods->at(i);
+    MethodData* mdo = m->method_data();
+    st->print("  %5u %5u ", mdo->decompile_count(), mdo->overflow_recompile_count());
+    st->print("%s", m->name_and_sig_as_C_string());
+    if (m->is_not_c2_compilable()) {
+      st->print(" (not compilable at level %d)", CompLevel_full_optimization);
+    }
+    int reason_limit = MIN2((int)Reason_LIMIT, (int)MethodData::trap_reason_limit());
+    for (int reason = 1; reason < reason_limit; reason++) {
+      uint traps = mdo->trap_count(reason);
+      if (traps != 0) {
+        st->print(" %s=%u", trap_reason_name(reason), traps);
+      }
+    }
+    st->cr();
+  }
+  _deoptimized_methods = NULL;
+
+  st->cr();
+  Events::print_deopt_messages(st);
+}
 #else // COMPILER2 || SHARK
 
 
@@ -2059,6 +2211,14 @@ void Deoptimization::print_statistics() {
   // no output
 }
 
+void Deoptimization::init_counters(TRAPS) {
+  // no counters
+}
+
+void Deoptimization::print_method_statistics(outputStream* st, int limit) {
+  st->print_cr("No deoptimization statistics without C2");
+}
+
 void
 Deoptimization::update_method_data_from_interpreter(MethodData* trap_mdo, int trap_bci, int reason) {
   // no udpate
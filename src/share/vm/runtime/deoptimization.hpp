@@ -27,6 +27,7 @@
 
 #include "memory/allocation.hpp"
 #include "runtime/frame.inline.hpp"
+#include "runtime/perfData.hpp"
 
 class ProfileData;
 class vframeArray;
@@ -117,7 +118,8 @@ class Deoptimization : AllStatic {
 
 #ifdef COMPILER2
   // Support for restoring non-escaping objects
-  static bool realloc_objects(JavaThread* thread, frame* fr, GrowableArray<ScopeValue*>* objects, TRAPS);
+  static bool realloc_objects(JavaThread* thread, frame* fr, RegisterMap* reg_map, GrowableArray<ScopeValue*>* objects, TRAPS);
+  static int array_length(frame* fr, RegisterMap* reg_map, ObjectValue* sv, int bound);
   static void reassign_type_array_elements(frame* fr, RegisterMap* reg_map, ObjectValue* sv, typeArrayOop obj, BasicType type);
   static void reassign_object_array_elements(frame* fr, RegisterMap* reg_map, ObjectValue* sv, objArrayOop obj);
   static void reassign_fields(frame* fr, RegisterMap* reg_map, GrowableArray<ScopeValue*>* objects, bool realloc_failures);
@@ -247,6 +249,11 @@ class Deoptimization : AllStatic {
   static void gather_statistics(DeoptReason reason, DeoptAction action,
                                 Bytecodes::Code bc = Bytecodes::_illegal);
   static void print_statistics();
+  // Create the jvmstat counters for traps, recompiles and back-offs
+  static void init_counters(TRAPS);
+  // Print the per-reason counters, the methods that are deoptimized
+  // most often and the recent deoptimization events (at a safepoint)
+  static void print_method_statistics(outputStream* st, int limit);
 
   // How much room to adjust the last frame's SP by, to make space for
   // the callee's interpreter frame (which expects locals to be next to
@@ -374,6 +381,14 @@ class Deoptimization : AllStatic {
   static juint _deoptimization_hist[Reason_LIMIT][1+Action_LIMIT][BC_CASE_LIMIT];
   // Note:  Histogram array size is 1-2 Kb.
 
+  static PerfCounter* _perf_deoptimization_count[Reason_LIMIT];  // [Reason_none] is the total
+  static PerfCounter* _perf_recompile_count;
+  static PerfCounter* _perf_backoff_count;
+  static volatile jint _recompile_count;
+  static volatile jint _backoff_count;
+
+  static void collect_deoptimized_method(Method* m);
+
  public:
   static void update_method_data_from_interpreter(MethodData* trap_mdo, int trap_bci, int reason);
 };
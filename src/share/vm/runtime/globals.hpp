@@ -673,6 +673,19 @@ class CommandLineFlags {
   product(bool, UseInlineCaches, true,                                      \
           "Use Inline Caches for virtual calls ")                           \
                                                                             \
+  product(bool, UseItableStubCache, true,                                   \
+          "Remember the recent receiver classes and selected methods of "   \
+          "megamorphic interface call sites (needs compressed class "       \
+          "pointers)")                                                      \
+                                                                            \
+  product(intx, ItableStubCacheSize, 4,                                     \
+          "Number of receiver classes remembered per megamorphic "          \
+          "interface call site (1, 2, 4 or 8)")                             \
+                                                                            \
+  product(intx, ItableStubCacheMissLimit, 1000,                             \
+          "Stop filling the receiver cache of an interface call site "      \
+          "after this many misses")                                         \
+                                                                            \
   develop(bool, InlineArrayCopy, true,                                      \
           "Inline arraycopy native that is known to be part of "            \
           "base library DLL")                                               \
@@ -708,6 +721,12 @@ class CommandLineFlags {
   product(bool, UseAESIntrinsics, false,                                    \
           "Use intrinsics for AES versions of crypto")                      \
                                                                             \
+  product(bool, UseAESCTRIntrinsics, false,                                 \
+          "Use intrinsics for the AES counter mode (CTR) of crypto")        \
+                                                                            \
+  product(bool, UseGHASHIntrinsics, false,                                  \
+          "Use intrinsics for GHASH of the AES Galois/Counter mode (GCM)")  \
+                                                                            \
   product(bool, UseSHA1Intrinsics, false,                                   \
           "Use intrinsics for SHA-1 crypto hash function")                  \
                                                                             \
@@ -720,6 +739,15 @@ class CommandLineFlags {
   product(bool, UseCRC32Intrinsics, false,                                  \
           "use intrinsics for java.util.zip.CRC32")                         \
                                                                             \
+  product(bool, UseCRC32CIntrinsics, false,                                 \
+          "use intrinsics for java.util.zip.CRC32C")                        \
+                                                                            \
+  product(bool, UseAdler32Intrinsics, false,                                \
+          "use intrinsics for java.util.zip.Adler32")                       \
+                                                                            \
+  product(bool, UseLibmIntrinsic, false,                                    \
+          "use SSE2 stubs for java.lang.Math exp, log, pow, sin, cos, tan") \
+                                                                            \
   develop(bool, TraceCallFixup, false,                                      \
           "Trace all call fixups")                                          \
                                                                             \
@@ -1220,6 +1248,11 @@ class CommandLineFlags {
   product(bool, UseFastJNIAccessors, true,                                  \
           "Use optimized versions of Get<Primitive>Field")                  \
                                                                             \
+  product(uintx, JNIGlobalHandleStripes, 0,                                 \
+          "Number of independently locked stripes used to allocate JNI "    \
+          "global and weak global handles (0 means one per processor, "     \
+          "up to 64)")                                                      \
+                                                                            \
   product(intx, MaxJNILocalCapacity, 65536,                                 \
           "Maximum allowable local JNI handle capacity to "                 \
           "EnsureLocalCapacity() and PushLocalFrame(), "                    \
@@ -1937,6 +1970,11 @@ class CommandLineFlags {
   product(bool, ParallelRefProcBalancingEnabled, true,                      \
           "Enable balancing of reference processing queues")                \
                                                                             \
+  product(uintx, ReferencesPerThread, 1000,                                 \
+          "With ParallelRefProcEnabled, use one worker thread per this "    \
+          "many discovered references, and process up to this many "        \
+          "references serially. 0 uses all worker threads")                 \
+                                                                            \
   product(uintx, CMSTriggerRatio, 80,                                       \
           "Percentage of MinHeapFreeRatio in CMS generation that is "       \
           "allocated before a CMS collection cycle commences")              \
@@ -2591,6 +2629,18 @@ class CommandLineFlags {
           "Print safepoint statistics only when safepoint takes "           \
           "more than PrintSafepointSatisticsTimeout in millis")             \
                                                                             \
+  product(bool, PrintSafepointLatecomers, false,                            \
+          "Print the threads that were slowest to reach a safepoint, "      \
+          "with their state and the code they were executing. Same as "     \
+          "-XX:LogTags=safepoint=info")                                     \
+                                                                            \
+  product(intx, SafepointLatecomerThreshold, 10,                            \
+          "Report safepoint latecomers only when synchronization takes "    \
+          "more than this many milliseconds")                               \
+                                                                            \
+  product(intx, SafepointLatecomerCount, 4,                                 \
+          "Maximum number of latecomer threads reported per safepoint")     \
+                                                                            \
   product(bool, TraceSafepointCleanupTime, false,                           \
           "Print the break down of clean up tasks performed during "        \
           "safepoint")                                                      \
@@ -2680,6 +2730,27 @@ class CommandLineFlags {
   product(bool, DisplayVMOutputToStdout, false,                             \
           "If DisplayVMOutput is true, display all VM output to stdout")    \
                                                                             \
+  product(ccstr, LogTags, NULL,                                             \
+          "Comma separated list of <tag>=<level> pairs selecting the "      \
+          "tagged log output, e.g. ref=info,safepoint=debug; the tag all "  \
+          "selects every tag")                                              \
+                                                                            \
+  product(ccstr, LogTagsOutput, NULL,                                       \
+          "Destination of the tagged log output: stdout, stderr or a "      \
+          "file name [default: stdout]")                                    \
+                                                                            \
+  product(bool, AsyncLogging, false,                                        \
+          "Write the GC log and the tagged log output from a background "   \
+          "thread instead of the logging thread")                           \
+                                                                            \
+  product(uintx, AsyncLogBufferSize, 32*K,                                  \
+          "Size in bytes of the per-thread buffer used by AsyncLogging; "   \
+          "output that does not fit is dropped. Must be a power of 2")      \
+                                                                            \
+  product(intx, AsyncLogFlushInterval, 50,                                  \
+          "Interval in milliseconds at which the AsyncLogging thread "      \
+          "writes out buffered output")                                     \
+                                                                            \
   product(bool, UseHeavyMonitors, false,                                    \
           "use heavyweight instead of lightweight Java monitors")           \
                                                                             \
@@ -2817,6 +2888,10 @@ class CommandLineFlags {
   product_pd(bool, RewriteFrequentPairs,                                    \
           "Rewrite frequently used bytecode pairs into a single bytecode")  \
                                                                             \
+  product(bool, RewriteSuperinstructions, true,                             \
+          "Rewrite frequent pairs of simple bytecodes into superinstructions "\
+          "at link time (requires RewriteFrequentPairs)")                   \
+                                                                            \
   diagnostic(bool, PrintInterpreter, false,                                 \
           "Print the generated interpreter code")                           \
                                                                             \
@@ -3149,6 +3224,14 @@ class CommandLineFlags {
   product(intx, PerBytecodeRecompilationCutoff, 200,                        \
           "Per-BCI limit on repeated recompilation (-1=>'Inf')")            \
                                                                             \
+  product(bool, UseDeoptimizationBackoff, false,                            \
+          "Stop compiling methods at the highest tier when they are "       \
+          "repeatedly deoptimized and recompiled for the same reason")      \
+                                                                            \
+  product(intx, DeoptimizationBackoffLimit, 8,                              \
+          "Number of traps of one kind and of recompilations of a method "  \
+          "after which UseDeoptimizationBackoff gives up on it")            \
+                                                                            \
   product(intx, PerMethodTrapLimit,  100,                                   \
           "Limit on traps (of one kind) in a method (includes inlines)")    \
                                                                             \
@@ -3395,6 +3478,10 @@ class CommandLineFlags {
   develop_pd(uintx, CodeCacheMinBlockLength,                                \
           "Minimum number of segments in a code cache block")               \
                                                                             \
+  product(bool, CodeCacheSegregateHotCode, true,                            \
+          "Place fully optimized nmethods in unused code cache space "      \
+          "before reusing the space of flushed code")                       \
+                                                                            \
   notproduct(bool, ExitOnFullCodeCache, false,                              \
           "Exit the VM if we fill the code cache")                          \
                                                                             \
@@ -3470,6 +3557,23 @@ class CommandLineFlags {
   product(bool, CICompilerCountPerCPU, false,                               \
           "1 compiler thread for log(N CPUs)")                              \
                                                                             \
+  product(uintx, CompilerMemoryLimit, 1*G,                                  \
+          "Bail out of a compilation once its arenas have grown by more "   \
+          "than this many bytes (0 means no limit)")                        \
+                                                                            \
+  product(uintx, CompilerThreadChunkCacheSize, 8,                           \
+          "Number of arena chunks of each pooled size a compiler thread "   \
+          "keeps for its next compilations")                                \
+                                                                            \
+  product(uintx, CompilerCPUBudgetPercentage, 0,                            \
+          "Percentage of the available CPUs the compiler threads may use; " \
+          "over it fewer threads compile and only hotter methods are "      \
+          "queued (0 means no budget)")                                     \
+                                                                            \
+  product(uintx, CompilerCPUBudgetWindow, 1000,                             \
+          "Period in milliseconds over which the CPU use of the compiler "  \
+          "threads is measured")                                            \
+                                                                            \
   develop(intx, CIFireOOMAt,    -1,                                         \
           "Fire OutOfMemoryErrors throughout CI for testing the compiler "  \
           "(non-negative value throws OOM after this many CI accesses "     \
@@ -3679,6 +3783,10 @@ class CommandLineFlags {
           "Start profiling in interpreter if the counters exceed tier 3 "   \
           "thresholds by the specified percentage")                         \
                                                                             \
+  product(intx, TierLambdaFormThresholdPercentage, 50,                      \
+          "Percentage of the tier 3 and tier 4 thresholds at which "        \
+          "compiled LambdaForms are compiled")                              \
+                                                                            \
   product(uintx, IncreaseFirstTierCompileThresholdAt, 50,                   \
           "Increase the compile threshold for C1 compilation if the code "  \
           "cache is filled by the specified percentage")                    \
@@ -3881,6 +3989,10 @@ class CommandLineFlags {
   diagnostic(bool, ShowHiddenFrames, false,                                 \
           "show method handle implementation frames (usually hidden)")      \
                                                                             \
+  product(bool, ShareLambdaFormCode, true,                                  \
+          "Run the compiled code of an identical compiled LambdaForm "      \
+          "instead of compiling another copy of it")                        \
+                                                                            \
   experimental(bool, TrustFinalNonStaticFields, false,                      \
           "trust final non-static declarations for constant folding")       \
                                                                             \
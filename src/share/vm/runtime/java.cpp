@@ -43,6 +43,7 @@
 #include "oops/symbol.hpp"
 #include "prims/jvmtiExport.hpp"
 #include "runtime/arguments.hpp"
+#include "runtime/asyncLogWriter.hpp"
 #include "runtime/biasedLocking.hpp"
 #include "runtime/compilationPolicy.hpp"
 #include "runtime/deoptimization.hpp"
@@ -540,6 +541,9 @@ void before_exit(JavaThread * thread) {
   print_statistics();
   Universe::heap()->print_tracing_info();
 
+  // Write out buffered log output, log synchronously from now on
+  AsyncLogWriter::stop();
+
   { MutexLocker ml(BeforeExit_lock);
     _before_exit_status = BEFORE_EXIT_DONE;
     BeforeExit_lock->notify_all();
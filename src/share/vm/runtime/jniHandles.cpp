@@ -27,8 +27,10 @@
 #include "memory/iterator.hpp"
 #include "oops/oop.inline.hpp"
 #include "prims/jvmtiExport.hpp"
+#include "runtime/atomic.inline.hpp"
 #include "runtime/jniHandles.hpp"
 #include "runtime/mutexLocker.hpp"
+#include "runtime/os.hpp"
 #include "runtime/thread.inline.hpp"
 #if INCLUDE_ALL_GCS
 #include "gc_implementation/g1/g1SATBCardTableModRefBS.hpp"
@@ -36,9 +38,20 @@
 
 PRAGMA_FORMAT_MUTE_WARNINGS_FOR_GCC
 
-JNIHandleBlock* JNIHandles::_global_handles       = NULL;
-JNIHandleBlock* JNIHandles::_weak_global_handles  = NULL;
-oop             JNIHandles::_deleted_handle       = NULL;
+JNIHandleBlock** JNIHandles::_global_handles          = NULL;
+JNIHandleBlock** JNIHandles::_weak_global_handles     = NULL;
+Mutex**          JNIHandles::_handle_locks            = NULL;
+uint             JNIHandles::_handle_stripes          = 0;
+volatile jint    JNIHandles::_parallel_claimed_stripe = 0;
+oop              JNIHandles::_deleted_handle          = NULL;
+
+
+// Any thread may allocate in any stripe; the stripe only needs to be stable
+// enough that threads allocating at the same time usually pick different ones.
+inline uint JNIHandles::stripe_for(Thread* thread) {
+  uintptr_t hash = ((uintptr_t)thread >> LogHeapWordSize) * 2654435761U;
+  return (uint)((hash >> 16) % _handle_stripes);
+}
 
 
 jobject JNIHandles::make_local(oop obj) {
@@ -80,9 +93,11 @@ jobject JNIHandles::make_global(Handle obj) {
   jobject res = NULL;
   if (!obj.is_null()) {
     // ignore null handles
-    MutexLocker ml(JNIGlobalHandle_lock);
+    Thread* thread = Thread::current();
+    uint stripe = stripe_for(thread);
+    MutexLocker ml(_handle_locks[stripe], thread);
     assert(Universe::heap()->is_in_reserved(obj()), "sanity check");
-    res = _global_handles->allocate_handle(obj());
+    res = _global_handles[stripe]->allocate_handle(obj());
   } else {
     CHECK_UNHANDLED_OOPS_ONLY(Thread::current()->clear_unhandled_oops());
   }
@@ -96,9 +111,11 @@ jobject JNIHandles::make_weak_global(Handle obj) {
   if (!obj.is_null()) {
     // ignore null handles
     {
-      MutexLocker ml(JNIGlobalHandle_lock);
+      Thread* thread = Thread::current();
+      uint stripe = stripe_for(thread);
+      MutexLocker ml(_handle_locks[stripe], thread);
       assert(Universe::heap()->is_in_reserved(obj()), "sanity check");
-      res = _weak_global_handles->allocate_handle(obj());
+      res = _weak_global_handles[stripe]->allocate_handle(obj());
     }
     // Add weak tag.
     assert(is_ptr_aligned(res, weak_tag_alignment), "invariant");
@@ -126,6 +143,9 @@ oop JNIHandles::resolve_jweak(jweak handle) {
 template oop JNIHandles::resolve_jweak<true>(jweak);
 template oop JNIHandles::resolve_jweak<false>(jweak);
 
+// Deleting a global handle takes no lock: the slot is marked with the
+// deleted_handle sentinel and picked up again when the owning stripe
+// rebuilds its free list under its own lock.
 void JNIHandles::destroy_global(jobject handle) {
   if (handle != NULL) {
     assert(is_global_handle(handle), "Invalid delete of global JNI handle");
@@ -142,12 +162,41 @@ void JNIHandles::destroy_weak_global(jobject handle) {
 
 void JNIHandles::oops_do(OopClosure* f) {
   f->do_oop(&_deleted_handle);
-  _global_handles->oops_do(f);
+  for (uint i = 0; i < _handle_stripes; i++) {
+    _global_handles[i]->oops_do(f);
+  }
+}
+
+
+uint JNIHandles::possibly_parallel_oops_do(OopClosure* f) {
+  assert(SafepointSynchronize::is_at_safepoint(), "must be at safepoint");
+  uint claimed = 0;
+  for (;;) {
+    // Grab the next stripe to scan
+    uint stripe = (uint)(Atomic::add(1, &_parallel_claimed_stripe) - 1);
+    if (stripe >= _handle_stripes) {
+      break;
+    }
+    if (stripe == 0) {
+      f->do_oop(&_deleted_handle);
+    }
+    _global_handles[stripe]->oops_do(f);
+    claimed++;
+  }
+  return claimed;
 }
 
 
 void JNIHandles::weak_oops_do(BoolObjectClosure* is_alive, OopClosure* f) {
-  _weak_global_handles->weak_oops_do(is_alive, f);
+  for (uint i = 0; i < _handle_stripes; i++) {
+    _weak_global_handles[i]->weak_oops_do(is_alive, f);
+  }
+
+  /*
+   * JVMTI data structures may also contain weak oops.  The iteration of them
+   * is placed here so that we don't need to add it to each of the collectors.
+   */
+  JvmtiExport::weak_oops_do(is_alive, f);
 }
 
 
@@ -158,8 +207,19 @@ void JNIHandles::weak_oops_do(OopClosure* f) {
 
 
 void JNIHandles::initialize() {
-  _global_handles      = JNIHandleBlock::allocate_block();
-  _weak_global_handles = JNIHandleBlock::allocate_block();
+  _handle_stripes = (uint)JNIGlobalHandleStripes;
+  if (_handle_stripes == 0) {
+    _handle_stripes = MIN2((uint)os::active_processor_count(), 64u);
+  }
+  _global_handles      = NEW_C_HEAP_ARRAY(JNIHandleBlock*, _handle_stripes, mtInternal);
+  _weak_global_handles = NEW_C_HEAP_ARRAY(JNIHandleBlock*, _handle_stripes, mtInternal);
+  _handle_locks        = NEW_C_HEAP_ARRAY(Mutex*, _handle_stripes, mtInternal);
+  for (uint i = 0; i < _handle_stripes; i++) {
+    _global_handles[i]      = JNIHandleBlock::allocate_block();
+    _weak_global_handles[i] = JNIHandleBlock::allocate_block();
+    // locks JNIHandleBlockFreeList_lock
+    _handle_locks[i]        = new Mutex(Mutex::nonleaf, "JNIGlobalHandle_lock", true);
+  }
   EXCEPTION_MARK;
   // We will never reach the CATCH below since Exceptions::_throw will cause
   // the VM to exit if an exception is thrown during initialization
@@ -197,20 +257,38 @@ bool JNIHandles::is_frame_handle(JavaThread* thr, jobject obj) {
 
 
 bool JNIHandles::is_global_handle(jobject handle) {
-  return _global_handles->chain_contains(handle);
+  for (uint i = 0; i < _handle_stripes; i++) {
+    if (_global_handles[i]->chain_contains(handle)) {
+      return true;
+    }
+  }
+  return false;
 }
 
 
 bool JNIHandles::is_weak_global_handle(jobject handle) {
-  return _weak_global_handles->chain_contains(handle);
+  for (uint i = 0; i < _handle_stripes; i++) {
+    if (_weak_global_handles[i]->chain_contains(handle)) {
+      return true;
+    }
+  }
+  return false;
 }
 
 long JNIHandles::global_handle_memory_usage() {
-  return _global_handles->memory_usage();
+  long usage = 0;
+  for (uint i = 0; i < _handle_stripes; i++) {
+    usage += _global_handles[i]->memory_usage();
+  }
+  return usage;
 }
 
 long JNIHandles::weak_global_handle_memory_usage() {
-  return _weak_global_handles->memory_usage();
+  long usage = 0;
+  for (uint i = 0; i < _handle_stripes; i++) {
+    usage += _weak_global_handles[i]->memory_usage();
+  }
+  return usage;
 }
 
 
@@ -428,12 +506,6 @@ void JNIHandleBlock::weak_oops_do(BoolObjectClosure* is_alive,
       break;
     }
   }
-
-  /*
-   * JVMTI data structures may also contain weak oops.  The iteration of them
-   * is placed here so that we don't need to add it to each of the collectors.
-   */
-  JvmtiExport::weak_oops_do(is_alive, f);
 }
 
 
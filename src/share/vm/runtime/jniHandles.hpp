@@ -29,6 +29,7 @@
 #include "utilities/top.hpp"
 
 class JNIHandleBlock;
+class Mutex;
 
 
 // Interface for creating and resolving local/global JNI handles
@@ -36,10 +37,18 @@ class JNIHandleBlock;
 class JNIHandles : AllStatic {
   friend class VMStructs;
  private:
-  static JNIHandleBlock* _global_handles;             // First global handle block
-  static JNIHandleBlock* _weak_global_handles;        // First weak global handle block
+  // Global and weak global handles are spread over a number of stripes, each
+  // an independent handle block chain guarded by its own lock, so that threads
+  // creating global handles concurrently rarely contend with each other.
+  static JNIHandleBlock** _global_handles;            // First global handle block, per stripe
+  static JNIHandleBlock** _weak_global_handles;       // First weak global handle block, per stripe
+  static Mutex**          _handle_locks;              // Allocation lock, per stripe
+  static uint             _handle_stripes;            // Number of stripes
+  static volatile jint    _parallel_claimed_stripe;   // Next stripe to claim during parallel GC
   static oop _deleted_handle;                         // Sentinel marking deleted handles
 
+  inline static uint stripe_for(Thread* thread);
+
   inline static bool is_jweak(jobject handle);
   inline static oop& jobject_ref(jobject handle); // NOT jweak!
   inline static oop& jweak_ref(jobject handle);
@@ -90,6 +99,7 @@ class JNIHandles : AllStatic {
 
   // Initialization
   static void initialize();
+  static uint handle_stripes()  { return _handle_stripes; }
 
   // Debugging
   static void print_on(outputStream* st);
@@ -105,6 +115,11 @@ class JNIHandles : AllStatic {
   // Garbage collection support(global handles only, local handles are traversed from thread)
   // Traversal of regular global handles
   static void oops_do(OopClosure* f);
+  // Traversal of regular global handles by several GC workers; each stripe
+  // is claimed and scanned by one of the callers. Returns the number of
+  // stripes claimed by this caller.
+  static uint possibly_parallel_oops_do(OopClosure* f);
+  static void clear_parallel_claimed_index() { _parallel_claimed_stripe = 0; }
   // Traversal of weak global handles. Unreachable oops are cleared.
   static void weak_oops_do(BoolObjectClosure* is_alive, OopClosure* f);
   // Traversal of weak global handles.
@@ -44,14 +44,18 @@
 #include "runtime/orderAccess.inline.hpp"
 #include "runtime/osThread.hpp"
 #include "runtime/safepoint.hpp"
+#include "runtime/sharedRuntime.hpp"
 #include "runtime/signature.hpp"
 #include "runtime/stubCodeGenerator.hpp"
 #include "runtime/stubRoutines.hpp"
 #include "runtime/sweeper.hpp"
 #include "runtime/synchronizer.hpp"
 #include "runtime/thread.inline.hpp"
+#include "runtime/vframe.hpp"
 #include "services/runtimeService.hpp"
+#include "trace/tracing.hpp"
 #include "utilities/events.hpp"
+#include "utilities/log.hpp"
 #include "utilities/macros.hpp"
 #ifdef TARGET_ARCH_x86
 # include "nativeInst_x86.hpp"
@@ -106,6 +110,16 @@ void SafepointSynchronize::begin() {
     _ts_of_current_safepoint = tty->time_stamp().seconds();
   }
 
+  // Latecomer tracking needs the arrival time of every thread, so it is
+  // decided once per safepoint before any thread can start to block.
+  _track_latecomers = Log::is_enabled(LogTag::safepoint, LogLevel::info);
+#if INCLUDE_TRACE
+  _track_latecomers = _track_latecomers || EventSafepointLatecomer::is_enabled();
+#endif
+  if (_track_latecomers) {
+    _sync_begin_time = os::javaTimeNanos();
+  }
+
 #if INCLUDE_ALL_GCS
   if (UseConcMarkSweepGC) {
     // In the future we should investigate whether CMS can use the
@@ -394,6 +408,10 @@ void SafepointSynchronize::begin() {
     update_statistics_on_sync_end(os::javaTimeNanos());
   }
 
+  if (_track_latecomers) {
+    report_latecomers(os::javaTimeNanos());
+  }
+
   // Call stuff that needs to be run when a safepoint is just about to be completed
   do_cleanup_tasks();
 
@@ -649,6 +667,13 @@ void SafepointSynchronize::block(JavaThread *thread) {
         _waiting_to_block--;
         thread->safepoint_state()->set_has_called_back(true);
 
+        // A thread coming from a compiled safepoint poll was already seen
+        // in _thread_in_vm by the VM thread, and that is when it arrived.
+        // A thread that was running in the VM arrives only now.
+        if (state == _thread_in_vm_trans) {
+          thread->safepoint_state()->record_arrival();
+        }
+
         DEBUG_ONLY(thread->set_visited_for_critical_count(true));
         if (thread->in_critical()) {
           // Notice that this thread is in a critical section
@@ -812,6 +837,8 @@ ThreadSafepointState::ThreadSafepointState(JavaThread *thread) {
   _type   = _running;
   _has_called_back = false;
   _at_poll_safepoint = false;
+  _first_seen_state = _thread_uninitialized;
+  _arrival_time = 0;
 }
 
 void ThreadSafepointState::create(JavaThread *thread) {
@@ -833,6 +860,9 @@ void ThreadSafepointState::examine_state_of_thread() {
 
   // Save the state at the start of safepoint processing.
   _orig_thread_state = state;
+  if (_first_seen_state == _thread_uninitialized) {
+    _first_seen_state = state;
+  }
 
   // Check for a thread that is suspended. Note that thread resume tries
   // to grab the Threads_lock which we own here, so a thread cannot be
@@ -886,6 +916,7 @@ void ThreadSafepointState::examine_state_of_thread() {
 // Returns true is thread could not be rolled forward at present position.
 void ThreadSafepointState::roll_forward(suspend_type type) {
   _type = type;
+  record_arrival();
 
   switch(_type) {
     case _at_safepoint:
@@ -922,6 +953,8 @@ void ThreadSafepointState::restart() {
   }
   _type = _running;
   set_has_called_back(false);
+  _first_seen_state = _thread_uninitialized;
+  _arrival_time = 0;
 }
 
 
@@ -1053,6 +1086,8 @@ julong SafepointSynchronize::_coalesced_vmop_count = 0;
 jlong  SafepointSynchronize::_max_sync_time = 0;
 jlong  SafepointSynchronize::_max_vmop_time = 0;
 float  SafepointSynchronize::_ts_of_current_safepoint = 0.0f;
+bool   SafepointSynchronize::_track_latecomers = false;
+jlong  SafepointSynchronize::_sync_begin_time = 0;
 
 static jlong  cleanup_end_time = 0;
 static bool   need_to_track_page_armed_status = false;
@@ -1239,6 +1274,114 @@ void SafepointSynchronize::print_statistics() {
   }
 }
 
+// Report the threads that took the longest to reach the safepoint, together
+// with the code they were executing when they got there. This is called with
+// all threads stopped, so their stacks can be walked, and before the VM
+// operation runs, so the reported methods cannot have been unloaded yet.
+void SafepointSynchronize::report_latecomers(jlong sync_end_time) {
+  jlong sync_time = sync_end_time - _sync_begin_time;
+  if (sync_time <= SafepointLatecomerThreshold * NANOSECS_PER_MILLISEC) {
+    return;
+  }
+
+  ResourceMark rm;
+
+  // Keep the slowest threads sorted by decreasing time to safepoint. The
+  // list is short, so an insertion sort is good enough.
+  const int max_count = (int)SafepointLatecomerCount;
+  JavaThread** late = NEW_RESOURCE_ARRAY(JavaThread*, max_count);
+  int count = 0;
+  for (JavaThread* cur = Threads::first(); cur != NULL; cur = cur->next()) {
+    jlong arrival = cur->safepoint_state()->arrival_time();
+    if (arrival == 0) {
+      continue;
+    }
+    int pos = count;
+    while (pos > 0 && late[pos - 1]->safepoint_state()->arrival_time() < arrival) {
+      if (pos < max_count) {
+        late[pos] = late[pos - 1];
+      }
+      pos--;
+    }
+    if (pos < max_count) {
+      late[pos] = cur;
+      if (count < max_count) {
+        count++;
+      }
+    }
+  }
+
+  VM_Operation* op = VMThread::vm_operation();
+  LogStream log(LogTag::safepoint, LogLevel::info);
+  if (log.is_enabled()) {
+    log.print_cr("Safepoint latecomers: safepoint=%d vmop=%s sync_ms=%.3f threads=%d reported=%d",
+                 _safepoint_counter,
+                 op != NULL ? op->name() : "no vm operation",
+                 (double)sync_time / NANOSECS_PER_MILLISEC,
+                 Threads::number_of_threads(), count);
+  }
+
+  for (int i = 0; i < count; i++) {
+    JavaThread* thread = late[i];
+    ThreadSafepointState* state = thread->safepoint_state();
+    jlong time_to_safepoint = state->arrival_time() - _sync_begin_time;
+
+    // Find the code the thread was executing when it reached the safepoint.
+    // For compiled code this is the innermost inlined scope at the poll.
+    Method* method = NULL;
+    int bci = -1;
+    int compile_id = -1;
+    int comp_level = CompLevel_none;
+    const char* frame_type = "none";
+    vframeStream vfst(thread);
+    if (!vfst.at_end()) {
+      method = vfst.method();
+      bci = vfst.bci();
+      if (method->is_native()) {
+        frame_type = "native";
+      } else if (vfst.is_interpreted_frame()) {
+        frame_type = "interpreted";
+      } else {
+        frame_type = "compiled";
+      }
+      if (!vfst.is_interpreted_frame() && vfst.cb() != NULL && vfst.cb()->is_nmethod()) {
+        compile_id = vfst.nm()->compile_id();
+        comp_level = vfst.nm()->comp_level();
+      }
+    }
+
+    if (log.is_enabled()) {
+      log.print("  rank=%d time_to_safepoint_ms=%.3f tid=" UINTX_FORMAT " name=\"%s\" state=%s frame=%s",
+               i + 1, (double)time_to_safepoint / NANOSECS_PER_MILLISEC,
+               (uintx)thread->osthread()->thread_id(), thread->get_thread_name(),
+               _get_thread_state_name(state->first_seen_state()), frame_type);
+      if (method != NULL) {
+        log.print(" method=%s bci=%d", method->name_and_sig_as_C_string(), bci);
+      }
+      if (compile_id != -1) {
+        log.print(" compile_id=%d level=%d", compile_id, comp_level);
+      }
+      log.cr();
+    }
+
+    EventSafepointLatecomer event;
+    if (event.should_commit()) {
+      event.set_safepointId(_safepoint_counter);
+      event.set_rank(i + 1);
+      event.set_latecomer(SharedRuntime::get_java_tid(thread));
+      event.set_latecomerOSThread(thread->osthread()->thread_id());
+      event.set_timeToSafepoint(time_to_safepoint);
+      event.set_syncTime(sync_time);
+      event.set_threadState(_get_thread_state_name(state->first_seen_state()));
+      event.set_method(method);
+      event.set_bci(bci);
+      event.set_frameType(frame_type);
+      event.set_compileId(compile_id);
+      event.commit();
+    }
+  }
+}
+
 // This method will be called when VM exits. It will first call
 // print_statistics to print out the rest of the sampling.  Then
 // it tries to summarize the sampling.
@@ -116,12 +116,17 @@ private:
   static jlong            _max_vmop_time;            // maximum vm operation time in nanos
   static float            _ts_of_current_safepoint;  // time stamp of current safepoint in seconds
 
+  // latecomer tracking, see PrintSafepointLatecomers
+  static bool             _track_latecomers;         // record when each thread reaches the current safepoint
+  static jlong            _sync_begin_time;          // time in nanos when synchronization was initiated
+
   static void begin_statistics(int nof_threads, int nof_running);
   static void update_statistics_on_spin_end();
   static void update_statistics_on_sync_end(jlong end_time);
   static void update_statistics_on_cleanup_end(jlong end_time);
   static void end_statistics(jlong end_time);
   static void print_statistics();
+  static void report_latecomers(jlong sync_end_time);
   inline static void inc_page_trap_count() {
     Atomic::inc(&_safepoint_stats[_cur_stat_index]._nof_threads_hit_page_trap);
   }
@@ -176,6 +181,8 @@ public:
   static void print_state()                                PRODUCT_RETURN;
   static void safepoint_msg(const char* format, ...) ATTRIBUTE_PRINTF(1, 2) PRODUCT_RETURN;
 
+  static bool track_latecomers()                          { return _track_latecomers; }
+
   static void deferred_initialize_stat();
   static void print_stat_on_exit();
   inline static void inc_vmop_coalesced_count() { _coalesced_vmop_count++; }
@@ -209,6 +216,9 @@ class ThreadSafepointState: public CHeapObj<mtInternal> {
   volatile suspend_type          _type;
   JavaThreadState                _orig_thread_state;
 
+  // Latecomer tracking (see PrintSafepointLatecomers)
+  JavaThreadState                _first_seen_state;  // thread state when first examined for this safepoint
+  jlong                          _arrival_time;      // time in nanos the thread reached the safepoint, 0 if unknown
 
  public:
   ThreadSafepointState(JavaThread *thread);
@@ -223,6 +233,14 @@ class ThreadSafepointState: public CHeapObj<mtInternal> {
   suspend_type type() const           { return _type; }
   bool         is_running() const     { return (_type==_running); }
   JavaThreadState orig_thread_state() const { return _orig_thread_state; }
+  JavaThreadState first_seen_state() const  { return _first_seen_state; }
+  jlong        arrival_time() const   { return _arrival_time; }
+
+  void record_arrival() {
+    if (SafepointSynchronize::track_latecomers()) {
+      _arrival_time = os::javaTimeNanos();
+    }
+  }
 
   // Support for safepoint timeout (debugging)
   bool has_called_back() const                   { return _has_called_back; }
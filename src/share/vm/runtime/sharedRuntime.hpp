@@ -569,6 +569,7 @@ class SharedRuntime: AllStatic {
   static int     _nof_optimized_interface_calls; // total # of statically-bound interface calls
   static int     _nof_inlined_interface_calls;   // total # of inlined interface calls
   static int     _nof_megamorphic_interface_calls;// total # of megamorphic interface calls
+  static int     _nof_itable_stub_cache_hits;    // total # of itable stub calls finding the receiver in the call site's cache
   // stats for runtime exceptions
   static int     _nof_removable_exceptions;      // total # of exceptions that could be replaced by branches due to inlining
 
@@ -582,6 +583,7 @@ class SharedRuntime: AllStatic {
   static address nof_optimized_interface_calls_addr()   { return (address)&_nof_optimized_interface_calls; }
   static address nof_inlined_interface_calls_addr()     { return (address)&_nof_inlined_interface_calls; }
   static address nof_megamorphic_interface_calls_addr() { return (address)&_nof_megamorphic_interface_calls; }
+  static address nof_itable_stub_cache_hits_addr()      { return (address)&_nof_itable_stub_cache_hits; }
   static void print_call_statistics(int comp_total);
   static void print_statistics();
   static void print_ic_miss_histogram();
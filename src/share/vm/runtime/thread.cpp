@@ -27,6 +27,7 @@
 #include "classfile/javaClasses.hpp"
 #include "classfile/systemDictionary.hpp"
 #include "classfile/vmSymbols.hpp"
+#include "ci/ciEnv.hpp"
 #include "code/scopeDesc.hpp"
 #include "compiler/compileBroker.hpp"
 #include "interpreter/interpreter.hpp"
@@ -46,6 +47,7 @@
 #include "prims/jvmtiThreadState.hpp"
 #include "prims/privilegedStack.hpp"
 #include "runtime/arguments.hpp"
+#include "runtime/asyncLogWriter.hpp"
 #include "runtime/biasedLocking.hpp"
 #include "runtime/deoptimization.hpp"
 #include "runtime/fprofiler.hpp"
@@ -82,6 +84,7 @@
 #include "utilities/defaultStream.hpp"
 #include "utilities/dtrace.hpp"
 #include "utilities/events.hpp"
+#include "utilities/log.hpp"
 #include "utilities/preserveException.hpp"
 #include "utilities/macros.hpp"
 #ifdef TARGET_OS_FAMILY_linux
@@ -235,6 +238,7 @@ Thread::Thread() {
   _oops_do_parity = 0;
 
   _metadata_on_stack_buffer = NULL;
+  _async_log_buffer = NULL;
 
   // the handle mark links itself to last_handle_mark
   new HandleMark(this);
@@ -344,6 +348,12 @@ Thread::~Thread() {
 
   EVENT_THREAD_DESTRUCT(this);
 
+  // The async log writer frees the buffer once it has been written out
+  if (_async_log_buffer != NULL) {
+    _async_log_buffer->release();
+    _async_log_buffer = NULL;
+  }
+
   // stack_base can be NULL if the thread is never started or exited before
   // record_stack_base_and_size called. Although, we would like to ensure
   // that all started threads do call record_stack_base_and_size(), there is
@@ -1467,6 +1477,9 @@ void JavaThread::initialize() {
   _blocked_on_compilation = false;
   _jni_active_critical = 0;
   _pending_jni_exception_check_fn = NULL;
+  _profile_sample_countdown = 0;
+  // seed from the thread address so that threads do not sample in step
+  _profile_sample_seed = (juint)((uintptr_t)this >> 4);
   _do_not_unlock_if_synchronized = false;
   _cached_monitor_info = NULL;
   _parker = Parker::Allocate(this) ;
@@ -3250,6 +3263,11 @@ CompilerThread::CompilerThread(CompileQueue* queue, CompilerCounters* counters)
   _buffer_blob = NULL;
   _scanned_nmethod = NULL;
   _compiler = NULL;
+  _arena_bytes = 0;
+  _arena_base = 0;
+  _arena_peak = 0;
+  _arena_limit = 0;
+  _arena_limit_exceeded = false;
 
   // Compiler uses resource area for compilation, let's bias it to mtCompiler
   resource_area()->bias_to(mtCompiler);
@@ -3259,6 +3277,27 @@ CompilerThread::CompilerThread(CompileQueue* queue, CompilerCounters* counters)
 #endif
 }
 
+void CompilerThread::start_arena_accounting(size_t limit) {
+  _arena_base = _arena_bytes;
+  _arena_peak = _arena_bytes;
+  _arena_limit = limit;
+  _arena_limit_exceeded = false;
+}
+
+void CompilerThread::arena_size_changed(long delta) {
+  // Arenas that grew before accounting started may shrink below zero
+  _arena_bytes = (delta < 0 && (size_t)-delta > _arena_bytes) ? 0 : _arena_bytes + delta;
+  if (_arena_bytes > _arena_peak) {
+    _arena_peak = _arena_bytes;
+    if (_arena_limit != 0 && !_arena_limit_exceeded &&
+        _arena_peak - _arena_base > _arena_limit && _env != NULL) {
+      // The compiler notices the failure at its next bailout check
+      _arena_limit_exceeded = true;
+      _env->record_failure("compilation memory limit exceeded");
+    }
+  }
+}
+
 void CompilerThread::oops_do(OopClosure* f, CLDClosure* cld_f, CodeBlobClosure* cf) {
   JavaThread::oops_do(f, cld_f, cf);
   if (_scanned_nmethod != NULL && cf != NULL) {
@@ -3382,6 +3421,9 @@ jint Threads::create_vm(JavaVMInitArgs* args, bool* canTryAgain) {
 
   // Initialize output stream logging
   ostream_init_log();
+  if (!Log::initialize()) {
+    return JNI_EINVAL;
+  }
 
   // Convert -Xrun to -agentlib: if there is no JVM_OnLoad
   // Must be before create_vm_init_agents()
@@ -3706,6 +3748,9 @@ jint Threads::create_vm(JavaVMInitArgs* args, bool* canTryAgain) {
       }
   }
 
+  // Start the asynchronous log writer, if requested
+  AsyncLogWriter::initialize();
+
   create_vm_timer.end();
 #ifdef ASSERT
   _vm_complete = true;
@@ -4365,6 +4410,11 @@ void Threads::print_on(outputStream* st, bool print_stacks, bool internal_format
     wt->print_on(st);
     st->cr();
   }
+  AsyncLogWriter* alw = AsyncLogWriter::writer_thread();
+  if (alw != NULL) {
+    alw->print_on(st);
+    st->cr();
+  }
   CompileBroker::print_compiler_threads_on(st);
   st->flush();
 }
@@ -81,6 +81,7 @@ class ThreadClosure;
 class IdealGraphPrinter;
 
 class Metadata;
+class AsyncLogBuffer;
 template <class T, MEMFLAGS F> class ChunkedList;
 typedef ChunkedList<Metadata*, mtInternal> MetadataOnStackBuffer;
 
@@ -260,6 +261,9 @@ class Thread: public ThreadShadow {
   // Thread-local buffer used by MetadataOnStackMark.
   MetadataOnStackBuffer* _metadata_on_stack_buffer;
 
+  // Thread-local buffer used by AsyncLogStream, allocated on first use.
+  AsyncLogBuffer* _async_log_buffer;
+
   TRACE_DATA _trace_data;                       // Thread-local data for tracing
 
   ThreadExt _ext;
@@ -524,6 +528,9 @@ public:
   void set_metadata_on_stack_buffer(MetadataOnStackBuffer* buffer) { _metadata_on_stack_buffer = buffer; }
   MetadataOnStackBuffer* metadata_on_stack_buffer() const          { return _metadata_on_stack_buffer; }
 
+  void set_async_log_buffer(AsyncLogBuffer* buffer)                 { _async_log_buffer = buffer; }
+  AsyncLogBuffer* async_log_buffer() const                          { return _async_log_buffer; }
+
 protected:
   // OS data associated with the thread
   OSThread* _osthread;  // Platform-specific thread information
@@ -774,6 +781,9 @@ class CompilerThread;
 
 typedef void (*ThreadFunction)(JavaThread*, TRAPS);
 
+// Printable name of a JavaThreadState
+const char* _get_thread_state_name(JavaThreadState _thread_state);
+
 class JavaThread: public Thread {
   friend class VMStructs;
  private:
@@ -927,6 +937,10 @@ class JavaThread: public Thread {
   // Checked JNI: function name requires exception check
   char* _pending_jni_exception_check_fn;
 
+  // Sampled branch profiling in C1 code (see C1ProfileBranchSampleLog)
+  jint    _profile_sample_countdown;             // executions left before the next profile update
+  juint   _profile_sample_seed;                  // state of the generator for the next interval
+
   // For deadlock detection.
   int _depth_first_number;
 
@@ -1372,6 +1386,8 @@ class JavaThread: public Thread {
   static ByteSize suspend_flags_offset()         { return byte_offset_of(JavaThread, _suspend_flags       ); }
 
   static ByteSize do_not_unlock_if_synchronized_offset() { return byte_offset_of(JavaThread, _do_not_unlock_if_synchronized); }
+  static ByteSize profile_sample_countdown_offset() { return byte_offset_of(JavaThread, _profile_sample_countdown); }
+  static ByteSize profile_sample_seed_offset()   { return byte_offset_of(JavaThread, _profile_sample_seed ); }
   static ByteSize should_post_on_exceptions_flag_offset() {
     return byte_offset_of(JavaThread, _should_post_on_exceptions_flag);
   }
@@ -1833,6 +1849,14 @@ class CompilerThread : public JavaThread {
   nmethod*          _scanned_nmethod;  // nmethod being scanned by the sweeper
   AbstractCompiler* _compiler;
 
+  // Arena memory used by this thread, kept up to date by Arena
+  size_t            _arena_bytes;
+  size_t            _arena_base;       // _arena_bytes when the current compilation started
+  size_t            _arena_peak;       // highest _arena_bytes since then
+  size_t            _arena_limit;      // growth that bails out the compilation, 0 for none
+  bool              _arena_limit_exceeded;
+  ChunkCache        _chunk_cache;
+
  public:
 
   static CompilerThread* current();
@@ -1877,6 +1901,13 @@ public:
   void set_ideal_graph_printer(IdealGraphPrinter *n)             { _ideal_graph_printer = n; }
 #endif
 
+  // Memory used by the arenas of the current compilation
+  void          start_arena_accounting(size_t limit);
+  void          arena_size_changed(long delta);
+  size_t        arena_peak() const               { return _arena_peak - _arena_base; }
+  bool          arena_limit_exceeded() const     { return _arena_limit_exceeded; }
+  ChunkCache*   chunk_cache()                    { return &_chunk_cache; }
+
   // Get/set the thread's current task
   CompileTask*  task()                           { return _task; }
   void          set_task(CompileTask* task)      { _task = task; }
@@ -210,6 +210,10 @@ void VM_PrintJNI::doit() {
   JNIHandles::print_on(_out);
 }
 
+void VM_PrintDeoptimizations::doit() {
+  Deoptimization::print_method_statistics(_out, _limit);
+}
+
 VM_FindDeadlocks::~VM_FindDeadlocks() {
   if (_deadlocks != NULL) {
     DeadlockCycle* cycle = _deadlocks;
@@ -98,6 +98,7 @@
   template(RotateGCLog)                           \
   template(WhiteBoxOperation)                     \
   template(ClassLoaderStatsOperation)             \
+  template(PrintDeoptimizations)                  \
 
 class VM_Operation: public CHeapObj<mtInternal> {
  public:
@@ -326,6 +327,16 @@ class VM_PrintJNI: public VM_Operation {
   void doit();
 };
 
+class VM_PrintDeoptimizations: public VM_Operation {
+ private:
+  outputStream* _out;
+  int           _limit;
+ public:
+  VM_PrintDeoptimizations(outputStream* out, int limit) { _out = out; _limit = limit; }
+  VMOp_Type type() const                                { return VMOp_PrintDeoptimizations; }
+  void doit();
+};
+
 class DeadlockCycle;
 class VM_FindDeadlocks: public VM_Operation {
  private:
@@ -63,6 +63,7 @@ void DCmdRegistrant::register_dcmds(){
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<ThreadDumpDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<RotateGCLogDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<ClassLoaderStatsDCmd>(full_export, true, false));
+  DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<DeoptimizationsDCmd>(full_export, true, false));
 
   // Enhanced JMX Agent Support
   // These commands won't be exported via the DiagnosticCommandMBean until an
@@ -488,6 +489,32 @@ int ThreadDumpDCmd::num_arguments() {
   }
 }
 
+DeoptimizationsDCmd::DeoptimizationsDCmd(outputStream* output, bool heap) :
+                                         DCmdWithParser(output, heap),
+  _limit("-limit", "Number of methods to print", "INT", false, "20") {
+  _dcmdparser.add_dcmd_option(&_limit);
+}
+
+void DeoptimizationsDCmd::execute(DCmdSource source, TRAPS) {
+  if (_limit.value() < 0) {
+    THROW_MSG(vmSymbols::java_lang_IllegalArgumentException(),
+              "Limit must be non-negative");
+  }
+  VM_PrintDeoptimizations op(output(), (int)MIN2(_limit.value(), (jlong)max_jint));
+  VMThread::execute(&op);
+}
+
+int DeoptimizationsDCmd::num_arguments() {
+  ResourceMark rm;
+  DeoptimizationsDCmd* dcmd = new DeoptimizationsDCmd(NULL, false);
+  if (dcmd != NULL) {
+    DCmdMark mark(dcmd);
+    return dcmd->_dcmdparser.num_arguments();
+  } else {
+    return 0;
+  }
+}
+
 // Enhanced JMX Agent support
 
 JMXStartRemoteDCmd::JMXStartRemoteDCmd(outputStream *output, bool heap_allocated) :
@@ -334,6 +334,30 @@ public:
   virtual void execute(DCmdSource source, TRAPS);
 };
 
+class DeoptimizationsDCmd : public DCmdWithParser {
+protected:
+  DCmdArgument<jlong> _limit;
+public:
+  DeoptimizationsDCmd(outputStream* output, bool heap);
+  static const char* name() {
+    return "Compiler.deoptimizations";
+  }
+  static const char* description() {
+    return "Print deoptimization counters per reason, the most often "
+           "recompiled methods and the recent deoptimization events.";
+  }
+  static const char* impact() {
+    return "Medium: Depends on the number of loaded methods.";
+  }
+  static const JavaPermission permission() {
+    JavaPermission p = {"java.lang.management.ManagementPermission",
+                        "monitor", NULL};
+    return p;
+  }
+  static int num_arguments();
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
 // Enhanced JMX Agent support
 
 class JMXStartRemoteDCmd : public DCmdWithParser {
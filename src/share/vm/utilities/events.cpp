@@ -62,6 +62,12 @@ void Events::print() {
   print_all(tty);
 }
 
+void Events::print_deopt_messages(outputStream* out) {
+  if (_deopt_messages != NULL) {
+    _deopt_messages->print_log_on(out);
+  }
+}
+
 void Events::init() {
   if (LogEvents) {
     _messages = new StringEventLog("Events");
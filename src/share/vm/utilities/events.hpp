@@ -195,6 +195,9 @@ class Events : AllStatic {
   // Dump all events to the tty
   static void print();
 
+  // Print the recent deoptimization events
+  static void print_deopt_messages(outputStream* out);
+
   // Logs a generic message with timestamp and format as printf.
   static void log(Thread* thread, const char* format, ...) ATTRIBUTE_PRINTF(2, 3);
 
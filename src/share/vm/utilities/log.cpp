@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) 2016, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "runtime/arguments.hpp"
+#include "runtime/globals.hpp"
+#include "runtime/os.hpp"
+#include "utilities/defaultStream.hpp"
+#include "utilities/log.hpp"
+#include "utilities/ostream.hpp"
+
+#define LOG_TAG_NAME(name) #name,
+const char* LogTag::_names[LogTag::Count] = {
+  LOG_TAG_LIST(LOG_TAG_NAME)
+};
+#undef LOG_TAG_NAME
+
+const char* LogLevel::_names[LogLevel::Count] = {
+  "off", "error", "warning", "info", "debug", "trace"
+};
+
+LogLevel::type Log::_levels[LogTag::Count];
+outputStream*  Log::_output = NULL;
+
+static bool name_matches(const char* name, const char* str, size_t len) {
+  return strlen(name) == len && strncmp(name, str, len) == 0;
+}
+
+LogTag::type LogTag::from_string(const char* str, size_t len) {
+  for (int i = 0; i < Count; i++) {
+    if (name_matches(_names[i], str, len)) {
+      return (type)i;
+    }
+  }
+  return Count;
+}
+
+LogLevel::type LogLevel::from_string(const char* str, size_t len) {
+  for (int i = 0; i < Count; i++) {
+    if (name_matches(_names[i], str, len)) {
+      return (type)i;
+    }
+  }
+  return Count;
+}
+
+// Parses a comma separated list of <tag>=<level> pairs. A tag without a
+// level is enabled at level info.
+bool Log::parse_tags(const char* config) {
+  const char* p = config;
+  while (*p != '\0') {
+    const char* end = strchr(p, ',');
+    if (end == NULL) {
+      end = p + strlen(p);
+    }
+    const char* eq = p;
+    while (eq < end && *eq != '=') {
+      eq++;
+    }
+
+    LogLevel::type level = LogLevel::info;
+    if (eq < end) {
+      level = LogLevel::from_string(eq + 1, end - (eq + 1));
+      if (level == LogLevel::Count) {
+        jio_fprintf(defaultStream::error_stream(),
+                    "Invalid log level '%.*s' in -XX:LogTags=%s\n",
+                    (int)(end - (eq + 1)), eq + 1, config);
+        return false;
+      }
+    }
+
+    if (name_matches("all", p, eq - p)) {
+      for (int i = 0; i < LogTag::Count; i++) {
+        _levels[i] = level;
+      }
+    } else {
+      LogTag::type tag = LogTag::from_string(p, eq - p);
+      if (tag == LogTag::Count) {
+        jio_fprintf(defaultStream::error_stream(),
+                    "Invalid log tag '%.*s' in -XX:LogTags=%s\n",
+                    (int)(eq - p), p, config);
+        return false;
+      }
+      _levels[tag] = level;
+    }
+
+    p = (*end == ',') ? end + 1 : end;
+  }
+  return true;
+}
+
+bool Log::initialize() {
+  for (int i = 0; i < LogTag::Count; i++) {
+    _levels[i] = LogLevel::warning;
+  }
+  if (LogTags != NULL && !parse_tags(LogTags)) {
+    return false;
+  }
+  // Older flags that are now implemented on top of tagged logging
+  if (PrintSafepointLatecomers && !is_enabled(LogTag::safepoint, LogLevel::info)) {
+    _levels[LogTag::safepoint] = LogLevel::info;
+  }
+
+  if (LogTagsOutput == NULL || strcmp(LogTagsOutput, "stdout") == 0) {
+    _output = new(ResourceObj::C_HEAP, mtInternal) fileStream(defaultStream::output_stream());
+  } else if (strcmp(LogTagsOutput, "stderr") == 0) {
+    _output = new(ResourceObj::C_HEAP, mtInternal) fileStream(defaultStream::error_stream());
+  } else {
+    fileStream* file = new(ResourceObj::C_HEAP, mtInternal) fileStream(LogTagsOutput, "w");
+    if (!file->is_open()) {
+      jio_fprintf(defaultStream::error_stream(),
+                  "Could not open log file '%s' for -XX:LogTagsOutput\n", LogTagsOutput);
+      delete file;
+      return false;
+    }
+    _output = file;
+  }
+  return true;
+}
+
+void Log::print(LogTag::type tag, LogLevel::type level, const char* format, ...) {
+  va_list ap;
+  va_start(ap, format);
+  vprint(tag, level, format, ap);
+  va_end(ap);
+}
+
+void Log::vprint(LogTag::type tag, LogLevel::type level, const char* format, va_list ap) {
+  char buffer[O_BUFLEN];
+  int len = vsnprintf(buffer, sizeof(buffer), format, ap);
+  if (len < 0 || len >= (int)sizeof(buffer)) {
+    len = (int)sizeof(buffer) - 1;
+  }
+  write(tag, level, buffer, len);
+}
+
+void Log::write(LogTag::type tag, LogLevel::type level, const char* message, size_t len) {
+  outputStream* out = _output;
+  if (out == NULL) {
+    // Not initialized yet, or already shut down
+    return;
+  }
+  // The decorations and the message go out in a single write, so that
+  // messages from different threads are never interleaved.
+  char line[O_BUFLEN + 64];
+  int prefix = jio_snprintf(line, sizeof(line), "[%.3fs][%s][%s] ",
+                            os::elapsedTime(), LogLevel::name(level), LogTag::name(tag));
+  if (prefix < 0) {
+    return;
+  }
+  size_t room = sizeof(line) - prefix - 1;
+  if (len > room) {
+    len = room;
+  }
+  memcpy(line + prefix, message, len);
+  line[prefix + len] = '\n';
+  out->write(line, prefix + len + 1);
+}
+
+LogStream::~LogStream() {
+  flush();
+}
+
+void LogStream::write(const char* s, size_t len) {
+  for (size_t i = 0; i < len; i++) {
+    char c = s[i];
+    if (c == '\n') {
+      Log::write(_tag, _level, _line, _pos);
+      _pos = 0;
+      continue;
+    }
+    if (_pos == sizeof(_line)) {
+      Log::write(_tag, _level, _line, _pos);
+      _pos = 0;
+    }
+    _line[_pos++] = c;
+  }
+  update_position(s, len);
+}
+
+void LogStream::flush() {
+  if (_pos > 0) {
+    Log::write(_tag, _level, _line, _pos);
+    _pos = 0;
+  }
+}
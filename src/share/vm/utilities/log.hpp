@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2016, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_VM_UTILITIES_LOG_HPP
+#define SHARE_VM_UTILITIES_LOG_HPP
+
+#include "memory/allocation.hpp"
+#include "utilities/ostream.hpp"
+
+// Tagged logging
+//
+// Log messages are classified by a tag, naming the subsystem that emits
+// them, and a level. The level of each tag is selected on the command line
+// with -XX:LogTags=<tag>=<level>,..., for example
+//
+//   -XX:LogTags=gc=info,safepoint=debug
+//
+// The tag "all" sets the level of every tag. Messages are written to the
+// output selected by -XX:LogTagsOutput (stdout, stderr or a file name), one
+// line per message, decorated with the VM uptime, the level and the tag:
+//
+//   [12.345s][info][safepoint] Safepoint latecomers: ...
+//
+// With -XX:+AsyncLogging the output is written by the AsyncLogWriter thread,
+// so a thread that logs never blocks on the file system.
+//
+// Usage:
+//   if (Log::is_enabled(LogTag::safepoint, LogLevel::info)) {
+//     Log::print(LogTag::safepoint, LogLevel::info, "...", ...);
+//   }
+// or, to reuse code that prints to an outputStream:
+//   LogStream ls(LogTag::safepoint, LogLevel::info);
+//   method->print_short_name(&ls);
+
+// To add a tag, add it to this list.
+#define LOG_TAG_LIST(tag)                                                     \
+  tag(ref)                                                                    \
+  tag(safepoint)                                                              \
+  tag(compilation)
+
+class LogTag : AllStatic {
+ public:
+#define LOG_TAG_ENUM(name) name,
+  enum type {
+    LOG_TAG_LIST(LOG_TAG_ENUM)
+    Count
+  };
+#undef LOG_TAG_ENUM
+
+  static const char* name(type tag) { return _names[tag]; }
+  // Returns Count if the name is unknown
+  static type from_string(const char* name, size_t len);
+
+ private:
+  static const char* _names[Count];
+};
+
+class LogLevel : AllStatic {
+ public:
+  // Ordered by increasing verbosity
+  enum type {
+    off,
+    error,
+    warning,
+    info,
+    debug,
+    trace,
+    Count
+  };
+
+  static const char* name(type level) { return _names[level]; }
+  // Returns Count if the name is unknown
+  static type from_string(const char* name, size_t len);
+
+ private:
+  static const char* _names[Count];
+};
+
+class Log : AllStatic {
+  friend class AsyncLogWriter;
+ private:
+  static LogLevel::type _levels[LogTag::Count];
+  static outputStream*  _output;
+
+  static bool parse_tags(const char* config);
+  static void set_output(outputStream* output) { _output = output; }
+  static outputStream* output()                { return _output; }
+
+ public:
+  // Called once the command line has been parsed. Returns false, after
+  // printing an error, if LogTags or LogTagsOutput is malformed.
+  static bool initialize();
+
+  static bool is_enabled(LogTag::type tag, LogLevel::type level) {
+    return level != LogLevel::off && level <= _levels[tag];
+  }
+  static void set_level(LogTag::type tag, LogLevel::type level) {
+    _levels[tag] = level;
+  }
+
+  static void print(LogTag::type tag, LogLevel::type level, const char* format, ...) ATTRIBUTE_PRINTF(3, 4);
+  static void vprint(LogTag::type tag, LogLevel::type level, const char* format, va_list ap) ATTRIBUTE_PRINTF(3, 0);
+  // Writes a single, already formatted message
+  static void write(LogTag::type tag, LogLevel::type level, const char* message, size_t len);
+};
+
+// An outputStream that turns each line written to it into a log message.
+// Lines longer than the internal buffer are split into several messages.
+class LogStream : public outputStream {
+ private:
+  LogTag::type   _tag;
+  LogLevel::type _level;
+  size_t         _pos;
+  char           _line[O_BUFLEN];
+
+ public:
+  LogStream(LogTag::type tag, LogLevel::type level) :
+    _tag(tag), _level(level), _pos(0) {}
+  ~LogStream();
+
+  bool is_enabled() const { return Log::is_enabled(_tag, _level); }
+
+  virtual void write(const char* s, size_t len);
+  virtual void flush();
+};
+
+#endif // SHARE_VM_UTILITIES_LOG_HPP
@@ -27,6 +27,8 @@
 #include "gc_implementation/shared/gcId.hpp"
 #include "oops/oop.inline.hpp"
 #include "runtime/arguments.hpp"
+#include "runtime/asyncLogWriter.hpp"
+#include "runtime/mutexLocker.hpp"
 #include "runtime/os.hpp"
 #include "utilities/defaultStream.hpp"
 #include "utilities/ostream.hpp"
@@ -854,8 +856,9 @@ void gcLogFileStream::rotate_log(bool force, outputStream* out) {
 #ifdef ASSERT
   Thread *thread = Thread::current();
   assert(thread == NULL ||
-         (thread->is_VM_thread() && SafepointSynchronize::is_at_safepoint()),
-         "Must be VMThread at safepoint");
+         (thread->is_VM_thread() && SafepointSynchronize::is_at_safepoint()) ||
+         AsyncLog_lock->owned_by_self(),
+         "Must be VMThread at safepoint or the async log writer");
 #endif
   if (NumberOfGCLogFiles == 1) {
     // rotate in same file
@@ -1340,6 +1343,8 @@ void ostream_exit() {
   static bool ostream_exit_called = false;
   if (ostream_exit_called)  return;
   ostream_exit_called = true;
+  // The writer thread must be done with the streams before they are deleted
+  AsyncLogWriter::stop();
 #if INCLUDE_CDS
   if (classlist_file != NULL) {
     delete classlist_file;
@@ -1370,6 +1375,7 @@ void ostream_exit() {
 // ostream_abort() is called by os::abort() when VM is about to die.
 void ostream_abort() {
   // Here we can't delete gclog_or_tty and tty, just flush their output
+  AsyncLogWriter::flush_on_abort();
   if (gclog_or_tty) gclog_or_tty->flush();
   if (tty) tty->flush();
 
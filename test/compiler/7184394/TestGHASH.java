@@ -0,0 +1,253 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary AES/GCM and AES/CTR must produce the known answers with the GHASH and counter mode intrinsics
+ * @library /testlibrary
+ * @run main TestGHASH
+ * @run main/othervm -Xbatch TestGHASH bench 2000
+ * @run main/othervm -Xbatch -XX:-UseGHASHIntrinsics -XX:-UseAESCTRIntrinsics TestGHASH bench 2000
+ */
+
+import java.lang.management.ManagementFactory;
+import java.util.Arrays;
+import javax.crypto.Cipher;
+import javax.crypto.spec.GCMParameterSpec;
+import javax.crypto.spec.IvParameterSpec;
+import javax.crypto.spec.SecretKeySpec;
+
+import com.oracle.java.testlibrary.*;
+import com.sun.management.HotSpotDiagnosticMXBean;
+
+public class TestGHASH {
+    static final String GHASH_INTRINSIC = "com\\.sun\\.crypto\\.provider\\.GHASH::processBlocks \\(\\d+ bytes\\)\\s+\\(intrinsic";
+    static final String CTR_INTRINSIC = "com\\.sun\\.crypto\\.provider\\.CounterMode::implCrypt \\(\\d+ bytes\\)\\s+\\(intrinsic";
+
+    public static void main(String[] args) throws Exception {
+        if (args.length > 0 && args[0].equals("bench")) {
+            bench(Integer.valueOf(args[1]));
+            return;
+        }
+
+        OutputAnalyzer output = run("-XX:+PrintIntrinsics");
+        // The intrinsics only bind to class libraries that have the entry points
+        if (output.getStdout().contains("UseGHASHIntrinsics=true") &&
+            output.getStdout().contains("GHASH.processBlocks=true")) {
+            output.shouldMatch(GHASH_INTRINSIC);
+        }
+        if (output.getStdout().contains("UseAESCTRIntrinsics=true") &&
+            output.getStdout().contains("CounterMode.implCrypt=true")) {
+            output.shouldMatch(CTR_INTRINSIC);
+        }
+
+        output = run("-XX:+PrintIntrinsics", "-XX:-UseGHASHIntrinsics", "-XX:-UseAESCTRIntrinsics");
+        output.shouldNotMatch(GHASH_INTRINSIC);
+        output.shouldNotMatch(CTR_INTRINSIC);
+    }
+
+    static OutputAnalyzer run(String... flags) throws Exception {
+        String[] command = {
+            "-Xbatch",
+            "-XX:-TieredCompilation",
+            "-XX:+UnlockDiagnosticVMOptions",
+        };
+        String[] all = Arrays.copyOf(command, command.length + flags.length + 1);
+        System.arraycopy(flags, 0, all, command.length, flags.length);
+        all[all.length - 1] = KnownAnswers.class.getName();
+        OutputAnalyzer output = new OutputAnalyzer(ProcessTools.createJavaProcessBuilder(all).start());
+        System.out.println(output.getOutput());
+        output.shouldHaveExitValue(0);
+        return output;
+    }
+
+    static byte[] hex(String s) {
+        byte[] b = new byte[s.length() / 2];
+        for (int i = 0; i < b.length; i++) {
+            b[i] = (byte) Integer.parseInt(s.substring(2 * i, 2 * i + 2), 16);
+        }
+        return b;
+    }
+
+    static byte[] gcm(int mode, byte[] key, byte[] iv, byte[] aad, byte[] in) throws Exception {
+        Cipher c = Cipher.getInstance("AES/GCM/NoPadding", "SunJCE");
+        c.init(mode, new SecretKeySpec(key, "AES"), new GCMParameterSpec(128, iv));
+        c.updateAAD(aad);
+        return c.doFinal(in);
+    }
+
+    static byte[] ctr(int mode, byte[] key, byte[] counter, byte[] in) throws Exception {
+        Cipher c = Cipher.getInstance("AES/CTR/NoPadding", "SunJCE");
+        c.init(mode, new SecretKeySpec(key, "AES"), new IvParameterSpec(counter));
+        return c.doFinal(in);
+    }
+
+    static class KnownAnswers {
+        // Test cases 2, 3 and 4 of the GCM specification by McGrew and Viega,
+        // also used for the validation of NIST SP 800-38D implementations:
+        // key, IV, AAD, plain text, cipher text followed by the tag
+        static final String[][] GCM = {
+            { "00000000000000000000000000000000",
+              "000000000000000000000000",
+              "",
+              "00000000000000000000000000000000",
+              "0388dace60b6a392f328c2b971b2fe78" +
+              "ab6e47d42cec13bdf53a67b21257bddf" },
+            { "feffe9928665731c6d6a8f9467308308",
+              "cafebabefacedbaddecaf888",
+              "",
+              "d9313225f88406e5a55909c5aff5269a86a7a9531534f7da2e4c303d8a318a72" +
+              "1c3c0c95956809532fcf0e2449a6b525b16aedf5aa0de657ba637b391aafd255",
+              "42831ec2217774244b7221b784d0d49ce3aa212f2c02a4e035c17e2329aca12e" +
+              "21d514b25466931c7d8f6a5aac84aa051ba30b396a0aac973d58e091473f5985" +
+              "4d5c2af327cd64a62cf35abd2ba6fab4" },
+            { "feffe9928665731c6d6a8f9467308308",
+              "cafebabefacedbaddecaf888",
+              "feedfacedeadbeeffeedfacedeadbeefabaddad2",
+              "d9313225f88406e5a55909c5aff5269a86a7a9531534f7da2e4c303d8a318a72" +
+              "1c3c0c95956809532fcf0e2449a6b525b16aedf5aa0de657ba637b39",
+              "42831ec2217774244b7221b784d0d49ce3aa212f2c02a4e035c17e2329aca12e" +
+              "21d514b25466931c7d8f6a5aac84aa051ba30b396a0aac973d58e091" +
+              "5bc94fbc3221a5db94fae95ae7121a47" },
+        };
+
+        // CTR-AES128.Encrypt of NIST SP 800-38A, F.5.1: key, initial counter,
+        // plain text and cipher text
+        static final String[] CTR = {
+            "2b7e151628aed2a6abf7158809cf4f3c",
+            "f0f1f2f3f4f5f6f7f8f9fafbfcfdfeff",
+            "6bc1bee22e409f96e93d7e117393172aae2d8a571e03ac9c9eb76fac45af8e51" +
+            "30c81c46a35ce411e5fbc1191a0a52eff69f2445df4f9b17ad2b417be66c3710",
+            "874d6191b620e3261bef6864990db6ce9806f66b7970fdff8617187bb9fffdff" +
+            "5ae4df3edbd5d35e5b4f09020db03eab1e031dda2fbe03d1792170a0f3009cee",
+        };
+
+        static void check(byte[] expected, byte[] actual, String what, int round) {
+            if (!Arrays.equals(expected, actual)) {
+                throw new RuntimeException(what + " differs from the known answer in round " + round);
+            }
+        }
+
+        static boolean hasMethod(String className, String name, Class<?>... parameterTypes) {
+            try {
+                Class.forName(className).getDeclaredMethod(name, parameterTypes);
+                return true;
+            } catch (ReflectiveOperationException e) {
+                return false;
+            }
+        }
+
+        public static void main(String[] args) throws Exception {
+            HotSpotDiagnosticMXBean bean =
+                ManagementFactory.getPlatformMXBean(HotSpotDiagnosticMXBean.class);
+            System.out.println("UseGHASHIntrinsics=" + bean.getVMOption("UseGHASHIntrinsics").getValue());
+            System.out.println("UseAESCTRIntrinsics=" + bean.getVMOption("UseAESCTRIntrinsics").getValue());
+            System.out.println("GHASH.processBlocks=" +
+                               hasMethod("com.sun.crypto.provider.GHASH", "processBlocks",
+                                         byte[].class, int.class, int.class, long[].class, long[].class));
+            System.out.println("CounterMode.implCrypt=" +
+                               hasMethod("com.sun.crypto.provider.CounterMode", "implCrypt",
+                                         byte[].class, int.class, int.class, byte[].class, int.class));
+
+            // Enough rounds for the cipher code to be compiled early on
+            for (int n = 0; n < 3000; n++) {
+                for (String[] v : GCM) {
+                    byte[] key = hex(v[0]), iv = hex(v[1]), aad = hex(v[2]);
+                    byte[] plain = hex(v[3]), cipher = hex(v[4]);
+                    check(cipher, gcm(Cipher.ENCRYPT_MODE, key, iv, aad, plain), "AES/GCM encryption", n);
+                    check(plain, gcm(Cipher.DECRYPT_MODE, key, iv, aad, cipher), "AES/GCM decryption", n);
+                }
+                byte[] key = hex(CTR[0]), counter = hex(CTR[1]);
+                byte[] plain = hex(CTR[2]), cipher = hex(CTR[3]);
+                check(cipher, ctr(Cipher.ENCRYPT_MODE, key, counter, plain), "AES/CTR encryption", n);
+                check(plain, ctr(Cipher.DECRYPT_MODE, key, counter, cipher), "AES/CTR decryption", n);
+            }
+
+            // Lengths around the block size exercise the partial blocks of both
+            // the counter mode and the GHASH loops.
+            byte[] key = hex(GCM[1][0]);
+            byte[] iv = new byte[12];
+            byte[] aad = new byte[21];
+            for (int i = 0; i < aad.length; i++) {
+                aad[i] = (byte) (i * 3);
+            }
+            int[] lengths = { 0, 1, 15, 16, 17, 63, 64, 65, 646, 4099 };
+            for (int n = 0; n < 1000; n++) {
+                for (int l = 0; l < lengths.length; l++) {
+                    byte[] in = new byte[lengths[l]];
+                    for (int i = 0; i < in.length; i++) {
+                        in[i] = (byte) (i * 7 + l);
+                    }
+                    iv[0] = (byte) l;
+                    byte[] enc = gcm(Cipher.ENCRYPT_MODE, key, iv, aad, in);
+                    check(in, gcm(Cipher.DECRYPT_MODE, key, iv, aad, enc), "AES/GCM decryption", n);
+                }
+            }
+        }
+    }
+
+    // Throughput of the GCM and CTR paths, in the style of TestAESMain.
+    // Compare the runs with and without -XX:-UseGHASHIntrinsics -XX:-UseAESCTRIntrinsics.
+    static void bench(int iters) throws Exception {
+        final int size = 16 * 1024;
+        byte[] key = hex(KnownAnswers.GCM[1][0]);
+        byte[] iv = hex(KnownAnswers.GCM[1][1]);
+        byte[] aad = new byte[16];
+        byte[] in = new byte[size];
+        for (int i = 0; i < in.length; i++) {
+            in[i] = (byte) i;
+        }
+        Cipher gcm = Cipher.getInstance("AES/GCM/NoPadding", "SunJCE");
+        Cipher ctr = Cipher.getInstance("AES/CTR/NoPadding", "SunJCE");
+        SecretKeySpec spec = new SecretKeySpec(key, "AES");
+        byte[] out = new byte[size + 16];
+
+        for (int pass = 0; pass < 2; pass++) {
+            // The first pass is the warm-up
+            long start = System.nanoTime();
+            for (int i = 0; i < iters; i++) {
+                // GCM does not allow the same key and IV for two encryptions
+                iv[0] = (byte) i;
+                iv[1] = (byte) (i >> 8);
+                gcm.init(Cipher.ENCRYPT_MODE, spec, new GCMParameterSpec(128, iv));
+                gcm.updateAAD(aad);
+                gcm.doFinal(in, 0, size, out, 0);
+            }
+            long gcmTime = System.nanoTime() - start;
+
+            start = System.nanoTime();
+            ctr.init(Cipher.ENCRYPT_MODE, spec, new IvParameterSpec(new byte[16]));
+            for (int i = 0; i < iters; i++) {
+                ctr.update(in, 0, size, out, 0);
+            }
+            long ctrTime = System.nanoTime() - start;
+
+            if (pass > 0) {
+                System.out.println("AES/GCM encryption of " + size + " bytes x " + iters +
+                                   " runtime was " + gcmTime / 1000000.0 + " ms");
+                System.out.println("AES/CTR encryption of " + size + " bytes x " + iters +
+                                   " runtime was " + ctrTime / 1000000.0 + " ms");
+            }
+        }
+    }
+}
@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Loads hoisted out of C1 loops must see the stores of the loop, and sampled branch profiles
+ * @library /testlibrary
+ * @run main compiler.c1.TestLoopInvariantLoads
+ */
+
+package compiler.c1;
+
+import java.util.regex.Matcher;
+import java.util.regex.Pattern;
+
+import com.oracle.java.testlibrary.*;
+
+public class TestLoopInvariantLoads {
+    public static void main(String[] args) throws Exception {
+        // PrintValueNumbering only exists in debug builds
+        boolean trace = Platform.isDebugBuild();
+
+        // A store to count doesn't kill the loads of limit and step
+        OutputAnalyzer output = run("sumFields");
+        if (trace) {
+            output.shouldMatch(invariant("LoadField"));
+        }
+        output = run("sameField");
+        if (trace) {
+            output.shouldNotMatch(invariant("LoadField"));
+        }
+
+        // A store to a byte array doesn't kill a load from an int array
+        output = run("mixedArrays");
+        if (trace) {
+            output.shouldMatch(invariant("LoadIndexed"));
+        }
+        output = run("sameArray");
+        if (trace) {
+            output.shouldNotMatch(invariant("LoadIndexed"));
+        }
+
+        output = run("sumFields", "-XX:-UseLoopInvariantCodeMotion");
+        output.shouldNotContain("is loop invariant");
+
+        // Tier 3 code with sampled branch profiles
+        checkBranchProfile(0);
+        checkBranchProfile(3);
+        checkBranchProfile(6);
+    }
+
+    // Every sampled update adds 2^C1ProfileBranchSampleLog to a counter.
+    // The interpreter doesn't profile, so all counts come from tier 3 code.
+    static void checkBranchProfile(int sampleLog) throws Exception {
+        OutputAnalyzer output = run("branches", "-XX:TieredStopAtLevel=3", "-XX:-ProfileInterpreter",
+                                    "-XX:C1ProfileBranchSampleLog=" + sampleLog, "-XX:+PrintMethodData");
+        // PrintMethodData only exists in debug builds
+        if (!Platform.isDebugBuild()) {
+            return;
+        }
+        String out = output.getStdout();
+        int start = out.indexOf("LoopLoads.branches([I)I");
+        Asserts.assertGTE(start, 0, "branches has no profile");
+        int end = out.indexOf("-----", start);
+        Matcher m = Pattern.compile("taken\\((\\d+)\\)").matcher(out.substring(start, end < 0 ? out.length() : end));
+        long weight = 1L << sampleLog;
+        long total = 0;
+        while (m.find()) {
+            long count = Long.parseLong(m.group(1));
+            if (sampleLog > 0) {
+                Asserts.assertEQ(count % weight, 0L, m.group() + " is not scaled by " + weight);
+            }
+            total += count;
+        }
+        Asserts.assertGT(total, 0L, "no branch was profiled");
+    }
+
+    static String invariant(String instruction) {
+        return "Instruction " + instruction + " i\\d+ is loop invariant";
+    }
+
+    static OutputAnalyzer run(String method, String... flags) throws Exception {
+        String[] vmArgs = {
+            "-Xbatch",
+            "-XX:TieredStopAtLevel=1",
+            "-XX:+IgnoreUnrecognizedVMOptions",
+            "-XX:+PrintValueNumbering",
+            "-XX:CompileCommand=compileonly,*LoopLoads::" + method
+        };
+        String[] cmd = new String[vmArgs.length + flags.length + 2];
+        System.arraycopy(vmArgs, 0, cmd, 0, vmArgs.length);
+        System.arraycopy(flags, 0, cmd, vmArgs.length, flags.length);
+        cmd[cmd.length - 2] = LoopLoads.class.getName();
+        cmd[cmd.length - 1] = method;
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(cmd);
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.shouldHaveExitValue(0);
+        return output;
+    }
+
+    static class LoopLoads {
+        static class Counter {
+            int limit;
+            int step;
+            int count;
+            int[] data;
+            byte[] flags;
+        }
+
+        // limit and step are loop invariant, count is stored to in the loop
+        static int sumFields(Counter c, int n) {
+            int sum = 0;
+            for (int i = 0; i < n; i++) {
+                sum += c.limit * c.step;
+                c.count = c.count + (i & 1);
+            }
+            return sum + c.count;
+        }
+
+        // The loop stores and loads the same field, which must not be hoisted
+        static int sameField(Counter c, int n) {
+            int sum = 0;
+            for (int i = 0; i < n; i++) {
+                sum += c.count;
+                c.count = i;
+            }
+            return sum;
+        }
+
+        // Stores to a byte array do not kill loads from an int array
+        static int mixedArrays(Counter c, int n) {
+            int sum = 0;
+            for (int i = 0; i < n; i++) {
+                sum += c.data[3];
+                c.flags[i & 7] = (byte)i;
+            }
+            return sum;
+        }
+
+        // Stores to an int array do kill loads from the same array
+        static int sameArray(Counter c, int n) {
+            int sum = 0;
+            for (int i = 0; i < n; i++) {
+                sum += c.data[3];
+                c.data[i & 7] = i;
+            }
+            return sum;
+        }
+
+        static int branches(int[] a) {
+            int odd = 0;
+            for (int i = 0; i < a.length; i++) {
+                if ((a[i] & 1) != 0) {
+                    odd++;
+                } else if (a[i] > 1000) {
+                    odd += 2;
+                }
+            }
+            return odd;
+        }
+
+        static int call(String method, int[] a) {
+            Counter c = new Counter();
+            c.limit = 7;
+            c.step = 3;
+            c.data = new int[8];
+            c.flags = new byte[8];
+            c.data[3] = 5;
+            switch (method) {
+                case "sumFields":   return sumFields(c, 100);
+                case "sameField":   return sameField(c, 100);
+                case "mixedArrays": return mixedArrays(c, 100);
+                case "sameArray":   return sameArray(c, 100);
+                default:            return branches(a);
+            }
+        }
+
+        public static void main(String[] args) {
+            int[] a = new int[1000];
+            for (int i = 0; i < a.length; i++) {
+                a[i] = i * 37 % 2003;
+            }
+            // The first call runs in the interpreter
+            int expected = call(args[0], a);
+            for (int i = 0; i < 20000; i++) {
+                Asserts.assertEQ(call(args[0], a), expected);
+            }
+        }
+    }
+}
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary C2 phases split across helper threads must produce the same code as when run serially
+ * @library /testlibrary
+ * @run main TestParallelPhases
+ */
+
+import com.oracle.java.testlibrary.*;
+
+public class TestParallelPhases {
+
+    static final String SPLIT =
+        "\\[debug\\]\\[compilation\\] Compute_Effective_Degree split \\d+ items across %s C2 helper threads";
+
+    static OutputAnalyzer run(String... flags) throws Exception {
+        String[] cmd = new String[flags.length + 3];
+        cmd[0] = "-Xbatch";
+        cmd[1] = "-XX:LogTags=compilation=debug";
+        System.arraycopy(flags, 0, cmd, 2, flags.length);
+        cmd[cmd.length - 1] = Workload.class.getName();
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(cmd);
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.shouldHaveExitValue(0);
+        return output;
+    }
+
+    public static void main(String[] args) throws Exception {
+        // One CPU is left to the compiler thread
+        int helpers = Math.min(Runtime.getRuntime().availableProcessors() - 1, 4);
+
+        OutputAnalyzer output = run("-XX:-TieredCompilation", "-XX:C2ParallelPhaseThreshold=1",
+                                    "-XX:C2HelperThreadCount=4");
+        if (helpers > 0) {
+            output.shouldMatch(String.format(SPLIT, helpers));
+        }
+
+        output = run("-XX:-TieredCompilation", "-XX:C2ParallelPhaseThreshold=1",
+                     "-XX:C2HelperThreadCount=1");
+        if (helpers > 0) {
+            output.shouldMatch(String.format(SPLIT, 1));
+        }
+
+        output = run("-XX:-TieredCompilation", "-XX:C2ParallelPhaseThreshold=1",
+                     "-XX:C2HelperThreadCount=0");
+        output.shouldNotContain("C2 helper threads");
+
+        // Compilations compete for the helper threads
+        output = run("-XX:C2ParallelPhaseThreshold=1", "-XX:CICompilerCount=4");
+        if (helpers > 0) {
+            output.shouldMatch(String.format(SPLIT, "\\d+"));
+        }
+    }
+
+    static class Workload {
+        // A state machine with many values live across the switch, to give the
+        // register allocator a large interference graph
+        static long machine(int[] input) {
+            long a = 1, b = 2, c = 3, d = 4, e = 5, f = 6, g = 7, h = 8;
+            int state = 0;
+            for (int i = 0; i < input.length; i++) {
+                int x = input[i];
+                switch (state) {
+                    case 0:  a += x; b ^= a; state = (x & 3); break;
+                    case 1:  c *= x | 1; d += c >>> 3; state = (x >> 2) & 3; break;
+                    case 2:  e -= x; f = Long.rotateLeft(f ^ e, 7); state = (x + 1) & 3; break;
+                    default: g += h * x; h ^= g >>> 11; state = 0; break;
+                }
+                if ((x & 15) == 0) {
+                    long t = a; a = h; h = g; g = f; f = e; e = d; d = c; c = b; b = t;
+                }
+            }
+            return a + 3 * b + 5 * c + 7 * d + 11 * e + 13 * f + 17 * g + 19 * h;
+        }
+
+        static double mix(double[] v) {
+            double s0 = 0, s1 = 1, s2 = 2, s3 = 3, s4 = 4, s5 = 5;
+            for (int i = 0; i < v.length; i++) {
+                double x = v[i];
+                s0 += x * s5;
+                s1 = s1 * 0.5 + x;
+                s2 -= s0 * 1e-3;
+                s3 += Math.abs(s2 - s1);
+                s4 = s4 * 0.25 + s3 * 1e-6;
+                s5 = (s5 + s4) * 0.5;
+            }
+            return s0 + s1 + s2 + s3 + s4 + s5;
+        }
+
+        public static void main(String[] args) throws Exception {
+            final int[] input = new int[1000];
+            final double[] v = new double[1000];
+            for (int i = 0; i < input.length; i++) {
+                input[i] = (int)(i * 2654435761L);
+                v[i] = Math.sin(i);
+            }
+            // The first calls run in the interpreter
+            final long expectedMachine = machine(input);
+            final double expectedMix = mix(v);
+
+            // Several threads so that compilations compete for the helper threads
+            Thread[] threads = new Thread[4];
+            final Throwable[] failure = new Throwable[1];
+            for (int t = 0; t < threads.length; t++) {
+                threads[t] = new Thread() {
+                    public void run() {
+                        try {
+                            for (int i = 0; i < 20000; i++) {
+                                Asserts.assertEQ(machine(input), expectedMachine);
+                                Asserts.assertEQ(mix(v), expectedMix);
+                            }
+                        } catch (Throwable e) {
+                            synchronized (failure) {
+                                failure[0] = e;
+                            }
+                        }
+                    }
+                };
+                threads[t].start();
+            }
+            for (Thread t : threads) {
+                t.join();
+            }
+            if (failure[0] != null) {
+                throw new RuntimeException(failure[0]);
+            }
+        }
+    }
+}
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+/*
+ * @test
+ * @summary Cold blocks are laid out after the hot code of C2 methods
+ * @library /testlibrary
+ * @run main TestColdBlockLayout
+ */
+
+import java.util.List;
+
+import com.oracle.java.testlibrary.*;
+
+public class TestColdBlockLayout {
+    public static void main(String[] args) throws Exception {
+        OutputAnalyzer output = run("-XX:+BlockLayoutSplitColdBlocks");
+        // PrintOptoAssembly only exists in debug builds
+        if (Platform.isDebugBuild()) {
+            List<String> lines = output.asLines();
+            int ret = -1;
+            int trap = -1;
+            for (int i = 0; i < lines.size() && !lines.get(i).equals(Layout.WARMED_UP); i++) {
+                String line = lines.get(i);
+                if (line.matches("^\\s*([0-9a-f]+\\s+)?ret\\b.*")) {
+                    ret = i;
+                } else if (trap < 0 && line.contains("wrapper for: uncommon_trap")) {
+                    trap = i;
+                }
+            }
+            if (ret < 0 || trap < 0) {
+                throw new RuntimeException("no return or uncommon trap in the code of Layout.mix");
+            }
+            if (trap < ret) {
+                throw new RuntimeException("uncommon trap laid out before the return of Layout.mix");
+            }
+        }
+
+        run("-XX:-BlockLayoutSplitColdBlocks");
+        run("-XX:-CodeCacheSegregateHotCode");
+    }
+
+    static OutputAnalyzer run(String flag) throws Exception {
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(
+            "-Xbatch",
+            "-XX:-TieredCompilation",
+            "-XX:+IgnoreUnrecognizedVMOptions",
+            "-XX:+PrintOptoAssembly",
+            "-XX:CompileCommand=compileonly,*Layout::mix",
+            flag,
+            Layout.class.getName());
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.shouldHaveExitValue(0);
+        output.shouldContain(Layout.WARMED_UP);
+        return output;
+    }
+
+    static class Layout {
+        static final String WARMED_UP = "Layout.mix warmed up";
+
+        // The test for Long.MIN_VALUE is never taken while warming up, so
+        // it becomes an uncommon trap between two hot parts of the loop.
+        static long mix(long[] a) {
+            long h = 17;
+            for (int i = 0; i < a.length; i++) {
+                long x = a[i];
+                if (x == Long.MIN_VALUE) {
+                    h ^= x >>> 7;
+                } else {
+                    h += x * 13;
+                }
+                h = Long.rotateLeft(h, 5);
+            }
+            return h;
+        }
+
+        public static void main(String[] args) {
+            long[] a = new long[64];
+            for (int i = 0; i < a.length; i++) {
+                a[i] = i * 0x9E3779B97F4A7C15L;
+            }
+            long expected = mix(a);
+            for (int i = 0; i < 20000; i++) {
+                Asserts.assertEQ(mix(a), expected);
+            }
+            System.out.println(WARMED_UP);
+
+            // The compiled code deoptimizes at the trap, and must agree
+            // with the interpreter that runs it afterwards.
+            a[30] = Long.MIN_VALUE;
+            Asserts.assertEQ(mix(a), mix(a));
+        }
+    }
+}
@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Megamorphic interface calls through the receiver cache of the itable stub
+ * @library /testlibrary
+ * @run main TestMegamorphicInterfaceCall
+ */
+
+import java.util.regex.Matcher;
+import java.util.regex.Pattern;
+
+import com.oracle.java.testlibrary.*;
+
+public class TestMegamorphicInterfaceCall {
+    public static void main(String[] args) throws Exception {
+        // CountCompiledCalls only exists in debug builds, and only the
+        // x86_64 itable stub has the receiver cache.
+        boolean count = Platform.isDebugBuild() && Platform.isX64();
+
+        int hits = cacheHits(run());
+        if (count && hits == 0) {
+            throw new RuntimeException("no itable stub cache hits");
+        }
+        run("-XX:ItableStubCacheSize=1");
+        hits = cacheHits(run("-XX:ItableStubCacheSize=8"));
+        if (count && hits == 0) {
+            throw new RuntimeException("no itable stub cache hits with 8 entries");
+        }
+
+        // Without filling the cache every receiver takes the itable scan
+        Asserts.assertEQ(cacheHits(run("-XX:ItableStubCacheMissLimit=0")), 0);
+        Asserts.assertEQ(cacheHits(run("-XX:-UseItableStubCache")), 0);
+    }
+
+    static int cacheHits(OutputAnalyzer output) {
+        Matcher m = Pattern.compile("(\\d+)\\s+\\(\\s*\\d+%\\)\\s+itable cache hits").matcher(output.getStdout());
+        return m.find() ? Integer.parseInt(m.group(1)) : 0;
+    }
+
+    static OutputAnalyzer run(String... flags) throws Exception {
+        String[] vmArgs = {
+            "-Xbatch",
+            "-XX:+IgnoreUnrecognizedVMOptions",
+            "-XX:+CountCompiledCalls"
+        };
+        String[] cmd = new String[vmArgs.length + flags.length + 1];
+        System.arraycopy(vmArgs, 0, cmd, 0, vmArgs.length);
+        System.arraycopy(flags, 0, cmd, vmArgs.length, flags.length);
+        cmd[cmd.length - 1] = Calls.class.getName();
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(cmd);
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.shouldHaveExitValue(0);
+        return output;
+    }
+
+    interface Named {
+        int id();
+    }
+
+    interface Valued {
+        int value();
+    }
+
+    static class A implements Valued { public int value() { return 1; } }
+    static class B implements Valued { public int value() { return 2; } }
+    static class C implements Valued { public int value() { return 3; } }
+    static class D implements Valued { public int value() { return 4; } }
+    static class E implements Valued { public int value() { return 5; } }
+    static class F implements Valued { public int value() { return 6; } }
+    static class G implements Named, Valued {
+        public int id() { return 100; }
+        public int value() { return 7; }
+    }
+    static class H extends G {
+        public int value() { return 8; }
+    }
+    static class I extends H { }
+    static class J implements Named, Valued {
+        public int value() { return 10; }
+        public int id() { return 200; }
+    }
+
+    static class Calls {
+        static final int[] VALUES = { 1, 2, 3, 4, 5, 6, 7, 8, 8, 10 };
+
+        static int sum(Valued[] values) {
+            int sum = 0;
+            for (Valued v : values) {
+                sum += v.value();
+            }
+            return sum;
+        }
+
+        static Valued make(int k) {
+            switch (k) {
+                case 0: return new A();
+                case 1: return new B();
+                case 2: return new C();
+                case 3: return new D();
+                case 4: return new E();
+                case 5: return new F();
+                case 6: return new G();
+                case 7: return new H();
+                case 8: return new I();
+                default: return new J();
+            }
+        }
+
+        public static void main(String[] args) {
+            // Few receivers, which fit in the cache, then many more
+            int[] kinds = { 3, 6, 10 };
+            for (int kind : kinds) {
+                Valued[] values = new Valued[97];
+                int expected = 0;
+                for (int i = 0; i < values.length; i++) {
+                    int k = (i * 7) % kind;
+                    values[i] = make(k);
+                    expected += VALUES[k];
+                }
+                for (int i = 0; i < 20000; i++) {
+                    Asserts.assertEQ(sum(values), expected);
+                }
+            }
+
+            // A null receiver must still throw
+            Valued[] values = { new A(), new B(), null };
+            try {
+                sum(values);
+                throw new RuntimeException("no exception");
+            } catch (NullPointerException e) {
+                // expected
+            }
+        }
+    }
+}
@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Allocations merged only for field loads are scalar replaced, and
+ *          the split loads see the values of the right object
+ * @library /testlibrary
+ * @run main/othervm -Xbatch -XX:-TieredCompilation -XX:-UseOnStackReplacement
+ *                   -XX:+ReduceAllocationMerges TestAllocationMerges eliminated
+ * @run main/othervm -Xbatch -XX:-TieredCompilation -XX:-UseOnStackReplacement
+ *                   -XX:-ReduceAllocationMerges TestAllocationMerges allocated
+ */
+
+import java.lang.management.ManagementFactory;
+
+import com.oracle.java.testlibrary.Asserts;
+import com.sun.management.ThreadMXBean;
+
+public class TestAllocationMerges {
+
+    static class Point {
+        int x;
+        int y;
+        Point(int x, int y) {
+            this.x = x;
+            this.y = y;
+        }
+    }
+
+    static class Point3 extends Point {
+        int z;
+        Point3(int x, int y, int z) {
+            super(x, y);
+            this.z = z;
+        }
+    }
+
+    static Point escaped;
+
+    static int twoWay(boolean flag, int a, int b) {
+        Point p = flag ? new Point(a, 0) : new Point(0, b);
+        return p.x * 31 + p.y;
+    }
+
+    static int threeWay(int sel, int a, int b) {
+        Point p;
+        if (sel == 0) {
+            p = new Point(a, b);
+        } else if (sel == 1) {
+            p = new Point3(b, a, sel);
+        } else {
+            p = new Point(a + b, a - b);
+            p.y += sel;
+        }
+        return p.x * 31 + p.y;
+    }
+
+    static int escapesOnOnePath(boolean flag, int a, int b) {
+        Point p = new Point(a, b);
+        if (flag) {
+            escaped = p;
+        } else {
+            p = new Point(b, a);
+        }
+        p.x++;
+        return p.x * 31 + p.y;
+    }
+
+    static int storeAfterMerge(boolean flag, int a, int b) {
+        Point p = flag ? new Point(a, b) : new Point(b, a);
+        p.x = a * b;
+        return p.x * 31 + p.y;
+    }
+
+    static final int ITERATIONS = 100000;
+
+    public static void main(String[] args) {
+        boolean eliminated = args[0].equals("eliminated");
+
+        for (int i = 0; i < ITERATIONS; i++) {
+            int a = i;
+            int b = i * 7 + 3;
+            boolean flag = (i & 1) == 0;
+            int sel = i % 3;
+
+            Asserts.assertEQ(twoWay(flag, a, b), flag ? a * 31 : b);
+            int ex = (sel == 0) ? a * 31 + b
+                   : (sel == 1) ? b * 31 + a
+                   : (a + b) * 31 + (a - b) + sel;
+            Asserts.assertEQ(threeWay(sel, a, b), ex);
+            Asserts.assertEQ(escapesOnOnePath(flag, a, b), flag ? (a + 1) * 31 + b : (b + 1) * 31 + a);
+            if (flag) {
+                Asserts.assertEQ(escaped.x, a + 1);
+                Asserts.assertEQ(escaped.y, b);
+            }
+            Asserts.assertEQ(storeAfterMerge(flag, a, b), a * b * 31 + (flag ? b : a));
+        }
+
+        // twoWay and threeWay are compiled by now. Each call allocates a
+        // Point unless the merged allocations were scalar replaced.
+        ThreadMXBean bean = (ThreadMXBean) ManagementFactory.getThreadMXBean();
+        long id = Thread.currentThread().getId();
+        long before = bean.getThreadAllocatedBytes(id);
+        int sum = 0;
+        for (int i = 0; i < ITERATIONS; i++) {
+            sum += twoWay((i & 1) == 0, i, i + 1);
+            sum += threeWay(i % 3, i, i + 1);
+        }
+        long allocated = bean.getThreadAllocatedBytes(id) - before;
+        System.out.println(sum + ": " + allocated + " bytes allocated");
+        if (eliminated) {
+            Asserts.assertLT(allocated, (long)ITERATIONS, "merged allocations were not eliminated");
+        } else {
+            Asserts.assertGTE(allocated, 2L * 16 * ITERATIONS, "allocations were unexpectedly eliminated");
+        }
+    }
+}
@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Arrays of bounded non-constant length are scalar replaced, and
+ *          reallocated with the right length on deoptimization
+ * @library /testlibrary
+ * @run main/othervm -Xbatch -XX:-TieredCompilation -XX:-UseOnStackReplacement
+ *                   -XX:+EliminateBoundedLengthArrays TestBoundedLengthArrays eliminated
+ * @run main/othervm -Xbatch -XX:-TieredCompilation -XX:-UseOnStackReplacement
+ *                   -XX:-EliminateBoundedLengthArrays TestBoundedLengthArrays allocated
+ */
+
+import java.lang.management.ManagementFactory;
+
+import com.oracle.java.testlibrary.Asserts;
+import com.sun.management.ThreadMXBean;
+
+public class TestBoundedLengthArrays {
+
+    static int[] sinkI;
+    static long[] sinkL;
+    static Object[] sinkO;
+
+    static int testI(int n, boolean deopt) {
+        if (n < 0 || n > 8) {
+            return -1;
+        }
+        int[] a = new int[n];
+        if (n > 0) a[0] = 7;
+        if (n > 1) a[1] = n;
+        if (deopt) {
+            // Never taken during warmup: the array is described by the
+            // debug information of the uncommon trap.
+            sinkI = a;
+        }
+        return a.length + (n > 0 ? a[0] : 0) + (n > 1 ? a[1] : 0);
+    }
+
+    static long testL(int n, boolean deopt) {
+        if (n >= 6) {
+            return -1;
+        }
+        long[] a = new long[n & 7];
+        if (n > 2) a[2] = 0x123456789L * n;
+        if (deopt) {
+            sinkL = a;
+        }
+        return a.length + (n > 2 ? a[2] : 0);
+    }
+
+    static int testO(int n, boolean deopt) {
+        if (n < 0 || n >= 5) {
+            return -1;
+        }
+        Object[] a = new Object[n];
+        if (n > 0) a[0] = "x";
+        if (deopt) {
+            sinkO = a;
+        }
+        return a.length;
+    }
+
+    static final int ITERATIONS = 100000;
+
+    public static void main(String[] args) {
+        boolean eliminated = args[0].equals("eliminated");
+
+        for (int i = 0; i < ITERATIONS; i++) {
+            int n = i % 10;
+            Asserts.assertEQ(testI(n, false), (n > 8) ? -1 : n + (n > 0 ? 7 : 0) + (n > 1 ? n : 0));
+            Asserts.assertEQ(testL(n, false), (n >= 6) ? -1 : n + (n > 2 ? 0x123456789L * n : 0));
+            Asserts.assertEQ(testO(n, false), (n >= 5) ? -1 : n);
+        }
+
+        // The methods are compiled by now. Unless the arrays were scalar
+        // replaced, every call with a valid length allocates one.
+        ThreadMXBean bean = (ThreadMXBean) ManagementFactory.getThreadMXBean();
+        long id = Thread.currentThread().getId();
+        long before = bean.getThreadAllocatedBytes(id);
+        long sum = 0;
+        for (int i = 0; i < ITERATIONS; i++) {
+            int n = i % 5;
+            sum += testI(n, false) + testL(n, false) + testO(n, false);
+        }
+        long allocated = bean.getThreadAllocatedBytes(id) - before;
+        System.out.println(sum + ": " + allocated + " bytes allocated");
+        if (eliminated) {
+            Asserts.assertLT(allocated, (long)ITERATIONS, "bounded length arrays were not eliminated");
+        } else {
+            Asserts.assertGTE(allocated, 3L * 16 * ITERATIONS, "arrays were unexpectedly eliminated");
+        }
+
+        // Deoptimize with the arrays described by the debug information
+        for (int n = 0; n <= 8; n++) {
+            testI(n, true);
+            Asserts.assertEQ(sinkI.length, n);
+            for (int i = 0; i < n; i++) {
+                Asserts.assertEQ(sinkI[i], (i == 0) ? 7 : (i == 1) ? n : 0);
+            }
+        }
+        for (int n = 0; n < 6; n++) {
+            testL(n, true);
+            Asserts.assertEQ(sinkL.length, n);
+            for (int i = 0; i < n; i++) {
+                Asserts.assertEQ(sinkL[i], (i == 2) ? 0x123456789L * n : 0L);
+            }
+        }
+        for (int n = 0; n < 5; n++) {
+            testO(n, true);
+            Asserts.assertEQ(sinkO.length, n);
+            if (n > 0) {
+                Asserts.assertEQ(sinkO[0], "x");
+            }
+        }
+    }
+}
@@ -0,0 +1,226 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Type switches at call sites with several hot receivers and the itable stub cache of megamorphic interface calls
+ * @library /testlibrary
+ * @run main TestPolymorphicInlining
+ */
+
+import com.oracle.java.testlibrary.*;
+
+public class TestPolymorphicInlining {
+    public static void main(String[] args) throws Exception {
+        // Every receiver of both sites is profiled and inlined
+        OutputAnalyzer output = run("-XX:TypeProfileWidth=8");
+        for (String receiver : new String[] { "Square", "Rect", "Triangle", "Circle", "Dot", "Const", "Neg", "Twice",
+                                              "Left", "Right" }) {
+            output.shouldMatch(typeProfile(receiver));
+        }
+
+        // The bimorphic site is not inlined without UseBimorphicInlining,
+        // the polymorphic ones still are
+        output = run("-XX:TypeProfileWidth=8", "-XX:-UseBimorphicInlining");
+        output.shouldMatch(typeProfile("Square"));
+        output.shouldMatch(typeProfile("Const"));
+        output.shouldNotMatch(typeProfile("Left"));
+        output.shouldNotMatch(typeProfile("Right"));
+
+        // Two profiled receivers don't cover enough of either site
+        output = run("-XX:TypeProfileWidth=2");
+        output.shouldNotMatch(typeProfile("\\w+"));
+
+        output = run("-XX:TypeProfileWidth=8", "-XX:-UsePolymorphicInlining");
+        output.shouldNotMatch(typeProfile("\\w+"));
+
+        run("-XX:-UseItableStubCache");
+    }
+
+    static String typeProfile(String receiver) {
+        return "TypeProfile \\(\\d+/\\d+ counts\\) = TestPolymorphicInlining\\$" + receiver;
+    }
+
+    static OutputAnalyzer run(String... flags) throws Exception {
+        String[] vmArgs = {
+            "-Xbatch",
+            "-XX:-TieredCompilation",
+            "-XX:+UnlockDiagnosticVMOptions",
+            "-XX:+PrintInlining"
+        };
+        String[] cmd = new String[vmArgs.length + flags.length + 1];
+        System.arraycopy(vmArgs, 0, cmd, 0, vmArgs.length);
+        System.arraycopy(flags, 0, cmd, vmArgs.length, flags.length);
+        cmd[cmd.length - 1] = Shapes.class.getName();
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(cmd);
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.shouldHaveExitValue(0);
+        return output;
+    }
+
+    interface Shape {
+        int area();
+    }
+
+    static class Square implements Shape {
+        final int s;
+        Square(int s) { this.s = s; }
+        public int area() { return s * s; }
+    }
+
+    static class Rect implements Shape {
+        final int w, h;
+        Rect(int w, int h) { this.w = w; this.h = h; }
+        public int area() { return w * h; }
+    }
+
+    static class Triangle implements Shape {
+        final int b, h;
+        Triangle(int b, int h) { this.b = b; this.h = h; }
+        public int area() { return b * h / 2; }
+    }
+
+    static class Circle implements Shape {
+        final int r;
+        Circle(int r) { this.r = r; }
+        public int area() { return 3 * r * r; }
+    }
+
+    static class Dot implements Shape {
+        public int area() { return 1; }
+    }
+
+    // Seen only once the call sites are compiled
+    static class Ring implements Shape {
+        final int r1, r2;
+        Ring(int r1, int r2) { this.r1 = r1; this.r2 = r2; }
+        public int area() { return 3 * (r2 * r2 - r1 * r1); }
+    }
+
+    static abstract class Node {
+        abstract int eval();
+    }
+
+    static class Const extends Node {
+        final int v;
+        Const(int v) { this.v = v; }
+        int eval() { return v; }
+    }
+
+    static class Neg extends Node {
+        final int v;
+        Neg(int v) { this.v = v; }
+        int eval() { return -v; }
+    }
+
+    static class Twice extends Node {
+        final int v;
+        Twice(int v) { this.v = v; }
+        int eval() { return 2 * v; }
+    }
+
+    // Receivers of a bimorphic site
+    static class Left extends Node {
+        int eval() { return 1; }
+    }
+
+    static class Right extends Node {
+        int eval() { return -2; }
+    }
+
+    static class Shapes {
+        static int sumAreas(Shape[] shapes) {
+            int sum = 0;
+            for (Shape s : shapes) {
+                sum += s.area();
+            }
+            return sum;
+        }
+
+        static int sumNodes(Node[] nodes) {
+            int sum = 0;
+            for (Node n : nodes) {
+                sum += n.eval();
+            }
+            return sum;
+        }
+
+        static int sumPairs(Node[] pairs) {
+            int sum = 0;
+            for (Node n : pairs) {
+                sum += n.eval();
+            }
+            return sum;
+        }
+
+        public static void main(String[] args) {
+            Shape[] shapes = new Shape[100];
+            Node[] nodes = new Node[99];
+            int expected = 0;
+            for (int i = 0; i < shapes.length; i++) {
+                switch (i % 5) {
+                    case 0:  shapes[i] = new Square(i); expected += i * i; break;
+                    case 1:  shapes[i] = new Rect(i, 3); expected += i * 3; break;
+                    case 2:  shapes[i] = new Triangle(i, 4); expected += i * 2; break;
+                    case 3:  shapes[i] = new Circle(i); expected += 3 * i * i; break;
+                    default: shapes[i] = new Dot(); expected += 1; break;
+                }
+            }
+            int nodeSum = 0;
+            for (int i = 0; i < nodes.length; i++) {
+                switch (i % 3) {
+                    case 0:  nodes[i] = new Const(i); nodeSum += i; break;
+                    case 1:  nodes[i] = new Neg(i); nodeSum -= i; break;
+                    default: nodes[i] = new Twice(i); nodeSum += 2 * i; break;
+                }
+            }
+
+            Node[] pairs = new Node[100];
+            for (int i = 0; i < pairs.length; i++) {
+                pairs[i] = (i % 2 == 0) ? new Left() : new Right();
+            }
+
+            for (int i = 0; i < 20000; i++) {
+                Asserts.assertEQ(sumAreas(shapes), expected);
+                Asserts.assertEQ(sumNodes(nodes), nodeSum);
+                Asserts.assertEQ(sumPairs(pairs), -50);
+            }
+
+            // A receiver type the profile has never seen
+            shapes[7] = new Ring(2, 5);
+            expected += 3 * (25 - 4) - 4 * 7 / 2;
+            for (int i = 0; i < 20000; i++) {
+                Asserts.assertEQ(sumAreas(shapes), expected);
+            }
+
+            // A null receiver must still throw
+            shapes[11] = null;
+            try {
+                sumAreas(shapes);
+                throw new RuntimeException("no exception");
+            } catch (NullPointerException e) {
+                // expected
+            }
+        }
+    }
+}
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Arrays.equals() of primitive arrays is intrinsified and finds a
+ *          mismatch at any position
+ * @library /testlibrary
+ * @run main TestArraysEquals
+ */
+
+import java.util.Arrays;
+import java.util.regex.Matcher;
+import java.util.regex.Pattern;
+
+import com.oracle.java.testlibrary.*;
+
+public class TestArraysEquals {
+    // One line for each of equalsZ, equalsB, equalsS, equalsI and equalsJ
+    static final Pattern INTRINSIC =
+        Pattern.compile("java\\.util\\.Arrays::equals \\([0-9]+ bytes\\)\\s+\\(intrinsic\\)");
+
+    public static void main(String[] args) throws Exception {
+        // The intrinsic is only available on x86_64
+        boolean available = Platform.isX64() && Platform.isServer();
+
+        OutputAnalyzer output = run("-XX:+UseVectorizedMismatchIntrinsic");
+        Asserts.assertGTE(count(output), available ? 5 : 0);
+        output = run("-XX:+UseVectorizedMismatchIntrinsic", "-XX:UseSSE=2");
+        Asserts.assertGTE(count(output), available ? 5 : 0);
+        output = run("-XX:-UseVectorizedMismatchIntrinsic");
+        Asserts.assertEQ(count(output), 0);
+    }
+
+    static int count(OutputAnalyzer output) {
+        Matcher m = INTRINSIC.matcher(output.getStdout());
+        int count = 0;
+        while (m.find()) {
+            count++;
+        }
+        return count;
+    }
+
+    static OutputAnalyzer run(String... flags) throws Exception {
+        String[] command = {
+            "-XX:-UseOnStackReplacement",
+            "-XX:-BackgroundCompilation",
+            "-XX:+IgnoreUnrecognizedVMOptions",
+            "-XX:+UnlockDiagnosticVMOptions",
+            "-XX:+PrintIntrinsics",
+            "-XX:CompileCommand=compileonly,*Equals::equals*",
+        };
+        String[] all = Arrays.copyOf(command, command.length + flags.length + 1);
+        System.arraycopy(flags, 0, all, command.length, flags.length);
+        all[all.length - 1] = Equals.class.getName();
+        OutputAnalyzer output = new OutputAnalyzer(ProcessTools.createJavaProcessBuilder(all).start());
+        output.shouldHaveExitValue(0);
+        return output;
+    }
+
+    static class Equals {
+        static boolean equalsZ(boolean[] a, boolean[] b) { return Arrays.equals(a, b); }
+        static boolean equalsB(byte[] a, byte[] b)       { return Arrays.equals(a, b); }
+        static boolean equalsS(short[] a, short[] b)     { return Arrays.equals(a, b); }
+        static boolean equalsI(int[] a, int[] b)         { return Arrays.equals(a, b); }
+        static boolean equalsJ(long[] a, long[] b)       { return Arrays.equals(a, b); }
+
+        static final int MAX_LEN = 70;
+
+        public static void main(String[] args) {
+            for (int iter = 0; iter < 200; iter++) {
+                for (int len = 0; len <= MAX_LEN; len++) {
+                    byte[] b1 = new byte[len];
+                    boolean[] z1 = new boolean[len];
+                    short[] s1 = new short[len];
+                    int[] i1 = new int[len];
+                    long[] j1 = new long[len];
+                    for (int i = 0; i < len; i++) {
+                        b1[i] = (byte)(i * 31 + len);
+                        z1[i] = (b1[i] & 1) != 0;
+                        s1[i] = (short)(b1[i] << 4);
+                        i1[i] = b1[i] * 0x01010101;
+                        j1[i] = b1[i] * 0x0101010101010101L;
+                    }
+
+                    Asserts.assertTrue(equalsZ(z1, z1.clone()));
+                    Asserts.assertTrue(equalsB(b1, b1.clone()));
+                    Asserts.assertTrue(equalsS(s1, s1.clone()));
+                    Asserts.assertTrue(equalsI(i1, i1.clone()));
+                    Asserts.assertTrue(equalsJ(j1, j1.clone()));
+
+                    // A mismatch in any single element, including the tail.
+                    for (int i = 0; i < len; i++) {
+                        boolean[] z2 = z1.clone(); z2[i] = !z2[i];
+                        byte[]    b2 = b1.clone(); b2[i] ^= 0x40;
+                        short[]   s2 = s1.clone(); s2[i] ^= 0x4000;
+                        int[]     i2 = i1.clone(); i2[i] ^= 0x40000000;
+                        long[]    j2 = j1.clone(); j2[i] ^= 0x4000000000000000L;
+                        Asserts.assertFalse(equalsZ(z1, z2));
+                        Asserts.assertFalse(equalsB(b1, b2));
+                        Asserts.assertFalse(equalsS(s1, s2));
+                        Asserts.assertFalse(equalsI(i1, i2));
+                        Asserts.assertFalse(equalsJ(j1, j2));
+                    }
+
+                    // Different lengths and nulls.
+                    Asserts.assertFalse(equalsB(b1, Arrays.copyOf(b1, len + 1)));
+                    Asserts.assertFalse(equalsJ(j1, Arrays.copyOf(j1, len + 1)));
+                    Asserts.assertFalse(equalsI(i1, null));
+                    Asserts.assertFalse(equalsI(null, i1));
+                    Asserts.assertTrue(equalsI(null, null));
+                    Asserts.assertTrue(equalsS(s1, s1));
+                }
+            }
+        }
+    }
+}
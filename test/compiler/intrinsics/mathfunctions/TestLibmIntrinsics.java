@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary The interpreter, C1 and C2 call the libm stubs for
+ *          Math.exp/log/pow/sin/cos/tan, which give the same results as StrictMath
+ * @requires os.simpleArch == "x64"
+ * @library /testlibrary
+ * @run main TestLibmIntrinsics
+ */
+
+import java.util.Arrays;
+import java.util.Random;
+
+import com.oracle.java.testlibrary.*;
+
+public class TestLibmIntrinsics {
+    static final String[] STUBS = { "Exp", "Log", "Pow", "Sin", "Cos", "Tan" };
+
+    public static void main(String[] args) throws Exception {
+        OutputAnalyzer output = run("-Xint", "-XX:+PrintStubCode");
+        for (String stub : STUBS) {
+            output.shouldContain("StubRoutines::libm" + stub);
+        }
+        run("-XX:TieredStopAtLevel=1");
+        output = run("-XX:-TieredCompilation", "-XX:+PrintOptoAssembly",
+                     "-XX:CompileCommand=compileonly,*Libm::*");
+        if (Platform.isDebugBuild()) {
+            for (String stub : STUBS) {
+                output.shouldMatch("call_leaf.*,runtime +d" + stub.toLowerCase());
+            }
+        }
+
+        output = run("-Xint", "-XX:+PrintStubCode", "-XX:-UseLibmIntrinsic");
+        output.shouldNotContain("StubRoutines::libm");
+    }
+
+    static OutputAnalyzer run(String... flags) throws Exception {
+        String[] command = {
+            "-Xbatch",
+            "-XX:+IgnoreUnrecognizedVMOptions",
+            "-XX:+UnlockDiagnosticVMOptions",
+        };
+        String[] all = Arrays.copyOf(command, command.length + flags.length + 1);
+        System.arraycopy(flags, 0, all, command.length, flags.length);
+        all[all.length - 1] = Libm.class.getName();
+        OutputAnalyzer output = new OutputAnalyzer(ProcessTools.createJavaProcessBuilder(all).start());
+        output.shouldHaveExitValue(0);
+        return output;
+    }
+
+    static class Libm {
+        static final double[] SPECIALS = {
+            0.0, -0.0, 1.0, -1.0, 2.0, -2.0, 0.5, -0.5, 3.0, 0.1, 10.0,
+            Double.MIN_VALUE, -Double.MIN_VALUE, Double.MIN_NORMAL, Double.MAX_VALUE, -Double.MAX_VALUE,
+            Double.POSITIVE_INFINITY, Double.NEGATIVE_INFINITY, Double.NaN,
+            1e-300, 1e300, 1e-20, 1e-9, 2.5e-8, 1e6, 1e9, 1e22,
+            709.78, 709.7, -708.39, -745.1, -745.2, 710.0,
+            Math.PI, -Math.PI, Math.PI / 2, -Math.PI / 2, Math.PI / 4, 3 * Math.PI / 4,
+            0.6744, 0.675, 0.78125, 823549.6, 823550.0,
+            Math.nextUp(1.0), Math.nextDown(1.0)
+        };
+
+        static double exp(double x)           { return Math.exp(x); }
+        static double log(double x)           { return Math.log(x); }
+        static double pow(double x, double y) { return Math.pow(x, y); }
+        static double sin(double x)           { return Math.sin(x); }
+        static double cos(double x)           { return Math.cos(x); }
+        static double tan(double x)           { return Math.tan(x); }
+
+        // Compare the bits, which also tells NaNs and zeros apart
+        static void same(double expected, double actual, String op, double x, double y) {
+            if (Double.doubleToLongBits(actual) != Double.doubleToLongBits(expected)) {
+                throw new AssertionError(op + "(" + x + (op.equals("pow") ? ", " + y : "") + ") = " +
+                                         actual + ", StrictMath gives " + expected);
+            }
+        }
+
+        static void test(double x) {
+            same(StrictMath.exp(x), exp(x), "exp", x, 0);
+            same(StrictMath.log(x), log(x), "log", x, 0);
+            same(StrictMath.sin(x), sin(x), "sin", x, 0);
+            same(StrictMath.cos(x), cos(x), "cos", x, 0);
+            same(StrictMath.tan(x), tan(x), "tan", x, 0);
+        }
+
+        static void test(double x, double y) {
+            same(StrictMath.pow(x, y), pow(x, y), "pow", x, y);
+        }
+
+        public static void main(String[] args) {
+            Random r = new Random(42);
+            for (int i = 0; i < 200000; i++) {
+                double any = Double.longBitsToDouble(r.nextLong());
+                double mid = Math.scalb(1.0 + r.nextDouble(), r.nextInt(80) - 40) * (r.nextBoolean() ? 1 : -1);
+                double small = (r.nextDouble() - 0.5) * 1600.0;
+                test(any);
+                test(mid);
+                test(small);
+                test(Math.abs(mid), (r.nextDouble() - 0.5) * (r.nextBoolean() ? 20.0 : 2200.0));
+                test(1.0 + small / 1e4, (r.nextDouble() - 0.5) * 2200.0);
+                test(any, mid);
+                test(Math.abs(mid), r.nextInt(64) - 32);
+            }
+            for (double x : SPECIALS) {
+                test(x);
+                for (double y : SPECIALS) {
+                    test(x, y);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Adler32 and CRC32C are intrinsified by C1 and C2 and compute the
+ *          same checksums as the reference algorithms
+ * @library /testlibrary
+ * @run main TestChecksums
+ */
+
+import java.lang.management.ManagementFactory;
+import java.nio.ByteBuffer;
+import java.util.Arrays;
+import java.util.Random;
+import java.util.zip.Adler32;
+import java.util.zip.Checksum;
+
+import com.oracle.java.testlibrary.*;
+import com.sun.management.HotSpotDiagnosticMXBean;
+
+public class TestChecksums {
+    // C2 prints "(intrinsic)", C1 "intrinsic"
+    static final String ADLER32_INTRINSIC = "java\\.util\\.zip\\.Adler32::updateBytes \\(0 bytes\\)\\s+\\(?intrinsic";
+
+    public static void main(String[] args) throws Exception {
+        run("-Xint");
+
+        // Checksum.update is called a few thousand times
+        OutputAnalyzer output = run("-XX:-TieredCompilation", "-XX:CompileThreshold=1000",
+                                    "-XX:+PrintIntrinsics");
+        if (output.getStdout().contains("UseAdler32Intrinsics=true")) {
+            output.shouldMatch(ADLER32_INTRINSIC);
+        }
+        output = run("-XX:TieredStopAtLevel=1", "-XX:+PrintInlining");
+        if (output.getStdout().contains("UseAdler32Intrinsics=true")) {
+            output.shouldMatch(ADLER32_INTRINSIC);
+        }
+        output = run("-XX:-TieredCompilation", "-XX:CompileThreshold=1000",
+                     "-XX:+PrintIntrinsics",
+                     "-XX:-UseAdler32Intrinsics", "-XX:-UseCRC32CIntrinsics");
+        output.shouldNotMatch(ADLER32_INTRINSIC);
+    }
+
+    static OutputAnalyzer run(String... flags) throws Exception {
+        String[] command = {
+            "-Xbatch",
+            "-XX:+UnlockDiagnosticVMOptions",
+        };
+        String[] all = Arrays.copyOf(command, command.length + flags.length + 1);
+        System.arraycopy(flags, 0, all, command.length, flags.length);
+        all[all.length - 1] = Checksums.class.getName();
+        OutputAnalyzer output = new OutputAnalyzer(ProcessTools.createJavaProcessBuilder(all).start());
+        output.shouldHaveExitValue(0);
+        return output;
+    }
+
+    static class Checksums {
+        static final int MAX_LEN = 12000; // more than two Adler32 blocks and three CRC32C chunks
+
+        static long adler32(byte[] b, int off, int len) {
+            long s1 = 1, s2 = 0;
+            for (int i = off; i < off + len; i++) {
+                s1 = (s1 + (b[i] & 0xff)) % 65521;
+                s2 = (s2 + s1) % 65521;
+            }
+            return (s2 << 16) | s1;
+        }
+
+        static long crc32c(byte[] b, int off, int len) {
+            int crc = 0xffffffff;
+            for (int i = off; i < off + len; i++) {
+                crc ^= b[i] & 0xff;
+                for (int k = 0; k < 8; k++) {
+                    crc = (crc >>> 1) ^ (0x82F63B78 & -(crc & 1));
+                }
+            }
+            return ~crc & 0xffffffffL;
+        }
+
+        static Checksum newCRC32C() {
+            try {
+                return (Checksum)Class.forName("java.util.zip.CRC32C").newInstance();
+            } catch (ReflectiveOperationException e) {
+                return null; // not part of this class library
+            }
+        }
+
+        static long checksum(Checksum c, byte[] b, int off, int len) {
+            c.reset();
+            c.update(b, off, len);
+            return c.getValue();
+        }
+
+        // Adler32.update(ByteBuffer) takes the updateByteBuffer path for direct buffers.
+        static long adler32Direct(Adler32 c, ByteBuffer buf, int off, int len) {
+            c.reset();
+            buf.limit(off + len).position(off);
+            c.update(buf);
+            return c.getValue();
+        }
+
+        public static void main(String[] args) {
+            HotSpotDiagnosticMXBean bean =
+                ManagementFactory.getPlatformMXBean(HotSpotDiagnosticMXBean.class);
+            System.out.println("UseAdler32Intrinsics=" +
+                               bean.getVMOption("UseAdler32Intrinsics").getValue());
+
+            Random r = new Random(42);
+            byte[] data = new byte[MAX_LEN + 16];
+            r.nextBytes(data);
+            byte[] ones = new byte[MAX_LEN];
+            Arrays.fill(ones, (byte)0xff);
+            ByteBuffer direct = ByteBuffer.allocateDirect(data.length);
+            direct.put(data);
+
+            Adler32 adler = new Adler32();
+            Checksum crc32c = newCRC32C();
+
+            for (int iter = 0; iter < 3000; iter++) {
+                int len = (iter < 200) ? iter : r.nextInt(MAX_LEN);
+                int off = r.nextInt(16);
+                long expected = adler32(data, off, len);
+                Asserts.assertEQ(checksum(adler, data, off, len), expected, "Adler32 len=" + len);
+                Asserts.assertEQ(adler32Direct(adler, direct, off, len), expected, "Adler32 direct len=" + len);
+                if (crc32c != null) {
+                    Asserts.assertEQ(checksum(crc32c, data, off, len), crc32c(data, off, len), "CRC32C len=" + len);
+                }
+            }
+            // All ones is the worst case for the unreduced sums of a block.
+            Asserts.assertEQ(checksum(adler, ones, 0, MAX_LEN), adler32(ones, 0, MAX_LEN));
+
+            // Incremental updates must compose.
+            adler.reset();
+            adler.update(data, 0, 5000);
+            adler.update(data, 5000, 7000);
+            Asserts.assertEQ(adler.getValue(), adler32(data, 0, 12000));
+        }
+    }
+}
@@ -0,0 +1,233 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+/*
+ * @test
+ * @summary Compiled LambdaForms shared between equivalent forms must produce the same results as unshared code
+ * @library /testlibrary /testlibrary/whitebox
+ * @build TestLambdaFormSharing
+ * @run main ClassFileInstaller sun.hotspot.WhiteBox
+ * @run main TestLambdaFormSharing checkLog
+ * @run main/othervm -Xbatch TestLambdaFormSharing
+ * @run main/othervm -Xbatch -XX:-ShareLambdaFormCode TestLambdaFormSharing
+ * @run main/othervm -Xbatch -XX:TierLambdaFormThresholdPercentage=1 TestLambdaFormSharing
+ * @run main/othervm -Xbatch -XX:-TieredCompilation TestLambdaFormSharing
+ */
+
+import com.oracle.java.testlibrary.Asserts;
+import com.oracle.java.testlibrary.OutputAnalyzer;
+import com.oracle.java.testlibrary.ProcessTools;
+import java.lang.invoke.MethodHandle;
+import java.lang.invoke.MethodHandles;
+import java.lang.invoke.MethodType;
+import java.lang.reflect.Field;
+import java.lang.reflect.Method;
+import jdk.internal.org.objectweb.asm.ClassWriter;
+import jdk.internal.org.objectweb.asm.MethodVisitor;
+import jdk.internal.org.objectweb.asm.Opcodes;
+import sun.hotspot.WhiteBox;
+import sun.misc.Unsafe;
+
+public class TestLambdaFormSharing {
+
+    static int add(int a, int b)      { return a + b; }
+    static int twice(int a)           { return a * 2; }
+    static boolean isEven(int a)      { return (a & 1) == 0; }
+    static int negate(int a)          { return -a; }
+
+    static MethodHandle[] makeHandles(int bound) throws Throwable {
+        MethodHandles.Lookup lookup = MethodHandles.lookup();
+        MethodType binary = MethodType.methodType(int.class, int.class, int.class);
+        MethodType unary = MethodType.methodType(int.class, int.class);
+        MethodHandle add = lookup.findStatic(TestLambdaFormSharing.class, "add", binary);
+        MethodHandle twice = lookup.findStatic(TestLambdaFormSharing.class, "twice", unary);
+        MethodHandle neg = lookup.findStatic(TestLambdaFormSharing.class, "negate", unary);
+        MethodHandle even = lookup.findStatic(TestLambdaFormSharing.class, "isEven",
+                                              MethodType.methodType(boolean.class, int.class));
+        MethodHandle bound1 = MethodHandles.insertArguments(add, 0, bound);
+        return new MethodHandle[] {
+            bound1,
+            MethodHandles.filterReturnValue(bound1, twice),
+            MethodHandles.guardWithTest(even, twice, neg),
+            MethodHandles.filterArguments(add, 1, neg),
+            MethodHandles.dropArguments(twice, 1, int.class),
+        };
+    }
+
+    static int expected(int k, int bound, int x) {
+        switch (k) {
+            case 0: return bound + x;
+            case 1: return (bound + x) * 2;
+            case 2: return isEven(x) ? x * 2 : -x;
+            case 3: return x - x;
+            default: return x * 2;
+        }
+    }
+
+    static int invoke(MethodHandle mh, int k, int x) throws Throwable {
+        switch (k) {
+            case 0: case 1: case 2: return (int) mh.invokeExact(x);
+            default: return (int) mh.invokeExact(x, x);
+        }
+    }
+
+    static void run(int bound) throws Throwable {
+        // Fresh handles spin new LambdaForms that are equivalent to earlier ones
+        MethodHandle[] mhs = makeHandles(bound);
+        for (int i = 0; i < 20000; i++) {
+            int k = i % mhs.length;
+            int r = invoke(mhs[k], k, i);
+            int e = expected(k, bound, i);
+            if (r != e) {
+                throw new RuntimeException("handle " + k + " bound " + bound + " x " + i + ": expected " + e + " but got " + r);
+            }
+        }
+    }
+
+    public static void main(String[] args) throws Throwable {
+        if (args.length > 0 && args[0].equals("checkLog")) {
+            checkLog();
+        } else {
+            runHandles();
+        }
+    }
+
+    static void runHandles() throws Throwable {
+        Thread[] threads = new Thread[4];
+        final Throwable[] failure = new Throwable[1];
+        for (int round = 0; round < 3; round++) {
+            for (int t = 0; t < threads.length; t++) {
+                final int bound = round * threads.length + t;
+                threads[t] = new Thread() {
+                    public void run() {
+                        try {
+                            TestLambdaFormSharing.run(bound);
+                        } catch (Throwable e) {
+                            synchronized (failure) {
+                                failure[0] = e;
+                            }
+                        }
+                    }
+                };
+                threads[t].start();
+            }
+            for (Thread t : threads) {
+                t.join();
+            }
+            if (failure[0] != null) {
+                throw new RuntimeException(failure[0]);
+            }
+            // Let unreferenced forms and their code be unloaded between rounds
+            System.gc();
+        }
+    }
+
+    // Two identical forms are spun, the first one is compiled and the second
+    // one must run its code; deoptimizing the first one unshares the code.
+    static void checkLog() throws Exception {
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(
+            "-Xbootclasspath/a:.",
+            "-XX:+UnlockDiagnosticVMOptions",
+            "-XX:+WhiteBoxAPI",
+            "-Xbatch",
+            "-XX:-TieredCompilation",
+            "-XX:+ShareLambdaFormCode",
+            "-XX:LogTags=compilation=debug",
+            "-Dsun.reflect.inflationThreshold=2147483647",
+            SharedCode.class.getName());
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        System.out.println(output.getOutput());
+        output.shouldHaveExitValue(0);
+
+        String out = output.getStdout();
+        String shared = output.firstMatch("Form\\S* shares the level \\d+ code of Form\\S*");
+        Asserts.assertNotNull(shared, "no code was shared");
+        String unshared = output.firstMatch("1 methods no longer share the level \\d+ code of Form\\S*");
+        Asserts.assertNotNull(unshared, "the code was not unshared after deoptimization");
+        Asserts.assertLT(out.indexOf(shared), out.indexOf(SharedCode.DEOPTIMIZING));
+        Asserts.assertGT(out.indexOf(unshared), out.indexOf(SharedCode.DEOPTIMIZING));
+    }
+
+    static class SharedCode {
+        static final String DEOPTIMIZING = "Deoptimizing the shared code";
+        static final WhiteBox WHITE_BOX = WhiteBox.getWhiteBox();
+
+        // A class like the ones spun for compiled LambdaForms: a single
+        // static method and nothing else, not even a constructor
+        static byte[] formBytes() {
+            ClassWriter cw = new ClassWriter(ClassWriter.COMPUTE_MAXS | ClassWriter.COMPUTE_FRAMES);
+            cw.visit(Opcodes.V1_8, Opcodes.ACC_FINAL | Opcodes.ACC_SUPER, "Form", null, "java/lang/Object", null);
+            MethodVisitor mv = cw.visitMethod(Opcodes.ACC_STATIC, "form", "(I)I", null, null);
+            mv.visitAnnotation("Ljava/lang/invoke/LambdaForm$Compiled;", true).visitEnd();
+            mv.visitCode();
+            mv.visitVarInsn(Opcodes.ILOAD, 0);
+            mv.visitIntInsn(Opcodes.BIPUSH, 31);
+            mv.visitInsn(Opcodes.IMUL);
+            mv.visitIntInsn(Opcodes.BIPUSH, 7);
+            mv.visitInsn(Opcodes.IADD);
+            mv.visitInsn(Opcodes.IRETURN);
+            mv.visitMaxs(0, 0);
+            mv.visitEnd();
+            cw.visitEnd();
+            return cw.toByteArray();
+        }
+
+        static Method spin(Unsafe unsafe, byte[] bytes) throws Exception {
+            Class<?> form = unsafe.defineAnonymousClass(TestLambdaFormSharing.class, bytes, null);
+            Method m = form.getDeclaredMethod("form", int.class);
+            m.setAccessible(true);
+            return m;
+        }
+
+        static void call(Method m, int count) throws Exception {
+            for (int i = 0; i < count; i++) {
+                int r = (Integer) m.invoke(null, i);
+                Asserts.assertEQ(r, i * 31 + 7);
+            }
+        }
+
+        public static void main(String[] args) throws Exception {
+            Field f = Unsafe.class.getDeclaredField("theUnsafe");
+            f.setAccessible(true);
+            Unsafe unsafe = (Unsafe) f.get(null);
+            byte[] bytes = formBytes();
+            Method first = spin(unsafe, bytes);
+            Method second = spin(unsafe, bytes);
+
+            for (int i = 0; i < 100 && !WHITE_BOX.isMethodCompiled(first); i++) {
+                call(first, 1000);
+            }
+            Asserts.assertTrue(WHITE_BOX.isMethodCompiled(first), "the first form is not compiled");
+
+            // The second form asks for a compilation, but runs the code of the first one
+            call(second, 100000);
+            Asserts.assertFalse(WHITE_BOX.isMethodCompiled(second), "the second form has code of its own");
+
+            System.out.println(DEOPTIMIZING);
+            WHITE_BOX.deoptimizeMethod(first);
+            Asserts.assertFalse(WHITE_BOX.isMethodCompiled(first), "the first form is still compiled");
+            call(second, 1000);
+        }
+    }
+}
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+/*
+ * @test
+ * @summary Unswitching on repeated, negated and conditionally executed invariant tests
+ * @library /testlibrary
+ * @run main compiler.loopopts.TestMultiConditionUnswitching
+ */
+
+package compiler.loopopts;
+
+import com.oracle.java.testlibrary.*;
+
+public class TestMultiConditionUnswitching {
+    public static void main(String[] args) throws Exception {
+        // TraceLoopOpts only exists in debug builds
+        boolean trace = Platform.isDebugBuild();
+
+        // One level of unswitching decides both the test and its negation
+        OutputAnalyzer output = run("repeated");
+        if (trace) {
+            output.shouldContain("Unswitch   1");
+            output.shouldNotContain("Unswitch   2");
+        }
+
+        // The test of flag1 doesn't dominate the backedge, but is
+        // unswitched on once flag2 is.
+        output = run("nested");
+        if (trace) {
+            output.shouldContain("Unswitch   1");
+            output.shouldContain("Unswitch   2");
+        }
+
+        output = run("nested", "-XX:LoopUnswitchingNodeBudget=0");
+        output.shouldNotContain("Unswitch");
+    }
+
+    static OutputAnalyzer run(String method, String... flags) throws Exception {
+        String[] vmArgs = {
+            "-Xbatch",
+            "-XX:-TieredCompilation",
+            "-XX:-UseOnStackReplacement",
+            "-XX:+IgnoreUnrecognizedVMOptions",
+            "-XX:+TraceLoopOpts",
+            "-XX:CompileCommand=compileonly,*Unswitching::" + method
+        };
+        String[] cmd = new String[vmArgs.length + flags.length + 2];
+        System.arraycopy(vmArgs, 0, cmd, 0, vmArgs.length);
+        System.arraycopy(flags, 0, cmd, vmArgs.length, flags.length);
+        cmd[cmd.length - 2] = Unswitching.class.getName();
+        cmd[cmd.length - 1] = method;
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(cmd);
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.shouldHaveExitValue(0);
+        return output;
+    }
+
+    static class Unswitching {
+        // The same invariant condition is tested twice, once negated
+        static int repeated(int[] a, boolean flag) {
+            int sum = 0;
+            for (int i = 0; i < a.length; i++) {
+                if (flag) {
+                    sum += a[i];
+                }
+                sum ^= i;
+                if (!flag) {
+                    sum -= a[i] * 3;
+                }
+            }
+            return sum;
+        }
+
+        // The test of flag1 is only executed on one path through the body
+        static int nested(int[] a, int limit, boolean flag1, boolean flag2) {
+            int sum = 0;
+            for (int i = 0; i < a.length; i++) {
+                if (a[i] > limit) {
+                    if (flag1) {
+                        sum += a[i];
+                    } else {
+                        sum -= 1;
+                    }
+                }
+                if (flag2) {
+                    sum *= 3;
+                }
+            }
+            return sum;
+        }
+
+        public static void main(String[] args) {
+            boolean nested = args[0].equals("nested");
+            int[] a = new int[100];
+            for (int i = 0; i < a.length; i++) {
+                a[i] = i * 7 - 300;
+            }
+
+            // The first round runs in the interpreter
+            int[] expected = new int[8];
+            for (int n = 0; n < 2000; n++) {
+                for (int k = 0; k < 8; k++) {
+                    int r = nested ? nested(a, k * 10, (k & 2) != 0, (k & 4) != 0)
+                                   : repeated(a, (k & 1) != 0);
+                    if (n == 0) {
+                        expected[k] = r;
+                    }
+                    Asserts.assertEQ(r, expected[k]);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary SuperWord packs reduction cycles into vector reduction nodes
+ * @library /testlibrary
+ * @run main compiler.loopopts.superword.TestReductions
+ */
+
+package compiler.loopopts.superword;
+
+import com.oracle.java.testlibrary.*;
+
+public class TestReductions {
+    public static void main(String[] args) throws Exception {
+        OutputAnalyzer output = run("-XX:+SuperWordReductions");
+        // The reduction nodes only exist for x86
+        if (Platform.isDebugBuild() && (Platform.isX86() || Platform.isX64())) {
+            output.shouldMatch("add_reduction[248]I");
+            output.shouldMatch("mul_reduction[248]I");
+            output.shouldMatch("xor_reduction[248]I");
+            output.shouldMatch("add_reduction[248]F");
+            output.shouldMatch("mul_reduction[248]D");
+            if (Platform.isX64()) {
+                output.shouldMatch("add_reduction[24]L");
+            }
+        }
+
+        output = run("-XX:-SuperWordReductions");
+        output.shouldNotContain("_reduction");
+    }
+
+    static OutputAnalyzer run(String flag) throws Exception {
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(
+            "-Xbatch",
+            "-XX:-TieredCompilation",
+            "-XX:+IgnoreUnrecognizedVMOptions",
+            "-XX:+PrintOptoAssembly",
+            "-XX:CompileCommand=compileonly,*Reductions::*",
+            flag,
+            Reductions.class.getName());
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.shouldHaveExitValue(0);
+        return output;
+    }
+
+    static class Reductions {
+        static final int LEN = 1003;
+
+        static int addI(int[] a, int[] b) {
+            int sum = 0;
+            for (int i = 0; i < a.length; i++) {
+                sum += a[i] * b[i];
+            }
+            return sum;
+        }
+
+        static int mulI(int[] a) {
+            int prod = 1;
+            for (int i = 0; i < a.length; i++) {
+                prod *= a[i];
+            }
+            return prod;
+        }
+
+        static int xorI(int[] a) {
+            int xor = 0;
+            for (int i = 0; i < a.length; i++) {
+                xor ^= a[i];
+            }
+            return xor;
+        }
+
+        static long addL(long[] a) {
+            long sum = 0;
+            for (int i = 0; i < a.length; i++) {
+                sum += a[i];
+            }
+            return sum;
+        }
+
+        static float addF(float[] a, float[] b) {
+            float sum = 0;
+            for (int i = 0; i < a.length; i++) {
+                sum += a[i] * b[i];
+            }
+            return sum;
+        }
+
+        static double mulD(double[] a) {
+            double prod = 1;
+            for (int i = 0; i < a.length; i++) {
+                prod *= a[i];
+            }
+            return prod;
+        }
+
+        public static void main(String[] args) {
+            int[] ia = new int[LEN];
+            int[] ib = new int[LEN];
+            long[] la = new long[LEN];
+            float[] fa = new float[LEN];
+            float[] fb = new float[LEN];
+            double[] da = new double[LEN];
+            for (int i = 0; i < LEN; i++) {
+                ia[i] = i * 0x9E3779B9 | 1;
+                ib[i] = i - 500;
+                la[i] = (long)i * 0x9E3779B97F4A7C15L | 1;
+                fa[i] = 1.0f + (i % 17) / 1024.0f;
+                fb[i] = (i % 13) * 0.1f - 0.6f;
+                da[i] = 1.0 + (i % 19) / 4096.0;
+            }
+
+            // With -Xbatch the first calls are interpreted. Floating point
+            // lanes are combined in element order, so the compiled loops
+            // must give the same bits.
+            int    addI = addI(ia, ib);
+            int    mulI = mulI(ia);
+            int    xorI = xorI(ia);
+            long   addL = addL(la);
+            float  addF = addF(fa, fb);
+            double mulD = mulD(da);
+            for (int n = 0; n < 20000; n++) {
+                addI(ia, ib); mulI(ia); xorI(ia); addL(la); addF(fa, fb); mulD(da);
+            }
+            Asserts.assertEQ(addI, addI(ia, ib), "addI");
+            Asserts.assertEQ(mulI, mulI(ia), "mulI");
+            Asserts.assertEQ(xorI, xorI(ia), "xorI");
+            Asserts.assertEQ(addL, addL(la), "addL");
+            Asserts.assertEQ(Float.floatToIntBits(addF), Float.floatToIntBits(addF(fa, fb)), "addF");
+            Asserts.assertEQ(Double.doubleToLongBits(mulD), Double.doubleToLongBits(mulD(da)), "mulD");
+        }
+    }
+}
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Vector post loops run the whole vectors left by the main loop,
+ *          and are removed again when SuperWord cannot vectorize them
+ * @library /testlibrary
+ * @run main compiler.loopopts.superword.TestVectorPostLoop
+ */
+
+package compiler.loopopts.superword;
+
+import java.util.Arrays;
+
+import com.oracle.java.testlibrary.*;
+
+public class TestVectorPostLoop {
+    public static void main(String[] args) throws Exception {
+        OutputAnalyzer output = run("-XX:+VectorizePostLoops");
+        // TraceLoopOpts only exists in debug builds, and only x86 vectorizes
+        // loops without aligning them.
+        if (Platform.isDebugBuild() && (Platform.isX86() || Platform.isX64())) {
+            output.shouldMatch("PostVector .* main");
+            output.shouldMatch("SuperWord .* post vector");
+            // The loop carried dependence of shiftI is not vectorized
+            output.shouldMatch("PostVectorOff .* post vector");
+        }
+
+        output = run("-XX:-VectorizePostLoops");
+        output.shouldNotContain("PostVector");
+    }
+
+    static OutputAnalyzer run(String flag) throws Exception {
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(
+            "-Xbatch",
+            "-XX:-TieredCompilation",
+            "-XX:+IgnoreUnrecognizedVMOptions",
+            "-XX:+TraceLoopOpts",
+            "-XX:CompileCommand=compileonly,*PostLoops::*",
+            flag,
+            PostLoops.class.getName());
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.shouldHaveExitValue(0);
+        return output;
+    }
+
+    static class PostLoops {
+        static final int MAX_LEN = 133;
+
+        static void addB(byte[] a, byte[] b, byte[] c, int len) {
+            for (int i = 0; i < len; i++) {
+                c[i] = (byte)(a[i] + b[i]);
+            }
+        }
+
+        static void mulI(int[] a, int[] b, int[] c, int from, int to) {
+            for (int i = from; i < to; i++) {
+                c[i] = a[i] * b[i];
+            }
+        }
+
+        static void shiftI(int[] a, int len) {
+            for (int i = 0; i < len; i++) {
+                a[i + 1] = a[i] + 1;
+            }
+        }
+
+        public static void main(String[] args) {
+            byte[] ba = new byte[MAX_LEN];
+            byte[] bb = new byte[MAX_LEN];
+            byte[] bc = new byte[MAX_LEN];
+            int[] ia = new int[MAX_LEN];
+            int[] ib = new int[MAX_LEN];
+            int[] ic = new int[MAX_LEN];
+            int[] id = new int[MAX_LEN + 1];
+            for (int i = 0; i < MAX_LEN; i++) {
+                ba[i] = (byte)(i * 7);
+                bb[i] = (byte)(i * 13 + 1);
+                ia[i] = i * 31 + 5;
+                ib[i] = i - 60;
+            }
+
+            // Every length leaves a different remainder for the vector
+            // post loop and the scalar post loop.
+            for (int n = 0; n < 300; n++) {
+                for (int len = 0; len <= MAX_LEN; len++) {
+                    Arrays.fill(bc, (byte)-1);
+                    addB(ba, bb, bc, len);
+                    for (int i = 0; i < MAX_LEN; i++) {
+                        Asserts.assertEQ(bc[i], (i < len) ? (byte)(ba[i] + bb[i]) : (byte)-1);
+                    }
+
+                    int from = len % 5;
+                    Arrays.fill(ic, -1);
+                    mulI(ia, ib, ic, from, len);
+                    for (int i = 0; i < MAX_LEN; i++) {
+                        Asserts.assertEQ(ic[i], (i >= from && i < len) ? ia[i] * ib[i] : -1);
+                    }
+
+                    Arrays.fill(id, 0);
+                    shiftI(id, len);
+                    Asserts.assertEQ(id[len], len);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+/*
+ * @test
+ * @summary Compilations that exceed CompilerMemoryLimit bail out and the program keeps running
+ * @library ../../testlibrary
+ * @run main TestCompilerMemoryLimit
+ */
+
+import com.oracle.java.testlibrary.*;
+
+public class TestCompilerMemoryLimit {
+
+    static int work(int[] a) {
+        int sum = 0;
+        for (int i = 0; i < a.length; i++) {
+            sum += a[i] * (i & 7);
+        }
+        return sum;
+    }
+
+    public static class Workload {
+        public static void main(String[] args) {
+            int[] a = new int[1000];
+            for (int i = 0; i < a.length; i++) {
+                a[i] = i;
+            }
+            int expected = work(a);
+            for (int i = 0; i < 20000; i++) {
+                if (work(a) != expected) {
+                    throw new RuntimeException("wrong result");
+                }
+            }
+        }
+    }
+
+    static OutputAnalyzer run(String... flags) throws Exception {
+        String[] args = new String[flags.length + 4];
+        System.arraycopy(flags, 0, args, 0, flags.length);
+        args[flags.length]     = "-Xbatch";
+        args[flags.length + 1] = "-XX:+PrintCompilation";
+        args[flags.length + 2] = "-XX:CompileCommand=quiet";
+        args[flags.length + 3] = Workload.class.getName();
+        OutputAnalyzer out = new OutputAnalyzer(ProcessTools.createJavaProcessBuilder(args).start());
+        out.shouldHaveExitValue(0);
+        return out;
+    }
+
+    public static void main(String[] args) throws Exception {
+        // Every compilation needs more than one byte
+        run("-XX:CompilerMemoryLimit=1").shouldContain("compilation memory limit exceeded");
+        run("-XX:CompilerMemoryLimit=1", "-XX:-TieredCompilation").shouldContain("compilation memory limit exceeded");
+        run("-XX:CompilerMemoryLimit=0").shouldNotContain("compilation memory limit exceeded");
+        run("-XX:CompilerThreadChunkCacheSize=0").shouldNotContain("compilation memory limit exceeded");
+    }
+}
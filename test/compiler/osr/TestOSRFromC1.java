@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary A long running loop in C1 code migrates into its C2 OSR version, which uses the parameter profile
+ * @library /testlibrary
+ * @run main TestOSRFromC1
+ */
+
+import com.oracle.java.testlibrary.*;
+
+public class TestOSRFromC1 {
+
+    static final String LEVEL3_COMPILE = "\\s3\\s+TestOSRFromC1\\$Work::sum \\(";
+    static final String LEVEL4_OSR = "%\\s+4\\s+TestOSRFromC1\\$Work::sum @ \\d+ \\(";
+    static final String MIGRATION =
+        "TestOSRFromC1\\$Work.sum\\(\\S+\\)J migrates from level 3 code into the level 4 OSR code at bci \\d+";
+    static final String SPECULATION =
+        "OSR compilation of TestOSRFromC1\\$Work::sum speculates that parameter 0 is TestOSRFromC1\\$Square";
+
+    static OutputAnalyzer run(String... flags) throws Exception {
+        String[] cmd = new String[flags.length + 5];
+        cmd[0] = "-XX:+TieredCompilation";
+        cmd[1] = "-XX:TypeProfileLevel=222";
+        cmd[2] = "-XX:+PrintCompilation";
+        cmd[3] = "-XX:LogTags=compilation=debug";
+        System.arraycopy(flags, 0, cmd, 4, flags.length);
+        cmd[cmd.length - 1] = Work.class.getName();
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(cmd);
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.shouldHaveExitValue(0);
+
+        // The loop runs in level 3 code before it enters the level 4 OSR code
+        String out = output.getOutput();
+        String level3 = output.firstMatch(LEVEL3_COMPILE);
+        String osr = output.firstMatch(LEVEL4_OSR);
+        Asserts.assertNotNull(level3, "sum was not compiled at level 3");
+        Asserts.assertNotNull(osr, "sum has no level 4 OSR version");
+        Asserts.assertLT(out.indexOf(level3), out.indexOf(osr),
+                         "the level 4 OSR compilation must follow the level 3 compilation");
+        return output;
+    }
+
+    public static void main(String[] args) throws Exception {
+        OutputAnalyzer output = run();
+        output.shouldMatch(MIGRATION);
+        output.shouldMatch(SPECULATION);
+
+        output = run("-XX:-C1EagerOSRMigration");
+        output.shouldNotMatch(MIGRATION);
+        output.shouldMatch(SPECULATION);
+
+        output = run("-XX:-UseParameterProfileAtOSR");
+        output.shouldMatch(MIGRATION);
+        output.shouldNotMatch("speculates that parameter");
+    }
+
+    static abstract class Shape {
+        abstract int area();
+    }
+
+    static class Square extends Shape {
+        int side;
+        Square(int side) { this.side = side; }
+        int area() { return side * side; }
+    }
+
+    static class Rect extends Shape {
+        int w, h;
+        Rect(int w, int h) { this.w = w; this.h = h; }
+        int area() { return w * h; }
+    }
+
+    static class Work {
+        // Called often enough with short loops to be compiled at level 3
+        // only, then with a loop long enough to need OSR from the C1 code.
+        static long sum(Shape s, Object unused, int n) {
+            long total = 0;
+            for (int i = 0; i < n; i++) {
+                total += s.area() + (i & 3);
+            }
+            return total;
+        }
+
+        static long expected(Shape s, int n) {
+            long a = s.area();
+            return a * n + (n / 4) * 6 + ((n & 3) > 1 ? 1 : 0) + ((n & 3) > 2 ? 2 : 0);
+        }
+
+        public static void main(String[] args) {
+            Square sq = new Square(3);
+            for (int i = 0; i < 1000; i++) {
+                sum(sq, null, 2);
+            }
+            int n = 100000000;
+            Asserts.assertEQ(sum(sq, null, n), expected(sq, n));
+            // A parameter of a different type must be handled by the OSR code
+            Rect rect = new Rect(2, 5);
+            Asserts.assertEQ(sum(rect, sq, 1000000), expected(rect, 1000000));
+        }
+    }
+}
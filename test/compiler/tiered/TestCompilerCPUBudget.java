@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Compiler threads held to a CPU budget report their CPU share and hold back when over it
+ * @library /testlibrary
+ * @run main TestCompilerCPUBudget
+ */
+
+import java.util.regex.Matcher;
+import java.util.regex.Pattern;
+
+import com.oracle.java.testlibrary.*;
+
+public class TestCompilerCPUBudget {
+
+    static final Pattern WINDOW = Pattern.compile(
+        "\\[debug\\]\\[compilation\\] compiler CPU share ([0-9.]+)% of \\d+ CPUs, " +
+        "thread fraction ([0-9.]+), threshold scale ([0-9.]+)");
+
+    static void checkWindows(int budget, String... flags) throws Exception {
+        String[] cmd = new String[flags.length + 5];
+        cmd[0] = "-XX:+UsePerfData";
+        cmd[1] = "-XX:LogTags=compilation=debug";
+        cmd[2] = "-XX:CompilerCPUBudgetPercentage=" + budget;
+        cmd[3] = "-XX:CompilerCPUBudgetWindow=20";
+        System.arraycopy(flags, 0, cmd, 4, flags.length);
+        cmd[cmd.length - 1] = Workload.class.getName();
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(cmd);
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.shouldHaveExitValue(0);
+
+        int windows = 0;
+        Matcher m = WINDOW.matcher(output.getStdout());
+        while (m.find()) {
+            double share = Double.parseDouble(m.group(1));
+            double fraction = Double.parseDouble(m.group(2));
+            double scale = Double.parseDouble(m.group(3));
+            if (budget == 0) {
+                // Measured only
+                Asserts.assertEQ(fraction, 1.0, m.group());
+                Asserts.assertEQ(scale, 1.0, m.group());
+            } else if (share > 2 * budget) {
+                // Well over budget: fewer threads and higher thresholds
+                Asserts.assertLT(fraction, 1.0, m.group());
+                Asserts.assertGT(scale, 1.0, m.group());
+            }
+            windows++;
+        }
+        Asserts.assertGT(windows, 0, "no compiler CPU share was logged");
+    }
+
+    public static void main(String[] args) throws Exception {
+        checkWindows(0);
+        checkWindows(5);
+        checkWindows(5, "-XX:-TieredCompilation");
+    }
+
+    static class Workload {
+        interface Op {
+            long apply(long x);
+        }
+
+        // Many small methods to keep the compile queues busy
+        static final Op[] OPS = new Op[] {
+            new Op() { public long apply(long x) { return x + 1; } },
+            new Op() { public long apply(long x) { return x * 3; } },
+            new Op() { public long apply(long x) { return x ^ 0x5555; } },
+            new Op() { public long apply(long x) { return x - 7; } },
+            new Op() { public long apply(long x) { return Long.rotateLeft(x, 5); } },
+            new Op() { public long apply(long x) { return x / 3 + x % 5; } },
+            new Op() { public long apply(long x) { return x << 2 | x >>> 60; } },
+            new Op() { public long apply(long x) { return Math.max(x, 17) - Math.min(x, 3); } },
+        };
+
+        static long hot(long x, int n) {
+            for (int i = 0; i < n; i++) {
+                x = OPS[i & 7].apply(x);
+            }
+            return x;
+        }
+
+        public static void main(String[] args) throws Exception {
+            long x = 42;
+            for (int i = 0; i < 5000; i++) {
+                x = hot(x, 1000);
+            }
+            Asserts.assertGT(PerfCounters.findByName("sun.ci.compilerCPUTime").longValue(), 0L,
+                             "sun.ci.compilerCPUTime");
+            // In hundredths of a percent
+            long share = PerfCounters.findByName("sun.ci.compilerCPUShare").longValue();
+            Asserts.assertGTE(share, 0L, "sun.ci.compilerCPUShare");
+            Asserts.assertLTE(share, 10000L * Runtime.getRuntime().availableProcessors(),
+                              "sun.ci.compilerCPUShare");
+        }
+    }
+}
@@ -58,11 +58,13 @@ public class TestGCLogMessages {
         new LogMessageWithLevel("StringTable Roots (ms)", Level.FINEST),
         new LogMessageWithLevel("Universe Roots (ms)", Level.FINEST),
         new LogMessageWithLevel("JNI Handles Roots (ms)", Level.FINEST),
+        new LogMessageWithLevel("Claimed Stripes", Level.FINEST),
         new LogMessageWithLevel("ObjectSynchronizer Roots (ms)", Level.FINEST),
         new LogMessageWithLevel("FlatProfiler Roots", Level.FINEST),
         new LogMessageWithLevel("Management Roots", Level.FINEST),
         new LogMessageWithLevel("SystemDictionary Roots", Level.FINEST),
         new LogMessageWithLevel("CLDG Roots", Level.FINEST),
+        new LogMessageWithLevel("Claimed Chunks", Level.FINEST),
         new LogMessageWithLevel("JVMTI Roots", Level.FINEST),
         new LogMessageWithLevel("CodeCache Roots", Level.FINEST),
         new LogMessageWithLevel("SATB Filtering", Level.FINEST),
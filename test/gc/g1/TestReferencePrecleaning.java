@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2016, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test TestReferencePrecleaning
+ * @summary G1: discovered references are precleaned concurrently, young
+ *          GCs can run while precleaning, and small discovered sets are
+ *          processed without starting the worker threads
+ * @library /testlibrary
+ */
+
+import java.lang.ref.WeakReference;
+import java.util.ArrayList;
+
+import com.oracle.java.testlibrary.*;
+
+public class TestReferencePrecleaning {
+    public static void main(String[] args) throws Exception {
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(
+            "-XX:+UseG1GC",
+            "-Xmx64m",
+            "-XX:+ExplicitGCInvokesConcurrent",
+            "-XX:+PrintGC",
+            "-XX:+G1UseReferencePrecleaning",
+            ReferenceAllocator.class.getName());
+
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.shouldContain("[GC concurrent-preclean-start]");
+        output.shouldMatch("\\[GC concurrent-preclean-end, [0-9.]+ secs\\]");
+        output.shouldHaveExitValue(0);
+
+        pb = ProcessTools.createJavaProcessBuilder(
+            "-XX:+UseG1GC",
+            "-Xmx64m",
+            "-XX:+ExplicitGCInvokesConcurrent",
+            "-XX:+ParallelRefProcEnabled",
+            "-XX:ParallelGCThreads=4",
+            "-XX:ReferencesPerThread=1000000",
+            "-XX:LogTags=ref=debug",
+            ReferenceAllocator.class.getName());
+
+        output = new OutputAnalyzer(pb.start());
+        output.shouldMatch("\\[debug\\]\\[ref\\] Processing [0-9]+ discovered references serially");
+        output.shouldHaveExitValue(0);
+
+        // Precleaning must give way to the young GCs requested meanwhile,
+        // or the allocating thread would wait for the safepoint forever.
+        pb = ProcessTools.createJavaProcessBuilder(
+            "-XX:+UseG1GC",
+            "-Xmx128m",
+            "-Xmn8m",
+            "-XX:+ExplicitGCInvokesConcurrent",
+            "-XX:+PrintGC",
+            "-XX:+G1UseReferencePrecleaning",
+            "-XX:G1RefProcDrainInterval=1",
+            ConcurrentYoungGCs.class.getName());
+
+        output = new OutputAnalyzer(pb.start());
+        output.shouldContain("[GC concurrent-preclean-start]");
+        output.shouldMatch("\\[GC concurrent-preclean-end, [0-9.]+ secs\\]");
+        output.shouldContain("[GC pause (G1 Evacuation Pause) (young)");
+        output.shouldHaveExitValue(0);
+    }
+
+    static class ReferenceAllocator {
+        public static void main(String [] args) throws Exception {
+            ArrayList<Object> referents = new ArrayList<>();
+            ArrayList<WeakReference<Object>> refs = new ArrayList<>();
+            for (int i = 0; i < 10000; i++) {
+                Object o = new Object();
+                if (i % 2 == 0) {
+                    referents.add(o);
+                }
+                refs.add(new WeakReference<>(o));
+            }
+            // Each System.gc() starts a concurrent cycle, give the
+            // cycles time to complete.
+            for (int i = 0; i < 5; i++) {
+                System.gc();
+                Thread.sleep(200);
+            }
+            System.out.println(referents.size() + " " + refs.size());
+        }
+    }
+
+    static class ConcurrentYoungGCs {
+        static volatile Object sink;
+        static volatile boolean done;
+
+        public static void main(String [] args) throws Exception {
+            ArrayList<Object> referents = new ArrayList<>();
+            ArrayList<WeakReference<Object>> refs = new ArrayList<>();
+            for (int i = 0; i < 100000; i++) {
+                Object o = new Object[] { new Object() };
+                if (i % 2 == 0) {
+                    referents.add(o);
+                }
+                refs.add(new WeakReference<>(o));
+            }
+
+            Thread allocator = new Thread() {
+                public void run() {
+                    while (!done) {
+                        sink = new byte[1024];
+                    }
+                }
+            };
+            allocator.start();
+            for (int i = 0; i < 20; i++) {
+                System.gc();
+                Thread.sleep(100);
+            }
+            done = true;
+            allocator.join();
+            System.out.println(referents.size() + " " + refs.size());
+        }
+    }
+}
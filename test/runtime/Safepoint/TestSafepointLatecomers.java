@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2016, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test TestSafepointLatecomers
+ * @summary Check that the slowest threads to reach a safepoint are reported
+ * @library /testlibrary
+ * @run main/othervm TestSafepointLatecomers
+ */
+
+import com.oracle.java.testlibrary.*;
+
+public class TestSafepointLatecomers {
+  public static void main(String args[]) throws Exception {
+    ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(
+      "-XX:+PrintSafepointLatecomers",
+      "-XX:SafepointLatecomerThreshold=0",
+      "-XX:SafepointLatecomerCount=2",
+      "TestSafepointLatecomers$SystemGCCaller"
+      );
+
+    OutputAnalyzer output = new OutputAnalyzer(pb.start());
+    output.shouldContain("Safepoint latecomers:");
+    output.shouldMatch("rank=1 time_to_safepoint_ms=[0-9.]+ tid=[0-9]+ name=\".*\" state=_thread_");
+    output.shouldNotContain("rank=3");
+    output.shouldHaveExitValue(0);
+
+    pb = ProcessTools.createJavaProcessBuilder(
+      "-XX:SafepointLatecomerCount=0",
+      "-version"
+      );
+    output = new OutputAnalyzer(pb.start());
+    output.shouldContain("SafepointLatecomerCount");
+    output.shouldNotHaveExitValue(0);
+  }
+
+  static class SystemGCCaller {
+    public static void main(String [] args) {
+      System.gc();
+    }
+  }
+}
@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Methods whose frequent bytecode pairs are rewritten into superinstructions must execute unchanged
+ * @library /testlibrary
+ * @run main TestSuperinstructions
+ */
+
+import com.oracle.java.testlibrary.*;
+
+public class TestSuperinstructions {
+    static final String[] SUPERINSTRUCTIONS = {
+        "fast_aload_0_aload_1",
+        "fast_aload_0_iload_1",
+        "fast_aload_0_dup",
+        "fast_aload_1_aload_2",
+        "fast_iload_1_iload_2",
+        "fast_iload_iconst_1"
+    };
+
+    public static void main(String[] args) throws Exception {
+        // PrintBytecodeHistogram only exists in debug builds
+        OutputAnalyzer output = run("-Xint");
+        if (Platform.isDebugBuild()) {
+            for (String s : SUPERINSTRUCTIONS) {
+                output.shouldMatch("\\s+[0-9a-f]{2}\\s+" + s + "\\s");
+            }
+        }
+
+        output = run("-Xint", "-XX:-RewriteSuperinstructions");
+        for (String s : SUPERINSTRUCTIONS) {
+            output.shouldNotMatch("\\s+[0-9a-f]{2}\\s+" + s + "\\s");
+        }
+
+        run("-Xbatch");
+    }
+
+    static OutputAnalyzer run(String... flags) throws Exception {
+        String[] vmArgs = {
+            "-XX:+IgnoreUnrecognizedVMOptions",
+            "-XX:+PrintBytecodeHistogram"
+        };
+        String[] cmd = new String[vmArgs.length + flags.length + 1];
+        System.arraycopy(vmArgs, 0, cmd, 0, vmArgs.length);
+        System.arraycopy(flags, 0, cmd, vmArgs.length, flags.length);
+        cmd[cmd.length - 1] = Pairs.class.getName();
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(cmd);
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.shouldHaveExitValue(0);
+        return output;
+    }
+
+    static class Pairs {
+        int count;
+        int value;
+
+        // aload_0 iload_1
+        void setValue(int v) {
+            this.value = v;
+        }
+
+        // aload_0 aload_1
+        boolean isSelf(Object o) {
+            return this == o;
+        }
+
+        // aload_0 dup
+        void increment() {
+            this.count++;
+        }
+
+        // iload_1 iload_2
+        int add(int a, int b) {
+            return a + b;
+        }
+
+        // aload_1 aload_2, with a trapping bytecode right after the pair
+        static boolean same(int unused, Object a, Object b) {
+            return a.equals(b);
+        }
+
+        // iload iconst_1 on a local above index 3, and a loop branching back to the pair
+        static int sum(int n) {
+            int a = 0, b = 0, c = 0;
+            int i = 0;
+            int s = 0;
+            while (i < n) {
+                s += i + 1;
+                i = i + 1;
+            }
+            return s + a + b + c;
+        }
+
+        // the second bytecode of a pair is the target of a branch
+        int select(boolean flag, int v) {
+            int r = flag ? v : 1;
+            return r + value;
+        }
+
+        public static void main(String[] args) {
+            Pairs p = new Pairs();
+            Object other = new Object();
+            for (int iter = 0; iter < 20000; iter++) {
+                p.setValue(iter);
+                Asserts.assertEQ(p.value, iter);
+                Asserts.assertTrue(p.isSelf(p));
+                Asserts.assertFalse(p.isSelf(other));
+                p.increment();
+                Asserts.assertEQ(p.count, iter + 1);
+                Asserts.assertEQ(p.add(iter, iter + 3), 2 * iter + 3);
+                Asserts.assertTrue(same(0, other, other));
+                int n = iter % 100;
+                Asserts.assertEQ(sum(n), n * (n + 1) / 2);
+                Asserts.assertEQ(p.select(true, iter), 2 * iter);
+                Asserts.assertEQ(p.select(false, iter), iter + 1);
+            }
+
+            // The NullPointerException must come from the invokevirtual after the pair
+            try {
+                same(0, null, other);
+                throw new RuntimeException("no exception");
+            } catch (NullPointerException e) {
+                StackTraceElement top = e.getStackTrace()[0];
+                Asserts.assertEQ(top.getMethodName(), "same", "NullPointerException thrown in " + top);
+            }
+        }
+    }
+}
@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2016, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include <jni.h>
+#include <stdint.h>
+
+JNIEXPORT jlong JNICALL
+Java_JNIGlobalHandleStress_newGlobal(JNIEnv *env, jclass clazz, jobject o) {
+  return (jlong)(intptr_t)(*env)->NewGlobalRef(env, o);
+}
+
+JNIEXPORT jlong JNICALL
+Java_JNIGlobalHandleStress_newWeakGlobal(JNIEnv *env, jclass clazz, jobject o) {
+  return (jlong)(intptr_t)(*env)->NewWeakGlobalRef(env, o);
+}
+
+/* Returns NULL for a weak global handle whose object was collected */
+JNIEXPORT jobject JNICALL
+Java_JNIGlobalHandleStress_get(JNIEnv *env, jclass clazz, jlong ref) {
+  return (*env)->NewLocalRef(env, (jobject)(intptr_t)ref);
+}
+
+JNIEXPORT void JNICALL
+Java_JNIGlobalHandleStress_deleteGlobal(JNIEnv *env, jclass clazz, jlong ref) {
+  (*env)->DeleteGlobalRef(env, (jobject)(intptr_t)ref);
+}
+
+JNIEXPORT void JNICALL
+Java_JNIGlobalHandleStress_deleteWeakGlobal(JNIEnv *env, jclass clazz, jlong ref) {
+  (*env)->DeleteWeakGlobalRef(env, (jweak)(intptr_t)ref);
+}
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2016, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+import java.util.concurrent.ConcurrentLinkedQueue;
+
+// Creates and deletes global and weak global JNI handles from many threads
+// while the threads also cause collections, see test.sh
+public class JNIGlobalHandleStress {
+    static {
+        System.loadLibrary("JNIGlobalHandleStress");
+    }
+
+    // The handles are passed around as longs
+    static native long newGlobal(Object o);
+    static native long newWeakGlobal(Object o);
+    static native Object get(long ref);
+    static native void deleteGlobal(long ref);
+    static native void deleteWeakGlobal(long ref);
+
+    static final int THREADS = 8;
+    static final int ROUNDS = 10;
+    static final int HANDLES = 1000;
+
+    // Global handles of all threads, deleted by whichever thread polls them
+    static final ConcurrentLinkedQueue<Long> pending = new ConcurrentLinkedQueue<>();
+
+    static class Payload {
+        final int id;
+        Payload(int id) {
+            this.id = id;
+        }
+    }
+
+    static void check(boolean condition, String msg) {
+        if (!condition) {
+            throw new RuntimeException(msg);
+        }
+    }
+
+    static void round(int thread, int round) {
+        Payload[] live = new Payload[HANDLES];
+        long[] globals = new long[HANDLES];
+        long[] liveWeaks = new long[HANDLES];
+        long[] deadWeaks = new long[HANDLES];
+        for (int i = 0; i < HANDLES; i++) {
+            int id = (thread * ROUNDS + round) * HANDLES + i;
+            live[i] = new Payload(id);
+            globals[i] = newGlobal(new Payload(id));
+            liveWeaks[i] = newWeakGlobal(live[i]);
+            deadWeaks[i] = newWeakGlobal(new Payload(id));
+        }
+
+        // Completes a full collection that started after the handles were made
+        System.gc();
+
+        for (int i = 0; i < HANDLES; i++) {
+            Payload p = (Payload) get(globals[i]);
+            check(p != null && p.id == live[i].id, "global handle lost its object");
+            check(get(liveWeaks[i]) == live[i], "weak global handle to a live object was cleared");
+            check(get(deadWeaks[i]) == null, "weak global handle to a dead object was not cleared");
+            deleteWeakGlobal(liveWeaks[i]);
+            deleteWeakGlobal(deadWeaks[i]);
+            pending.add(globals[i]);
+        }
+
+        // Delete as many global handles as were made, mostly of other threads
+        for (int i = 0; i < HANDLES; i++) {
+            Long ref = pending.poll();
+            if (ref == null) {
+                break;
+            }
+            check(get(ref) instanceof Payload, "global handle lost its object");
+            deleteGlobal(ref);
+        }
+    }
+
+    public static void main(String[] args) throws Exception {
+        Thread[] threads = new Thread[THREADS];
+        final Throwable[] failure = new Throwable[1];
+        for (int t = 0; t < threads.length; t++) {
+            final int thread = t;
+            threads[t] = new Thread() {
+                public void run() {
+                    try {
+                        for (int r = 0; r < ROUNDS; r++) {
+                            round(thread, r);
+                        }
+                    } catch (Throwable e) {
+                        synchronized (failure) {
+                            failure[0] = e;
+                        }
+                    }
+                }
+            };
+            threads[t].start();
+        }
+        for (Thread t : threads) {
+            t.join();
+        }
+        if (failure[0] != null) {
+            throw new RuntimeException(failure[0]);
+        }
+
+        for (Long ref = pending.poll(); ref != null; ref = pending.poll()) {
+            check(get(ref) instanceof Payload, "global handle lost its object");
+            deleteGlobal(ref);
+        }
+    }
+}
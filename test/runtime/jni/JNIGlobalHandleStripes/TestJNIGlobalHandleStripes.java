@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2016, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test TestJNIGlobalHandleStripes
+ * @summary Check that global JNI handles are scanned correctly with striped allocation
+ * @library /testlibrary
+ * @run main/othervm TestJNIGlobalHandleStripes
+ */
+
+import com.oracle.java.testlibrary.*;
+
+public class TestJNIGlobalHandleStripes {
+  static void checkGC(String... flags) throws Exception {
+    String[] args = new String[flags.length + 4];
+    System.arraycopy(flags, 0, args, 0, flags.length);
+    args[flags.length] = "-XX:ParallelGCThreads=4";
+    args[flags.length + 1] = "-XX:+UnlockDiagnosticVMOptions";
+    args[flags.length + 2] = "-XX:+VerifyAfterGC";
+    args[flags.length + 3] = "TestJNIGlobalHandleStripes$SystemGCCaller";
+    ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(args);
+
+    OutputAnalyzer output = new OutputAnalyzer(pb.start());
+    output.shouldHaveExitValue(0);
+  }
+
+  public static void main(String args[]) throws Exception {
+    for (String stripes : new String[] { "1", "4", "0" }) {
+      String flag = "-XX:JNIGlobalHandleStripes=" + stripes;
+      checkGC(flag, "-XX:+UseParNewGC");
+      checkGC(flag, "-XX:+UseConcMarkSweepGC");
+      checkGC(flag, "-XX:+UseSerialGC");
+    }
+
+    ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(
+      "-XX:JNIGlobalHandleStripes=2048", "-version");
+    OutputAnalyzer output = new OutputAnalyzer(pb.start());
+    output.shouldContain("JNIGlobalHandleStripes");
+    output.shouldNotHaveExitValue(0);
+  }
+
+  static class SystemGCCaller {
+    public static void main(String [] args) throws Exception {
+      Thread[] threads = new Thread[8];
+      for (int i = 0; i < threads.length; i++) {
+        threads[i] = new Thread() {
+          public void run() {
+            for (int j = 0; j < 100; j++) {
+              byte[] garbage = new byte[64 * 1024];
+              if (j % 25 == 0) {
+                System.gc();
+              }
+            }
+          }
+        };
+        threads[i].start();
+      }
+      for (Thread t : threads) {
+        t.join();
+      }
+    }
+  }
+}
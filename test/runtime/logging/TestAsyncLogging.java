@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2016, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test TestAsyncLogging
+ * @summary Check tagged logging, with and without the asynchronous log writer
+ * @library /testlibrary
+ * @run main/othervm TestAsyncLogging
+ */
+
+import com.oracle.java.testlibrary.*;
+
+public class TestAsyncLogging {
+  static void checkSafepointLog(String... flags) throws Exception {
+    String[] args = new String[flags.length + 2];
+    System.arraycopy(flags, 0, args, 0, flags.length);
+    args[flags.length] = "-XX:SafepointLatecomerThreshold=0";
+    args[flags.length + 1] = "TestAsyncLogging$SystemGCCaller";
+    ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(args);
+
+    OutputAnalyzer output = new OutputAnalyzer(pb.start());
+    output.shouldMatch("\\[[0-9.]+s\\]\\[info\\]\\[safepoint\\] Safepoint latecomers:");
+    output.shouldHaveExitValue(0);
+  }
+
+  public static void main(String args[]) throws Exception {
+    checkSafepointLog("-XX:LogTags=safepoint=info");
+    checkSafepointLog("-XX:LogTags=all=debug", "-XX:+AsyncLogging");
+    checkSafepointLog("-XX:LogTags=safepoint", "-XX:+AsyncLogging",
+                      "-XX:AsyncLogBufferSize=4096", "-XX:AsyncLogFlushInterval=1");
+
+    ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(
+      "-XX:LogTags=nosuchtag=info", "-version");
+    OutputAnalyzer output = new OutputAnalyzer(pb.start());
+    output.shouldContain("Invalid log tag 'nosuchtag'");
+    output.shouldNotHaveExitValue(0);
+
+    pb = ProcessTools.createJavaProcessBuilder(
+      "-XX:LogTags=safepoint=loud", "-version");
+    output = new OutputAnalyzer(pb.start());
+    output.shouldContain("Invalid log level 'loud'");
+    output.shouldNotHaveExitValue(0);
+
+    pb = ProcessTools.createJavaProcessBuilder(
+      "-XX:+AsyncLogging", "-XX:AsyncLogBufferSize=5000", "-version");
+    output = new OutputAnalyzer(pb.start());
+    output.shouldContain("AsyncLogBufferSize");
+    output.shouldNotHaveExitValue(0);
+  }
+
+  static class SystemGCCaller {
+    public static void main(String [] args) {
+      System.gc();
+    }
+  }
+}
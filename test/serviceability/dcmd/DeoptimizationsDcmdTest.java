@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Test of Compiler.deoptimizations diagnostic command via MBean,
+ *          and of the deoptimization PerfData counters
+ * @library /testlibrary
+ * @compile DcmdUtil.java
+ * @run main/othervm -Xbatch -XX:-TieredCompilation -XX:CompileThreshold=1000 -XX:+UsePerfData DeoptimizationsDcmdTest
+ * @run main/othervm -Xbatch -XX:-TieredCompilation -XX:CompileThreshold=1000 -XX:+UsePerfData -XX:+UseDeoptimizationBackoff -XX:DeoptimizationBackoffLimit=1 DeoptimizationsDcmdTest backoff
+ */
+
+import java.util.regex.Matcher;
+import java.util.regex.Pattern;
+
+import com.oracle.java.testlibrary.*;
+
+public class DeoptimizationsDcmdTest {
+
+    // The initialization of Broken always fails, so C2 compiles every
+    // allocation of it to an uncommon trap which is taken on the next call.
+    static class Broken {
+        static int value = fail();
+
+        static int fail() {
+            throw new RuntimeException("Broken can't be initialized");
+        }
+    }
+
+    static boolean allocate() {
+        try {
+            new Broken();
+            return true;
+        } catch (LinkageError e) {
+            return false;
+        }
+    }
+
+    public static void main(String[] args) throws Exception {
+        boolean backoff = args.length > 0 && args[0].equals("backoff");
+
+        try {
+            new Broken();
+        } catch (ExceptionInInitializerError e) {
+            // expected
+        }
+        for (int i = 0; i < 20000; i++) {
+            Asserts.assertFalse(allocate());
+        }
+
+        String result = DcmdUtil.executeDcmd("Compiler.deoptimizations", "-limit=20");
+        String[] expected = {
+            "Deoptimization traps:",
+            "Recompilations caused by traps:",
+            "Methods backed off from recompilation:",
+            "Most recompiled methods",
+            "Deoptimization events"
+        };
+        for (String s : expected) {
+            if (!result.contains(s)) {
+                throw new Exception("Output did not contain the expected string: '" + s + "'");
+            }
+        }
+
+        int recompiles = count(result, "Recompilations caused by traps: (\\d+)");
+        int backoffs = count(result, "Methods backed off from recompilation: (\\d+)");
+        Asserts.assertGTE(count(result, "  uninitialized +(\\d+)"), 2);
+        Asserts.assertGTE(recompiles, 2);
+        if (!result.contains("DeoptimizationsDcmdTest.allocate")) {
+            throw new Exception("Recompiled method is not listed");
+        }
+
+        long perfRecompiles = PerfCounters.findByName("sun.ci.deopt.recompiles").longValue();
+        long perfBackoffs = PerfCounters.findByName("sun.ci.deopt.backoffs").longValue();
+        Asserts.assertGTE(PerfCounters.findByName("sun.ci.deopt.uninitialized").longValue(), 2L);
+        Asserts.assertGTE(perfRecompiles, (long)recompiles);
+
+        if (backoff) {
+            // The second trap after a recompilation gives up on C2
+            Asserts.assertGTE(backoffs, 1);
+            Asserts.assertGTE(perfBackoffs, 1L);
+            Asserts.assertTrue(result.contains("DeoptimizationsDcmdTest.allocate()Z (not compilable at level 4)"),
+                               "allocate is not backed off");
+            Asserts.assertTrue(result.contains("Backoff: reason=uninitialized method=DeoptimizationsDcmdTest.allocate()Z"),
+                               "no back-off event");
+        } else {
+            Asserts.assertEQ(backoffs, 0);
+            Asserts.assertEQ(perfBackoffs, 0L);
+        }
+    }
+
+    static int count(String output, String regex) throws Exception {
+        Matcher m = Pattern.compile(regex).matcher(output);
+        if (!m.find()) {
+            throw new Exception("Output did not match '" + regex + "'");
+        }
+        return Integer.parseInt(m.group(1));
+    }
+}